@@ -9,15 +9,27 @@ if [ -z "$LAST_COMMIT" ]; then
     fi
 fi
 
-FUNCTIONS_EXHAUSTIVE=(acosf acoshf acospif asinf asinhf asinpif atanf atanhf atanpif cbrtf cosf coshf cospif erff erfcf expf exp10f exp10m1f exp2f exp2m1f expm1f logf log10f log10p1f log1pf log2f log2p1f rsqrtf sinf sinhf sinpif tanf tanhf tanpif)
-FUNCTIONS_WORST=(acos asin atan2f atan2pif cbrt exp exp2 hypotf log rsqrt)
+FUNCTIONS_EXHAUSTIVE=(acosf acoshf acospif asinf asinhf asinpif atanf atanhf atanpif cbrtf cosf coshf cospif erff erfcf expf exp10f exp10m1f exp2f exp2m1f expm1f lgammaf logf log10f log10p1f log1pf log2f log2p1f rsqrtf sinf sinhf sinpif tanf tanhf tanpif tgammaf)
+FUNCTIONS_WORST=(acos acosh asin asinh atan2f atan2pif atanh cbrt compoundnf cospi erf erfc exp exp2 hypotf log pownf powrf rootnf rsqrt sinpi tanpi)
 FUNCTIONS_SPECIAL=(atan2pif hypotf)
 
 echo "Reference commit is $LAST_COMMIT"
 
+# the source file of $FUNCTION, and the local headers it includes (such as
+# the kernels shared between several functions in src/*/support)
+sources () {
+    local FILE DIR H
+    FILE="$(echo src/*/*/"$FUNCTION".c)"
+    DIR="$(dirname "$FILE")"
+    echo "$FILE"
+    for H in $(sed -n 's/^#include "\(.*\)"$/\1/p' "$FILE"); do
+        ls "$DIR/$H" "$DIR/../support/$H" 2> /dev/null || true
+    done
+}
+
 check () {
     KIND="$1"
-    if ! { echo "$FORCE_FUNCTIONS" | tr ' ' '\n' | grep --quiet '^'"$FUNCTION"'$'; } && git diff --quiet "$LAST_COMMIT".. -- src/*/*/$FUNCTION.c; then
+    if ! { echo "$FORCE_FUNCTIONS" | tr ' ' '\n' | grep --quiet '^'"$FUNCTION"'$'; } && git diff --quiet "$LAST_COMMIT".. -- $(sources); then
         echo "Skipped $FUNCTION"
     else
         echo "Checking $FUNCTION..."
@@ -0,0 +1,171 @@
+#!/bin/bash
+# Usage: ./coordinate.sh [--state DIR] [--chunk-bits B] [--range START:END]
+#                        [--worker CMD]... [rounding_modes] FUN...
+#
+# Exhaustive checks of binary32 univariate functions (as with
+# ./check.sh --exhaustive), split into ranges of 2^B encodings of |x|
+# (default B=24), which are handed out to the workers as soon as they are
+# free.  With --range, only the encodings START <= n < END of |x| are
+# checked (by default, all of them).  A worker is a command prefix, for
+# example "ssh host1" or "env OMP_NUM_THREADS=8"; the default is a single
+# local worker.  Each range is a run of check_exhaustive --range, which
+# itself uses all the cores given by OpenMP, thus give one worker per host.
+#
+# Everything is kept in the state directory (default ./coordinate.state):
+# the binaries (FUN/build), and for each range its output
+# (FUN/rndn/c.out, etc.), its checkpoint, and a file FUN/rndn/c.done once
+# it is finished.  With remote workers, this directory must be on a file system
+# shared by all the hosts, at the same path.  If the coordinator is
+# interrupted, run it again with the same arguments: it only hands out the
+# ranges which are not done, and they resume from their checkpoint.  At the
+# end, the failures of all the ranges are merged in FUN/rndn.fail, etc.
+
+MAKE=make
+
+STATE=coordinate.state
+BITS=24
+START=0
+END=$((1 << 31))
+WORKERS=()
+MODES=()
+FUNS=()
+
+while [ $# -gt 0 ]; do
+    case "$1" in
+        --state)
+            STATE="$2"
+            shift 2
+            ;;
+        --chunk-bits)
+            BITS="$2"
+            shift 2
+            ;;
+        --range)
+            START=$(($(echo "$2" | cut -d: -f1)))
+            END=$(($(echo "$2" | cut -d: -f2)))
+            shift 2
+            ;;
+        --worker)
+            WORKERS+=("$2")
+            shift 2
+            ;;
+        --rnd*)
+            MODES+=("$1")
+            shift
+            ;;
+        *)
+            FUNS+=("$1")
+            shift
+    esac
+done
+if [[ "${#MODES[@]}" -eq 0 ]]; then
+    MODES=("--rndn" "--rndz" "--rndu" "--rndd")
+fi
+if [[ "${#WORKERS[@]}" -eq 0 ]]; then
+    WORKERS=("")
+fi
+if [[ "${#FUNS[@]}" -eq 0 ]] || [[ "$BITS" -lt 20 ]] || [[ "$BITS" -gt 31 ]] \
+       || [[ "$START" -ge "$END" ]] || [[ "$END" -gt $((1 << 31)) ]]; then
+    echo "Usage: $0 [--state DIR] [--chunk-bits 20..31] [--range START:END] [--worker CMD]... [rounding_modes] FUN..."
+    exit 1
+fi
+# the ranges c*2^BITS <= n < (c+1)*2^BITS for CMIN <= c <= CMAX, restricted
+# to START <= n < END
+CMIN=$((START >> BITS))
+CMAX=$(((END - 1) >> BITS))
+
+if [ "$CFLAGS" == "" ]; then
+   export CFLAGS="-O3 -march=native -ffinite-math-only -frounding-math"
+fi
+
+mkdir -p "$STATE"
+STATE="$(cd "$STATE" && pwd)"
+
+# build check_exhaustive in the state directory, like check.sh does in a
+# temporary one (a resumed sweep keeps the binaries of the first run)
+for FUN in "${FUNS[@]}"; do
+    FILE="$(echo src/binary32/*/"$FUN".c)"
+    ORIG_DIR="$(dirname "$FILE")"
+    if ! grep -q FOR_EACH_INPUT "$ORIG_DIR/function_under_test.h" 2> /dev/null; then
+        echo "No exhaustive check for $FUN"
+        exit 1
+    fi
+    BUILD="$STATE/$FUN/build"
+    if [ -x "$BUILD/toto/$(basename "$ORIG_DIR")/check_exhaustive" ]; then
+        continue
+    fi
+    rm -rf "$BUILD"
+    mkdir -p "$BUILD/toto"
+    cp -a "$ORIG_DIR" "$ORIG_DIR/../support" "$BUILD/toto"
+    cp -a "$ORIG_DIR/../../generic" "$BUILD"
+    "$MAKE" --quiet -C "$BUILD/toto/$(basename "$ORIG_DIR")" check_exhaustive || exit 1
+done
+
+TASKS=()
+for FUN in "${FUNS[@]}"; do
+    for MODE in "${MODES[@]}"; do
+        mkdir -p "$STATE/$FUN/${MODE#--}"
+        for ((c = CMIN; c <= CMAX; c++)); do
+            if [ ! -f "$STATE/$FUN/${MODE#--}/$c.done" ]; then
+                TASKS+=("$FUN $MODE $c")
+            fi
+        done
+    done
+done
+echo "${#TASKS[@]} range(s) to check"
+
+max () { echo $(($1 > $2 ? $1 : $2)); }
+min () { echo $(($1 < $2 ? $1 : $2)); }
+
+PIDS=()
+run () {
+    local w=$1 FUN=$2 MODE=$3 c=$4
+    local BIN="$(echo "$STATE/$FUN"/build/toto/*/check_exhaustive)"
+    local OUT="$STATE/$FUN/${MODE#--}/$c"
+    (
+        # the checkpoint keeps the failures of a resumed range, and its
+        # output is appended to the previous one
+        ${WORKERS[w]} "$BIN" "$MODE" --keep \
+            --range $(max $START $((c << BITS))):$(min $END $(((c + 1) << BITS))) \
+            --checkpoint "$OUT.ckpt" >> "$OUT.out" 2>&1 && touch "$OUT.done"
+    ) &
+    PIDS[w]=$!
+}
+
+for t in "${TASKS[@]}"; do
+    # wait for a free worker
+    while true; do
+        for w in "${!WORKERS[@]}"; do
+            if [ -z "${PIDS[w]}" ] || ! kill -0 "${PIDS[w]}" 2> /dev/null; then
+                break 2
+            fi
+        done
+        wait -n
+    done
+    run $w $t
+done
+wait
+
+# merge the results
+STATUS=0
+for FUN in "${FUNS[@]}"; do
+    for MODE in "${MODES[@]}"; do
+        DIR="$STATE/$FUN/${MODE#--}"
+        MISSING=0
+        for ((c = CMIN; c <= CMAX; c++)); do
+            [ -f "$DIR/$c.done" ] || MISSING=$((MISSING + 1))
+        done
+        cat "$DIR"/*.out 2> /dev/null | grep "^FAIL" | sort -u > "$DIR.fail"
+        FAILS=$(wc -l < "$DIR.fail")
+        if [ $MISSING -gt 0 ]; then
+            echo "$FUN $MODE: $MISSING range(s) did not complete, see $DIR/*.out"
+            STATUS=1
+        elif [ $FAILS -gt 0 ]; then
+            echo "$FUN $MODE: $FAILS failure(s), see $DIR.fail"
+            STATUS=1
+        else
+            echo "$FUN $MODE: all ok"
+        fi
+    done
+done
+exit $STATUS
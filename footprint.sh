@@ -0,0 +1,92 @@
+#!/bin/bash
+# Usage: ./footprint.sh acos log erfcf
+#
+# Print the read-only tables of each function, as found in its object file:
+# size, section, size of a row (an element of the outermost dimension; the
+# whole object if it is not an array, or if it is defined inside a function),
+# and the number of cache lines read by one lookup of a row, in the worst case
+# over all rows given the alignment of the table.  For an object read as a
+# whole, such as a struct holding several arrays, the number given is that
+# of the lines it spans, which is only an upper bound.  Tables put in a .rodata.cold section are only read by the
+# accurate path.  The last line gives the total size of the other (hot)
+# tables, and the number of cache lines they bring per call, assuming one
+# row of each of them is read.
+
+set -e
+
+export LC_ALL=C.UTF-8
+
+if [ -z "$CC" ]; then
+    CC=cc
+fi
+if [ "$CFLAGS" == "" ]; then
+   CFLAGS="-O3 -march=native -ffinite-math-only -frounding-math"
+fi
+LINE=64 # cache line size in bytes
+
+TMP_DIR="$(mktemp -d /tmp/core-math.XXXXXX)"
+trap "rm -rf $TMP_DIR" 0
+
+# size of sym[0] if sym is an array defined at file scope in $file
+row_size () {
+    local sym=$1
+    case "$sym" in *.*) return 1;; esac # function-scope static
+    cat > $TMP_DIR/probe.c <<EOF
+#include "$file"
+char core_math_probe[sizeof ($sym)[0]];
+EOF
+    $CC $CFLAGS -I "$dir" -I "$dir/../support" -w -c $TMP_DIR/probe.c -o $TMP_DIR/probe.o 2> /dev/null || return 1
+    local size=$(nm -S $TMP_DIR/probe.o | awk '$4 == "core_math_probe" {print $2}')
+    echo $(( 16#$size ))
+}
+
+for f in "$@"; do
+    file="$(echo $PWD/src/binary*/*/$f.c)"
+    if [ ! -f "$file" ]; then
+        echo "Unknown function: $f"
+        exit 2
+    fi
+    dir="${file%/*}"
+    $CC $CFLAGS -I "$dir" -I "$dir/../support" -c "$file" -o $TMP_DIR/$f.o
+
+    echo "$f:"
+    # section index, name and alignment
+    readelf -SW $TMP_DIR/$f.o | sed 's/^ *\[ *\([0-9]*\)\]/\1/' | \
+        awk '$1 ~ /^[0-9]+$/ && $2 ~ /^\.rodata/ {print $1, $2, $NF}' > $TMP_DIR/sections
+    # data objects in these sections: offset, size, section index, name
+    readelf -sW $TMP_DIR/$f.o | \
+        awk '$4 == "OBJECT" && $3 > 0 {print $2, $3, $7, $8}' | \
+        while read off size ndx sym; do
+            off=$(( 16#$off ))
+            read ndx sec align <<< "$(awk -v n=$ndx '$1 == n' $TMP_DIR/sections)"
+            if [ -z "$sec" ]; then
+                continue
+            fi
+            row=$(row_size $sym || echo $size)
+            echo $sym $size $sec $align $off $row
+        done | \
+        awk -v line=$LINE '
+        {
+          sym = $1; size = $2; sec = $3; align = $4; off = $5; row = $6;
+          # worst case over the rows and the possible positions of the
+          # section with respect to cache lines
+          lines = 0;
+          for (m = 0; m == 0 || m * align < line; m++) {
+            b = (off + m * align) % line;
+            for (k = 0; k < size / row; k++) {
+              s = b + k * row;
+              n = int((s + row - 1) / line) - int(s / line) + 1;
+              if (n > lines) lines = n;
+            }
+          }
+          cold = (sec ~ /\.cold/);
+          printf "  %-24s %8d B  %-14s row %5d B  %s%d line(s)/lookup%s\n",
+                 sym, size, sec, row, row == size ? "<= " : "", lines,
+                 cold ? " (cold)" : "";
+          if (!cold) { hot += size; hotlines += lines; bound += (row == size); }
+        }
+        END {
+          printf "  hot tables: %d B, %s%d cache line(s) per call\n", hot,
+                 bound ? "<= " : "", hotlines;
+        }'
+done
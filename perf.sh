@@ -8,6 +8,8 @@ export LC_ALL=C.UTF-8
 S=20 # trial
 N=100000 # count
 M=500 # repeat
+NCOLD=2000 # count in cold mode, where each call is preceded by an eviction
+COLD_KB=${CORE_MATH_COLD_KB:-4096} # size of the eviction buffer, in KB
 
 { read -r -d '' prog_end || true; } <<EOF
 END {
@@ -104,7 +106,7 @@ u="$(echo src/binary*/*/$f.c)"
 
 if [ -z "$CORE_MATH_PERF_MODE" ]; then
     if [ -z "$CORE_MATH_QUIET" ]; then
-        echo 'CORE_MATH_PERF_MODE (perf or rdtsc) environment variable is not set. The default is perf.'
+        echo 'CORE_MATH_PERF_MODE (perf, rdtsc or cold) environment variable is not set. The default is perf.'
     fi
     CORE_MATH_PERF_MODE=perf
 fi
@@ -162,6 +164,19 @@ elif [ "$CORE_MATH_PERF_MODE" = rdtsc ]; then
 
     PERF_ARGS="${PERF_ARGS} --libc"
     proc_rdtsc
+
+elif [ "$CORE_MATH_PERF_MODE" = cold ]; then
+    # cycles of a call after its tables were evicted from the caches, for
+    # core-math, core-math after cr_math_prefetch(), and the libc
+    PERF_ARGS="${PERF_ARGS} --count ${NCOLD} --repeat 1 --rdtsc --cold ${COLD_KB}"
+    proc_rdtsc
+
+    PERF_ARGS_SAVED="${PERF_ARGS}"
+    PERF_ARGS="${PERF_ARGS} --prefetch"
+    proc_rdtsc
+
+    PERF_ARGS="${PERF_ARGS_SAVED} --libc"
+    proc_rdtsc
 fi
 
 has_symbol () {
@@ -180,6 +195,9 @@ if [ -n "$BACKUP_LIBM" ]; then
         elif [ "$CORE_MATH_PERF_MODE" = rdtsc ]; then
             PERF_ARGS="${PERF_ARGS} --rdtsc"
             proc_rdtsc
+
+        elif [ "$CORE_MATH_PERF_MODE" = cold ]; then
+            proc_rdtsc
         fi
     elif [ -z "$CORE_MATH_QUIET" ]; then
         echo "$f is not present in $LIBM; skipping" >&2
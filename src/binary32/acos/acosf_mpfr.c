@@ -30,12 +30,10 @@ SOFTWARE.
 /* code from MPFR */
 float ref_acos (float x)
 {
-  mpfr_t y;
-  mpfr_init2 (y, 24);
+  mpfr_ptr y = ref_var (0, 24);
   mpfr_set_flt (y, x, MPFR_RNDN);
   int inex = mpfr_acos (y, y, rnd2[rnd]);
   mpfr_subnormalize (y, inex, rnd2[rnd]);
   float ret = mpfr_get_flt (y, MPFR_RNDN);
-  mpfr_clear (y);
   return ret;
 }
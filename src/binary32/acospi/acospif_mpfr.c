@@ -30,11 +30,9 @@ SOFTWARE. */
 float
 ref_acospi (float x)
 {
-  mpfr_t y;
-  mpfr_init2 (y, 24);
+  mpfr_ptr y = ref_var (0, 24);
   mpfr_set_flt (y, x, MPFR_RNDN);
   mpfr_acospi (y, y, rnd2[rnd]);
   float ret = mpfr_get_flt (y, MPFR_RNDN);
-  mpfr_clear (y);
   return ret;
 }
@@ -7,12 +7,10 @@ static inline uint32_t asuint (float f);
 static inline int doloop (void)
 {
   uint32_t nmin = asuint (0x1p-149f), nmax = asuint (0x1p0f);
-#pragma omp parallel for
-  for (uint32_t n = nmin; n <= nmax; n++)
+  FOR_EACH_INPUT (n, nmin, nmax)
   {
     doit (n);
     doit (n | 0x80000000);
   }
-  printf ("all ok\n");
-  return 0;
+  return report ();
 }
@@ -16,12 +16,10 @@ static inline int doloop (void)
   doit (asuint (0x1.2fe614p+116));
   doit (asuint (0x1.2fe614p+116) ^ 0x80000000);
 #endif
-#pragma omp parallel for schedule(dynamic,1024)
-  for (uint32_t n = nmin; n <= nmax; n++)
+  FOR_EACH_INPUT (n, nmin, nmax)
   {
     doit (n);
     doit (n | 0x80000000);
   }
-  printf ("all ok\n");
-  return 0;
+  return report ();
 }
@@ -0,0 +1,145 @@
+/* Compute worst cases of atan2f.
+
+Copyright (c) 2022 Paul Zimmermann, Inria.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Example:
+
+./worst -m 44 -d 2 [-neg]
+
+looks for the inputs (y,x) of atan2(y,x) with at least 44 identical bits
+after the round bit, for 1 <= y < 2 (the default, see -ymin and -ymax) and
+x > 0, or x < 0 with -neg.  Since atan2(2^k*y,2^k*x) = atan2(y,x), these are
+all the worst cases, except those where 2^k*x or 2^k*y would be subnormal
+or overflow; and since atan2(-y,x) = -atan2(y,x), only y > 0 is considered.
+
+By default, only 2^-26*y <= |x| <= 2^26*y is searched (see -xmin and -xmax):
+- for 0 < |x| < 2^-26*y, atan2(y,x) = pi/2 -/+ t with 0 < t < 2^-26, and
+  pi/2 is at distance more than 2^-26 of the binary32 numbers and midpoints,
+  thus there is no worst case with m >= 6;
+- for x < -2^26*y, atan2(y,x) = pi - t with 0 < t < 2^-26, idem;
+- for x > 2^26*y, atan2(y,x) = y/x*(1 - t) with 0 < t < 2^-52, thus with
+  m >= 26 the worst cases are those where y/x is exact on 25 bits.
+This is 53 binades of x for each y, in each quadrant.
+
+To compile: make worst CFLAGS="-O3 -march=native"
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include <mpfr.h>
+#include "worst_engine.h"
+
+static int
+atan2_eval (mpfr_t z, mpfr_t x, float y, mpfr_rnd_t rnd)
+{
+  mpfr_t yy;
+  mpfr_init2 (yy, 24);
+  mpfr_set_flt (yy, y, MPFR_RNDN);
+  int inex = mpfr_atan2 (z, yy, x, rnd);
+  mpfr_clear (yy);
+  return inex;
+}
+
+/* the derivatives of f(x) = atan2(y,x) are f'(x) = -y/(x^2+y^2) and
+   f''(x) = 2xy/(x^2+y^2)^2 = -2x*f'(x)/(x^2+y^2) */
+static void
+atan2_deriv (mpfr_t d1, mpfr_t d2, mpfr_t x, mpfr_t fx, float y)
+{
+  (void) fx;
+  mpfr_prec_t p = mpfr_get_prec (d1);
+  mpfr_t s, t;
+  mpfr_init2 (s, p);
+  mpfr_init2 (t, 48);
+  mpfr_sqr (s, x, MPFR_RNDN);      /* exact since p >= 48 */
+  mpfr_set_flt (t, y, MPFR_RNDN);
+  mpfr_sqr (t, t, MPFR_RNDN);      /* exact */
+  mpfr_add (s, s, t, MPFR_RNDN);   /* 1 rounding */
+  mpfr_set_flt (d1, y, MPFR_RNDN);
+  mpfr_neg (d1, d1, MPFR_RNDN);
+  mpfr_div (d1, d1, s, MPFR_RNDN); /* 2 roundings */
+  mpfr_mul (d2, d1, x, MPFR_RNDN);
+  mpfr_mul_si (d2, d2, -2, MPFR_RNDN);
+  mpfr_div (d2, d2, s, MPFR_RNDN); /* 5 roundings */
+  mpfr_clear (s);
+  mpfr_clear (t);
+}
+
+/* f'''(x) = 2y(y^2-3x^2)/(x^2+y^2)^3, thus for a <= |x| <= b,
+   |f'''(x)| <= 2|y|*max(y^2,3b^2)/(a^2+y^2)^3 */
+static void
+atan2_deriv3 (mpfr_t d3, mpfr_t x0, mpfr_t x1, float y)
+{
+  mpfr_t a, b, yy, t, u;
+  mpfr_inits2 (mpfr_get_prec (d3), a, b, yy, t, u, (mpfr_ptr) 0);
+  mpfr_abs (a, x0, MPFR_RNDN);
+  mpfr_abs (b, x1, MPFR_RNDN);
+  if (mpfr_cmp (a, b) > 0)
+    mpfr_swap (a, b);
+  mpfr_set_flt (yy, fabsf (y), MPFR_RNDN);
+  mpfr_sqr (t, b, MPFR_RNDU);
+  mpfr_mul_ui (t, t, 3, MPFR_RNDU);
+  mpfr_sqr (u, yy, MPFR_RNDU);
+  mpfr_max (t, t, u, MPFR_RNDU);
+  mpfr_mul (t, t, yy, MPFR_RNDU);
+  mpfr_mul_2ui (t, t, 1, MPFR_RNDU);
+  mpfr_sqr (a, a, MPFR_RNDD);
+  mpfr_sqr (u, yy, MPFR_RNDD);
+  mpfr_add (u, u, a, MPFR_RNDD);
+  mpfr_sqr (a, u, MPFR_RNDD);
+  mpfr_mul (u, u, a, MPFR_RNDD);
+  mpfr_div (d3, t, u, MPFR_RNDU);
+  mpfr_clears (a, b, yy, t, u, (mpfr_ptr) 0);
+}
+
+static int
+atan2_xrange (float y, float *xmin, float *xmax)
+{
+  if (!(y > 0))
+    return 0;
+  double t = ldexp (y, -26), u = ldexp (y, 26);
+  *xmin = xmin_set ? Xmin : (t < 0x1p-149) ? 0x1p-149f : (float) t;
+  *xmax = xmax_set ? Xmax : (u > 0x1.fffffep127) ? 0x1.fffffep127f : (float) u;
+  return 1;
+}
+
+/* print the arguments in the order of atan2f */
+static void
+atan2_print (float x, float y)
+{
+  printf ("%a,%a", y, x);
+}
+
+static const worst_function_t atan2_function = {
+  .eval = atan2_eval,
+  .deriv = atan2_deriv,
+  .deriv3 = atan2_deriv3,
+  .xrange = atan2_xrange,
+  .print = atan2_print,
+};
+
+int
+main (int argc, char *argv[])
+{
+  return worst_main (argc, argv, &atan2_function, 0x1p0f, 0x1p1f);
+}
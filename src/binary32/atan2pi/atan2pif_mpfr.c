@@ -35,13 +35,12 @@ SOFTWARE. */
 FTYPE
 ref_atan2pi (FTYPE y, FTYPE x)
 {
-  mpfr_t xi, yi;
-  mpfr_inits2 (FBIT, xi, yi, NULL);
+  mpfr_ptr xi = ref_var (0, FBIT);
+  mpfr_ptr yi = ref_var (1, FBIT);
   JOIN(mpfr_set_, FSET) (xi, x, MPFR_RNDN);
   JOIN(mpfr_set_, FSET) (yi, y, MPFR_RNDN);
   int inex = mpfr_atan2pi (xi, yi, xi, rnd2[rnd]);
   mpfr_subnormalize (xi, inex, rnd2[rnd]);
   FTYPE ret = JOIN(mpfr_get_, FSET) (xi, MPFR_RNDN);
-  mpfr_clears (xi, yi, NULL);
   return ret;
 }
@@ -0,0 +1,181 @@
+/* Compute worst cases of atan2pif.
+
+Copyright (c) 2022 Paul Zimmermann, Inria.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+
+Example:
+
+./worst -m 44 -d 2 [-neg]
+
+looks for the inputs (y,x) of atan2pi(y,x) with at least 44 identical bits
+after the round bit, for 1 <= y < 2 (the default, see -ymin and -ymax) and
+x > 0, or x < 0 with -neg.  Since atan2pi(2^k*y,2^k*x) = atan2pi(y,x), these
+are all the worst cases, except those where 2^k*x or 2^k*y would be
+subnormal or overflow; and since atan2pi(-y,x) = -atan2pi(y,x), only y > 0 is
+considered.
+
+The default range of |x| (see -xmin and -xmax) is:
+- for x > 0, pi*2^-(26+m)*y <= x <= 2^149*y: for smaller x, atan2pi(y,x) =
+  1/2 - t with 0 < t < 2^-(26+m), which has m identical bits after the round
+  bit, and for larger x, atan2pi(y,x) < 2^-149/pi is not considered;
+- for x < 0, pi*2^-(25+m)*y <= |x| <= 2^(25+m)/pi*y: outside, atan2pi(y,x)
+  is 1/2 + t or 1 - t with 0 < t < 2^-(25+m), idem.
+With m = 44, this is 197 binades of x for each y with x > 0 (up to the
+largest binary32 number), and 136 with x < 0.
+
+To compile: make worst CFLAGS="-O3 -march=native"
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include <mpfr.h>
+#include "worst_engine.h"
+
+static int
+atan2pi_eval (mpfr_t z, mpfr_t x, float y, mpfr_rnd_t rnd)
+{
+  mpfr_t yy;
+  mpfr_init2 (yy, 24);
+  mpfr_set_flt (yy, y, MPFR_RNDN);
+  int inex = mpfr_atan2pi (z, yy, x, rnd);
+  mpfr_clear (yy);
+  return inex;
+}
+
+/* the derivatives of f(x) = atan2pi(y,x) are f'(x) = -y/(x^2+y^2)/pi and
+   f''(x) = 2xy/(x^2+y^2)^2/pi = -2x*f'(x)/(x^2+y^2) */
+static void
+atan2pi_deriv (mpfr_t d1, mpfr_t d2, mpfr_t x, mpfr_t fx, float y)
+{
+  (void) fx;
+  mpfr_prec_t p = mpfr_get_prec (d1);
+  mpfr_t s, t;
+  mpfr_init2 (s, p);
+  mpfr_init2 (t, p);
+  mpfr_sqr (s, x, MPFR_RNDN);      /* exact since p >= 48 */
+  mpfr_set_flt (t, y, MPFR_RNDN);
+  mpfr_sqr (t, t, MPFR_RNDN);      /* exact */
+  mpfr_add (s, s, t, MPFR_RNDN);   /* 1 rounding */
+  mpfr_const_pi (t, MPFR_RNDN);
+  mpfr_mul (t, t, s, MPFR_RNDN);   /* 3 roundings */
+  mpfr_set_flt (d1, y, MPFR_RNDN);
+  mpfr_neg (d1, d1, MPFR_RNDN);
+  mpfr_div (d1, d1, t, MPFR_RNDN); /* 4 roundings */
+  mpfr_mul (d2, d1, x, MPFR_RNDN);
+  mpfr_mul_si (d2, d2, -2, MPFR_RNDN);
+  mpfr_div (d2, d2, s, MPFR_RNDN); /* 7 roundings */
+  mpfr_clear (s);
+  mpfr_clear (t);
+}
+
+/* f'''(x) = 2y(y^2-3x^2)/(x^2+y^2)^3/pi, thus for a <= |x| <= b,
+   |f'''(x)| <= 2|y|*max(y^2,3b^2)/(a^2+y^2)^3/pi */
+static void
+atan2pi_deriv3 (mpfr_t d3, mpfr_t x0, mpfr_t x1, float y)
+{
+  mpfr_t a, b, yy, t, u;
+  mpfr_inits2 (mpfr_get_prec (d3), a, b, yy, t, u, (mpfr_ptr) 0);
+  mpfr_abs (a, x0, MPFR_RNDN);
+  mpfr_abs (b, x1, MPFR_RNDN);
+  if (mpfr_cmp (a, b) > 0)
+    mpfr_swap (a, b);
+  mpfr_set_flt (yy, fabsf (y), MPFR_RNDN);
+  mpfr_sqr (t, b, MPFR_RNDU);
+  mpfr_mul_ui (t, t, 3, MPFR_RNDU);
+  mpfr_sqr (u, yy, MPFR_RNDU);
+  mpfr_max (t, t, u, MPFR_RNDU);
+  mpfr_mul (t, t, yy, MPFR_RNDU);
+  mpfr_mul_2ui (t, t, 1, MPFR_RNDU);
+  mpfr_sqr (a, a, MPFR_RNDD);
+  mpfr_sqr (u, yy, MPFR_RNDD);
+  mpfr_add (u, u, a, MPFR_RNDD);
+  mpfr_sqr (a, u, MPFR_RNDD);
+  mpfr_mul (u, u, a, MPFR_RNDD);
+  mpfr_const_pi (a, MPFR_RNDD);
+  mpfr_mul (u, u, a, MPFR_RNDD);
+  mpfr_div (d3, t, u, MPFR_RNDU);
+  mpfr_clears (a, b, yy, t, u, (mpfr_ptr) 0);
+}
+
+/* return the largest binary32 number <= t (or 2^-149) */
+static float
+round_down (double t)
+{
+  float r = t;
+  if (r > t)
+    r = nextafterf (r, 0);
+  return (r < 0x1p-149f) ? 0x1p-149f : r;
+}
+
+/* return the smallest binary32 number >= t (or the largest one) */
+static float
+round_up (double t)
+{
+  if (t > 0x1.fffffep127)
+    return 0x1.fffffep127f;
+  float r = t;
+  if (r < t)
+    r = nextafterf (r, INFINITY);
+  return r;
+}
+
+static int
+atan2pi_xrange (float y, float *xmin, float *xmax)
+{
+  if (!(y > 0))
+    return 0;
+  /* PI_DOWN is pi rounded down, minus one ulp, thus y*PI_DOWN and
+     y/PI_DOWN are below y*pi and above y/pi respectively, even after
+     rounding to nearest */
+  const double PI_DOWN = 0x1.921fb54442d17p+1;
+  int k = xneg ? 25 + target_m : 26 + target_m;
+  *xmin = xmin_set ? Xmin : round_down (ldexp (y * PI_DOWN, -k));
+  if (xmax_set)
+    *xmax = Xmax;
+  else
+    *xmax = round_up (xneg ? ldexp (y / PI_DOWN, 25 + target_m)
+                      : ldexp (y, 149));
+  return 1;
+}
+
+/* print the arguments in the order of atan2pif */
+static void
+atan2pi_print (float x, float y)
+{
+  printf ("%a,%a", y, x);
+}
+
+static const worst_function_t atan2pi_function = {
+  .eval = atan2pi_eval,
+  .deriv = atan2pi_deriv,
+  .deriv3 = atan2pi_deriv3,
+  .xrange = atan2pi_xrange,
+  .print = atan2pi_print,
+};
+
+int
+main (int argc, char *argv[])
+{
+  return worst_main (argc, argv, &atan2pi_function, 0x1p0f, 0x1p1f);
+}
@@ -26,18 +26,12 @@ SOFTWARE.
 
 #include <stdint.h>
 
+#include "exp2f_kernel.h"
+
 typedef union {float f; uint32_t u;} b32u32_u;
 typedef union {double f; uint64_t u;} b64u64_u;
 
 float cr_coshf(float x){
-  static const double c[] =
-    {0x1.62e42fefa398bp-5, 0x1.ebfbdff84555ap-11, 0x1.c6b08d4ad86d3p-17,
-     0x1.3b2ad1b1716a2p-23, 0x1.5d7472718ce9dp-30, 0x1.4a1d7f457ac56p-37};
-  static const double tb[] =
-    {0x1p+0, 0x1.0b5586cf9890fp+0, 0x1.172b83c7d517bp+0, 0x1.2387a6e756238p+0,
-     0x1.306fe0a31b715p+0, 0x1.3dea64c123422p+0, 0x1.4bfdad5362a27p+0, 0x1.5ab07dd485429p+0,
-     0x1.6a09e667f3bcdp+0, 0x1.7a11473eb0187p+0, 0x1.8ace5422aa0dbp+0, 0x1.9c49182a3f09p+0,
-     0x1.ae89f995ad3adp+0, 0x1.c199bdd85529cp+0, 0x1.d5818dcfba487p+0, 0x1.ea4afa2a490dap+0};
   static const struct {union{float arg; uint32_t uarg;}; float rh, rl;} st[] = {
     {{0x1.c12a5p-5}, 0x1.00628ap+0f, -0x1.fffffep-25}
   };
@@ -56,33 +50,10 @@ float cr_coshf(float x){
     return __builtin_fmaf(x, x, 1.0f);
   } else {
     if(__builtin_expect((ux&(~0u>>1)) == st[0].uarg, 0)) return st[0].rh + st[0].rl;
-    double a = iln2h*z, ia = __builtin_floor(a), hp = (a - ia) + iln2l*z, hm = 1 - hp;
-    long i = ia, jp = i&0xf, ep = i - jp, jm = ~i&0xf, em = ~i - jm;
-
-    ep >>= 4;
-    double sp = tb[jp];
-    b64u64_u spu = {.u = (ep + 0x3feul)<<52};
-    sp *= spu.f;
-    double hp2 = hp*hp;
-    double cp0 = c[0] + hp*c[1];
-    double cp2 = c[2] + hp*c[3];
-    double cp4 = c[4] + hp*c[5];
-    cp0 += hp2*(cp2 + hp2*cp4);
-    double wp = sp*hp;
-    double rp = sp + wp*cp0;
-
-    em >>= 4;
-    double sm = tb[jm];
-    b64u64_u smu = {.u = (em + 0x3feul)<<52};
-    sm *= smu.f;
-    double hm2 = hm*hm;
-    double cm0 = c[0] + hm*c[1];
-    double cm2 = c[2] + hm*c[3];
-    double cm4 = c[4] + hm*c[5];
-    cm0 += hm2*(cm2 + hm2*cm4);
-    double wm = sm*hm;
-    double rm = sm + wm*cm0;
-
+    /* e^x/2 = 2^((i+hp)/16-1) and e^-x/2 = 2^((~i+hm)/16-1), since ~i = -i-1 */
+    double hp, ia = cr_exp2f_reduce(z, iln2h, iln2l, &hp), hm = 1 - hp;
+    long i = ia;
+    double rp = cr_exp2f_kernel(i, hp, 0x3fe), rm = cr_exp2f_kernel(~i, hm, 0x3fe);
     return rp + rm;
   }
 }
@@ -33,7 +33,9 @@ SOFTWARE.
    For THRESHOLD <= i < PSIZE, P[i] approximates erfc(x) on the same range.
    The numbers in comment at the end of each line are the index i and
    the relative accuracy of the minimax polynomial generated by Sollya
-   (in terms of bits). */
+   (in terms of bits).
+   Each entry takes 72 bytes, thus a lookup always reads two cache lines:
+   aligning the table would not reduce that number. */
 #define PSIZE 96
 #define THRESHOLD 25
 static const double P[PSIZE][9] = {
@@ -255,3 +257,12 @@ cr_erfcf (float x)
     y = (x > 0) ? y : 2.0 - y;
   return y;
 }
+
+/* Hook of cr_math_prefetch(): read the polynomials, so that the next calls
+   do not miss in the caches. */
+void
+cr_erfcf_prefetch (void)
+{
+  for (unsigned i = 0; i < sizeof (P); i += 64)
+    (void) *((volatile const char *) P + i);
+}
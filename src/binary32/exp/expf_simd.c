@@ -0,0 +1,64 @@
+/* Vector variants of the correctly-rounded natural exponential function for binary32 value.
+
+Copyright (c) 2022 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+
+#include "exp2f_kernel.h"
+#include "simd.h"
+#include "simd_impl.h"
+
+typedef union {float f; uint32_t u;} b32u32_u;
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* cr_expf() without branch, for its vector variants (see simd_impl.h):
+   the special cases (|x| >= 2^8, which includes nan and +-inf, and
+   |x| < 2^-25) are computed along the generic path, their arguments being
+   replaced by 0 there so that no exception is raised, and chosen with
+   selects. */
+CR_SIMD_VARIANT float __cr_expf_simd(float x){
+  const double iln2h = 0x1.7154765p+0*16, iln2l = 0x1.5c17f0bbbe88p-31*16;
+  b32u32_u t = {.f = x};
+  uint32_t ux = t.u, ex = (ux>>23)&0xff, s = ux>>31;
+  uint32_t big = ex>127+7, tiny = ex<127-25;
+  b32u32_u tz = {.u = ux & (big - 1)}, tt = {.u = ux & -tiny};
+  double z = tz.f;
+  double h, ia = cr_exp2f_reduce(z, iln2h, iln2l, &h);
+  float r = cr_exp2f_kernel(ia, h, 0x3ff);
+  // overflow or underflow, with the rounding of the current mode
+  float q = cr_sel(s, 0x1.fffffep-126f, 0x1.fffffep127f);
+  r = cr_sel(big, q, 1.0f) * cr_sel(big, q, r);
+  r = cr_sel(tiny, 1.0f + tt.f, r);
+  float sp = cr_sel(ux<<9 != 0, x, cr_sel(s, 0.0f, __builtin_inff())); // nan, +-inf
+  return cr_sel(ex==0xff, sp, r);
+}
+
+CR_SIMD_ALIASES_F(expf)
+
+void cr_expf_array(float *y, const float *x, unsigned long n){
+#pragma omp simd
+  for(unsigned long i = 0; i < n; i++)
+    y[i] = __cr_expf_simd(x[i]);
+}
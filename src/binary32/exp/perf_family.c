@@ -0,0 +1,147 @@
+/* Performance of interleaved calls to the binary32 exponential family.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* This program calls expf, exp2f, exp10f, expm1f, exp2m1f, exp10m1f, sinhf,
+   coshf and powf in turn, as an application mixing them would do, and
+   between two rounds touches a buffer of --pollute kilobytes, standing for
+   the working set of the application.  It prints the average number of
+   cycles per call, measured around each round only.
+
+   "make perf_family" builds two binaries: perf_family, where all functions
+   share the table of exp2f_kernel.h, and perf_family_private, where each
+   function has its own copy (CORE_MATH_EXP2F_PRIVATE_TABLE).  Comparing
+
+     ./perf_family --pollute 30
+     ./perf_family_private --pollute 30
+
+   shows the effect of the reduced cache footprint: with a buffer close to
+   the L1d size, the private copies are evicted more often. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fenv.h>
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
+
+float cr_expf (float);
+float cr_exp2f (float);
+float cr_exp10f (float);
+float cr_expm1f (float);
+float cr_exp2m1f (float);
+float cr_exp10m1f (float);
+float cr_sinhf (float);
+float cr_coshf (float);
+float cr_powf (float, float);
+
+int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
+
+#define NFUN 9
+
+static volatile float sink;
+static volatile unsigned char *buf;
+
+/* touch n bytes of buf, one cache line at a time */
+static void
+pollute (size_t n)
+{
+  for (size_t i = 0; i < n; i += 64)
+    buf[i]++;
+}
+
+int
+main (int argc, char *argv[])
+{
+  int count = 100000, rnd = 0;
+  size_t kb = 0;
+
+  while (argc >= 2)
+    {
+      if (strcmp (argv[1], "--rndn") == 0)
+        rnd = 0;
+      else if (strcmp (argv[1], "--rndz") == 0)
+        rnd = 1;
+      else if (strcmp (argv[1], "--rndu") == 0)
+        rnd = 2;
+      else if (strcmp (argv[1], "--rndd") == 0)
+        rnd = 3;
+      else if (strcmp (argv[1], "--count") == 0 && argc >= 3)
+        {
+          count = atoi (argv[2]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--pollute") == 0 && argc >= 3)
+        {
+          kb = atoi (argv[2]);
+          argc --;
+          argv ++;
+        }
+      else
+        {
+          fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+          exit (1);
+        }
+      argc --;
+      argv ++;
+    }
+
+  buf = calloc (kb + 1, 1024);
+  float *x = malloc (count * sizeof (float));
+  if (buf == NULL || x == NULL)
+    {
+      perror ("malloc");
+      exit (3);
+    }
+  /* |x| < 8, where all functions go through the shared kernel */
+  for (int i = 0; i < count; i++)
+    x[i] = ((float) rand () / (float) RAND_MAX - 0.5f) * 16.0f;
+
+  fesetround (rnd1[rnd]);
+  uint64_t cycles = 0;
+  for (int i = 0; i < count; i++)
+    {
+      float t = x[i];
+      pollute (kb * 1024);
+      uint64_t t0 = __rdtsc ();
+      sink = cr_expf (t);
+      sink = cr_exp2f (t);
+      sink = cr_exp10f (t);
+      sink = cr_expm1f (t);
+      sink = cr_exp2m1f (t);
+      sink = cr_exp10m1f (t);
+      sink = cr_sinhf (t);
+      sink = cr_coshf (t);
+      sink = cr_powf (1.0f + 0x1p-4f * t, t);
+      cycles += __rdtsc () - t0;
+    }
+  fesetround (FE_TONEAREST);
+
+  printf ("%.3f\n", (double) cycles / ((double) count * NFUN));
+  return 0;
+}
@@ -26,18 +26,12 @@ SOFTWARE.
 
 #include <stdint.h>
 
+#include "exp2f_kernel.h"
+
 typedef union {float f; uint32_t u;} b32u32_u;
 typedef union {double f; uint64_t u;} b64u64_u;
 
 float cr_exp2f(float x){
-  static const double c[] =
-    {0x1.62e42fefa398bp-5, 0x1.ebfbdff84555ap-11, 0x1.c6b08d4ad86d3p-17,
-     0x1.3b2ad1b1716a2p-23, 0x1.5d7472718ce9dp-30, 0x1.4a1d7f457ac56p-37};
-  static const double tb[] =
-    {0x1p+0, 0x1.0b5586cf9890fp+0, 0x1.172b83c7d517bp+0, 0x1.2387a6e756238p+0,
-     0x1.306fe0a31b715p+0, 0x1.3dea64c123422p+0, 0x1.4bfdad5362a27p+0, 0x1.5ab07dd485429p+0,
-     0x1.6a09e667f3bcdp+0, 0x1.7a11473eb0187p+0, 0x1.8ace5422aa0dbp+0, 0x1.9c49182a3f09p+0,
-     0x1.ae89f995ad3adp+0, 0x1.c199bdd85529cp+0, 0x1.d5818dcfba487p+0, 0x1.ea4afa2a490dap+0};
   b32u32_u t = {.f = x};
   double z = x;
   uint32_t ux = t.u, ex = (ux>>23)&0xff;
@@ -62,18 +56,7 @@ float cr_exp2f(float x){
     if(__builtin_expect(t.u == st[1].uarg, 0)) return st[1].rh + st[1].rl;
     if(__builtin_expect(t.u == st[2].uarg, 0)) return st[2].rh + st[2].rl;
 
-    double a = z*16, ia = __builtin_floor(a), h = a - ia;
-    long i = ia, j = i&0xf, e = i - j;
-    e >>= 4;
-    double s = tb[j];
-    b64u64_u su = {.u = (e + 0x3fful)<<52};
-    s *= su.f;
-    double h2 = h*h;
-    double c0 = c[0] + h*c[1];
-    double c2 = c[2] + h*c[3];
-    double c4 = c[4] + h*c[5];
-    c0 += h2*(c2 + h2*c4);
-    double w = s*h;
-    return s + w*c0;
+    double h, ia = cr_exp2f_reduce2(z, &h);
+    return cr_exp2f_kernel(ia, h, 0x3ff);
   }
 }
@@ -30,17 +30,13 @@ SOFTWARE. */
 float
 ref_hypot (float x, float y)
 {
-  mpfr_t xm, ym, zm;
-  mpfr_init2 (xm, 24);
-  mpfr_init2 (ym, 24);
-  mpfr_init2 (zm, 24);
+  mpfr_ptr xm = ref_var (0, 24);
+  mpfr_ptr ym = ref_var (1, 24);
+  mpfr_ptr zm = ref_var (2, 24);
   mpfr_set_flt (xm, x, MPFR_RNDN);
   mpfr_set_flt (ym, y, MPFR_RNDN);
   int inex = mpfr_hypot (zm, xm, ym, rnd2[rnd]);
   mpfr_subnormalize (zm, inex, rnd2[rnd]);
   float ret = mpfr_get_flt (zm, MPFR_RNDN);
-  mpfr_clear (xm);
-  mpfr_clear (ym);
-  mpfr_clear (zm);
   return ret;
 }
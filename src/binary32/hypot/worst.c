@@ -0,0 +1,125 @@
+/* Compute worst cases of hypotf.
+
+Copyright (c) 2022 Paul Zimmermann, Inria.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Example:
+
+./worst -m 44 -d 2
+
+looks for the inputs (x,y) of hypot(x,y) with at least 44 identical bits
+after the round bit, for 1 <= y < 2 (the default, see -ymin and -ymax) and
+0 < x <= y.  Since hypot(2^k*x,2^k*y) = 2^k*hypot(x,y), these are all the
+worst cases, except those where 2^k*x or 2^k*y would be subnormal or
+overflow; and since hypot is even in x and y, and symmetric, only
+0 < x <= y is considered.
+
+For x small, hypot(x,y) = y + t with 0 < t < x^2/(2y), which has at least m
+identical bits after the round bit if t < 2^-(m+1)*ulp(y), in particular for
+all x < sqrt(2^-m*ulp(y)*y): such inputs are not interesting, thus we start
+there unless -xmin is given.  This is 35 binades of x for each y with m = 44.
+The exact cases (see triples.c) are only counted.
+
+To compile: make worst CFLAGS="-O3 -march=native"
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include <mpfr.h>
+#include "worst_engine.h"
+
+static int
+hypot_eval (mpfr_t z, mpfr_t x, float y, mpfr_rnd_t rnd)
+{
+  mpfr_t yy;
+  mpfr_init2 (yy, 24);
+  mpfr_set_flt (yy, y, MPFR_RNDN);
+  int inex = mpfr_hypot (z, x, yy, rnd);
+  mpfr_clear (yy);
+  return inex;
+}
+
+/* the derivatives of f(x) = hypot(x,y) are f'(x) = x/f(x) and
+   f''(x) = y^2/f(x)^3 */
+static void
+hypot_deriv (mpfr_t d1, mpfr_t d2, mpfr_t x, mpfr_t fx, float y)
+{
+  mpfr_t t;
+  mpfr_init2 (t, 48);
+  mpfr_div (d1, x, fx, MPFR_RNDN); /* 2 roundings, with fx */
+  mpfr_sqr (d2, fx, MPFR_RNDN);
+  mpfr_mul (d2, d2, fx, MPFR_RNDN); /* 5 roundings */
+  mpfr_set_flt (t, y, MPFR_RNDN);
+  mpfr_sqr (t, t, MPFR_RNDN);      /* exact */
+  mpfr_div (d2, t, d2, MPFR_RNDN); /* 6 roundings */
+  mpfr_clear (t);
+}
+
+/* f'''(x) = -3xy^2/f(x)^5, thus for a <= |x| <= b,
+   |f'''(x)| <= 3b*y^2/hypot(a,y)^5 */
+static void
+hypot_deriv3 (mpfr_t d3, mpfr_t x0, mpfr_t x1, float y)
+{
+  mpfr_t a, b, yy, t;
+  mpfr_inits2 (mpfr_get_prec (d3), a, b, yy, t, (mpfr_ptr) 0);
+  mpfr_abs (a, x0, MPFR_RNDN);
+  mpfr_abs (b, x1, MPFR_RNDN);
+  if (mpfr_cmp (a, b) > 0)
+    mpfr_swap (a, b);
+  mpfr_set_flt (yy, y, MPFR_RNDN);
+  mpfr_hypot (a, a, yy, MPFR_RNDD);
+  mpfr_pow_ui (a, a, 5, MPFR_RNDD);
+  mpfr_sqr (t, yy, MPFR_RNDU);
+  mpfr_mul (t, t, b, MPFR_RNDU);
+  mpfr_mul_ui (t, t, 3, MPFR_RNDU);
+  mpfr_div (d3, t, a, MPFR_RNDU);
+  mpfr_clears (a, b, yy, t, (mpfr_ptr) 0);
+}
+
+static int
+hypot_xrange (float y, float *xmin, float *xmax)
+{
+  if (!(y > 0))
+    return 0;
+  /* the factor 1-2^-50 accounts for the roundings */
+  double t = sqrt (ldexp (y, ilogbf (y) - 23 - target_m)) * (1 - 0x1p-50);
+  float r = t;
+  if (r > t)
+    r = nextafterf (r, 0);
+  *xmin = xmin_set ? Xmin : (r < 0x1p-149f) ? 0x1p-149f : r;
+  *xmax = xmax_set ? Xmax : y;
+  return 1;
+}
+
+static const worst_function_t hypot_function = {
+  .eval = hypot_eval,
+  .deriv = hypot_deriv,
+  .deriv3 = hypot_deriv3,
+  .xrange = hypot_xrange,
+};
+
+int
+main (int argc, char *argv[])
+{
+  return worst_main (argc, argv, &hypot_function, 0x1p0f, 0x1p1f);
+}
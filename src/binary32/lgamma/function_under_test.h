@@ -0,0 +1,18 @@
+#define cr_function_under_test cr_lgammaf
+#define ref_function_under_test ref_lgamma
+
+void doit (uint32_t n);
+static inline uint32_t asuint (float f);
+
+static inline int doloop (void)
+{
+  /* lgamma is defined everywhere, with poles (+Inf) at 0 and at the negative
+     integers */
+  uint32_t nmin = asuint (0x0p0f), nmax = asuint (0x1.fffffep127f);
+  FOR_EACH_INPUT (n, nmin, nmax)
+  {
+    doit (n);
+    doit (n | 0x80000000);
+  }
+  return report ();
+}
@@ -0,0 +1,744 @@
+/* Correctly-rounded logarithm of the absolute value of the gamma function
+   for binary32 value.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+#include <errno.h>
+
+typedef union {float f; uint32_t u;} b32u32_u;
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* __builtin_roundeven was introduced in gcc 10 */
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 10)
+#define ROUNDEVEN __builtin_roundeven
+#else
+#include <math.h>
+#define ROUNDEVEN roundeven_fallback
+/* round x to nearest integer, breaking ties to even */
+static double
+roundeven_fallback (double x)
+{
+  double y = round (x); /* nearest, away from 0 */
+  if (fabs (y - x) == 0.5)
+  {
+    /* if y is odd, we should return y-1 if x>0, and y+1 if x<0 */
+    union { double f; uint64_t n; } u, v;
+    u.f = y;
+    v.f = (x > 0) ? y - 1.0 : y + 1.0;
+    if (__builtin_ctz (v.n) > __builtin_ctz (u.n))
+      y = v.f;
+  }
+  return y;
+}
+#endif
+
+/* The algorithm depends on the range of x:
+   - for |x| < 2^-29, lgamma(x) = -log|x| - gamma*x + O(x^2);
+   - for x >= 12, we use Stirling's asymptotic series;
+   - for x < -12, the reflection formula
+     lgamma(x) = log(pi) - log|sin(pi*x)| - lgamma(1-x);
+   - around the zeros 1 and 2 of lgamma (|x-1| <= 1/8 or |x-2| <= 1/8),
+     we use dedicated polynomials to get a small relative error;
+   - elsewhere, lgamma(x) = log|Gamma(x)| where Gamma(x) is computed as in
+     tgammaf.c, from a polynomial approximation of 1/Gamma on [1,2] and the
+     recurrence Gamma(x+1) = x*Gamma(x).
+   The fast path computes in double precision with an absolute error bound
+   err, and the accurate path uses double-double arithmetic, with a
+   relative error of about 2^-90 or less. */
+
+/* For 0 <= i < 128, R[i] is a 9-bit approximation of 1/(1+(i+1/2)/128),
+   and L[i] a double-double approximation of -log(R[i]). For 1 <= m < 2
+   and i = floor(128*(m-1)), we have |R[i]*m - 1| < 2^-7.77. */
+static const double R[] = {
+    0x1.fep-1, 0x1.fap-1, 0x1.f6p-1, 0x1.f2p-1, 0x1.efp-1, 0x1.ebp-1,
+    0x1.e7p-1, 0x1.e4p-1, 0x1.ep-1, 0x1.ddp-1, 0x1.d9p-1, 0x1.d6p-1, 0x1.d2p-1,
+    0x1.cfp-1, 0x1.ccp-1, 0x1.c9p-1, 0x1.c6p-1, 0x1.c2p-1, 0x1.bfp-1,
+    0x1.bcp-1, 0x1.b9p-1, 0x1.b6p-1, 0x1.b3p-1, 0x1.b1p-1, 0x1.aep-1,
+    0x1.abp-1, 0x1.a8p-1, 0x1.a5p-1, 0x1.a3p-1, 0x1.ap-1, 0x1.9dp-1, 0x1.9bp-1,
+    0x1.98p-1, 0x1.96p-1, 0x1.93p-1, 0x1.91p-1, 0x1.8ep-1, 0x1.8cp-1,
+    0x1.8ap-1, 0x1.87p-1, 0x1.85p-1, 0x1.83p-1, 0x1.8p-1, 0x1.7ep-1, 0x1.7cp-1,
+    0x1.7ap-1, 0x1.78p-1, 0x1.75p-1, 0x1.73p-1, 0x1.71p-1, 0x1.6fp-1,
+    0x1.6dp-1, 0x1.6bp-1, 0x1.69p-1, 0x1.67p-1, 0x1.65p-1, 0x1.63p-1,
+    0x1.61p-1, 0x1.5fp-1, 0x1.5ep-1, 0x1.5cp-1, 0x1.5ap-1, 0x1.58p-1,
+    0x1.56p-1, 0x1.54p-1, 0x1.53p-1, 0x1.51p-1, 0x1.4fp-1, 0x1.4ep-1,
+    0x1.4cp-1, 0x1.4ap-1, 0x1.49p-1, 0x1.47p-1, 0x1.45p-1, 0x1.44p-1,
+    0x1.42p-1, 0x1.4p-1, 0x1.3fp-1, 0x1.3dp-1, 0x1.3cp-1, 0x1.3ap-1, 0x1.39p-1,
+    0x1.37p-1, 0x1.36p-1, 0x1.34p-1, 0x1.33p-1, 0x1.32p-1, 0x1.3p-1, 0x1.2fp-1,
+    0x1.2dp-1, 0x1.2cp-1, 0x1.2bp-1, 0x1.29p-1, 0x1.28p-1, 0x1.27p-1,
+    0x1.25p-1, 0x1.24p-1, 0x1.23p-1, 0x1.21p-1, 0x1.2p-1, 0x1.1fp-1, 0x1.1ep-1,
+    0x1.1cp-1, 0x1.1bp-1, 0x1.1ap-1, 0x1.19p-1, 0x1.17p-1, 0x1.16p-1,
+    0x1.15p-1, 0x1.14p-1, 0x1.13p-1, 0x1.12p-1, 0x1.1p-1, 0x1.0fp-1, 0x1.0ep-1,
+    0x1.0dp-1, 0x1.0cp-1, 0x1.0bp-1, 0x1.0ap-1, 0x1.09p-1, 0x1.08p-1,
+    0x1.07p-1, 0x1.06p-1, 0x1.05p-1, 0x1.04p-1, 0x1.03p-1, 0x1.02p-1,
+    0x1.01p-1
+};
+
+static const double L[][2] = {
+    {0x1.0080559588b35p-8, 0x1.f96638cf63677p-62},
+    {0x1.82448a388a2aap-7, 0x1.04b16137f09ap-62},
+    {0x1.432a925980cc1p-6, -0x1.8cdaf39004192p-60},
+    {0x1.c63d2ec14aaf2p-6, -0x1.ce030a686bd86p-60},
+    {0x1.149e3e4005a8dp-5, -0x1.53482d1f9d7d7p-61},
+    {0x1.5715c4c03ceefp-5, -0x1.bbf88ec501b56p-61},
+    {0x1.9a187b573de7cp-5, -0x1.727626c86b3abp-59},
+    {0x1.ccb73cdddb2ccp-5, -0x1.e48fb0500efd4p-59},
+    {0x1.08598b59e3a07p-4, -0x1.dd7009902bf32p-58},
+    {0x1.2207b5c78549ep-4, -0x1.cc0fbce104eaap-58},
+    {0x1.4485e03dbdfadp-4, 0x1.1ba349aadbc6ep-58},
+    {0x1.5e95a4d9791cbp-4, 0x1.f38745c5c450ap-58},
+    {0x1.8197e2f40e3fp-4, 0x1.b9f2dffbeed43p-60},
+    {0x1.9c0c32d4d2548p-4, 0x1.fb0be3ccc1532p-59},
+    {0x1.b6ac88dad5b1cp-4, -0x1.0057eed1ca59fp-59},
+    {0x1.d179788219364p-4, 0x1.9daf7df76ad2ap-59},
+    {0x1.ec739830a112p-4, -0x1.a2bf991780d3fp-59},
+    {0x1.08598b59e3a07p-3, -0x1.dd7009902bf32p-57},
+    {0x1.160c8024b27b1p-3, -0x1.2d56ff61c2bfbp-57},
+    {0x1.23d712a49c202p-3, -0x1.6e38161051d69p-57},
+    {0x1.31b994d3a4f85p-3, -0x1.c4716bdfc0cc9p-58},
+    {0x1.3fb45a59928ccp-3, -0x1.d87e6a354d056p-57},
+    {0x1.4dc7b897bc1c8p-3, -0x1.927d47803c5f4p-57},
+    {0x1.5737cc9018cddp-3, 0x1.4f4d710fec38ep-57},
+    {0x1.6574ebe8c133ap-3, -0x1.d34f0f4621bedp-60},
+    {0x1.73cb9074fd14dp-3, -0x1.521a000b4cf01p-57},
+    {0x1.823c16551a3c2p-3, -0x1.1232ce70be781p-57},
+    {0x1.90c6db9fcbcd9p-3, 0x1.054473941ad99p-57},
+    {0x1.9a8778debaa38p-3, 0x1.f47dfd871f87fp-57},
+    {0x1.a93ed3c8ad9e3p-3, 0x1.bcafa9de97203p-57},
+    {0x1.b811730b823d2p-3, 0x1.a0ee735d9f0ecp-60},
+    {0x1.c2028ab17f9b4p-3, 0x1.f11aa3853a5f1p-57},
+    {0x1.d1037f2655e7bp-3, 0x1.60629242471a2p-57},
+    {0x1.db13db0d4894p-3, 0x1.aa11d49f96cb9p-58},
+    {0x1.ea4449f04aaf5p-3, -0x1.d33919ab94074p-57},
+    {0x1.f474b134df229p-3, -0x1.27c77ded76aadp-58},
+    {0x1.01eae5626c691p-2, -0x1.18290bd2932e2p-59},
+    {0x1.07138604d5862p-2, 0x1.cdb16ed4e9138p-56},
+    {0x1.0c42d676162e3p-2, 0x1.162c79d5d11eep-58},
+    {0x1.14167ef367783p-2, 0x1.e0936abd4fa6ep-62},
+    {0x1.1956d3b9bc2fap-2, 0x1.7b9d68d50a15dp-56},
+    {0x1.1e9e1678899f4p-2, 0x1.512c3749a1e4ep-56},
+    {0x1.269621134db92p-2, 0x1.e0efadd9db02bp-56},
+    {0x1.2bef07cdc9354p-2, -0x1.82dad7fd86088p-56},
+    {0x1.314f1e1d35ce4p-2, -0x1.3d69909e5c3dcp-56},
+    {0x1.36b6776be1117p-2, -0x1.324f0e883858ep-58},
+    {0x1.3c25277333184p-2, -0x1.2ad27e50a8ec6p-56},
+    {0x1.44591e0539f49p-2, -0x1.2b125247b0fa5p-56},
+    {0x1.49da7f3bcc41fp-2, -0x1.9964a168ccacap-57},
+    {0x1.4f637ebba981p-2, -0x1.58cb3124b9245p-56},
+    {0x1.54f431b7be1a9p-2, -0x1.aacfdbbdab914p-56},
+    {0x1.5a8cadbbedfa1p-2, -0x1.e6c2bdfb3e037p-58},
+    {0x1.602d08af091ecp-2, -0x1.6e8920c09b73fp-58},
+    {0x1.65d558d4ce00bp-2, -0x1.7605a4748480ap-56},
+    {0x1.6b85b4cffa3fdp-2, -0x1.8af2c8dafcb08p-57},
+    {0x1.713e33a46a17cp-2, -0x1.9367a05ae38d3p-56},
+    {0x1.76feecb947175p-2, -0x1.118d9eb4ea362p-56},
+    {0x1.7cc7f7db46a0ep-2, -0x1.8438023cdc3d3p-56},
+    {0x1.82996d3ef8bcbp-2, -0x1.2aa30536bb6bep-56},
+    {0x1.85855776dcbfbp-2, -0x1.486666443b153p-56},
+    {0x1.8b639a88b2df5p-2, -0x1.70f2f38238303p-56},
+    {0x1.914a8635bf68ap-2, -0x1.ad4bb98c1f2c5p-56},
+    {0x1.973a3431356aep-2, -0x1.89d2816cf838fp-57},
+    {0x1.9d32bea15ed3bp-2, 0x1.87bcbcfd3e187p-59},
+    {0x1.a33440224fa79p-2, -0x1.ba8062860ae23p-57},
+    {0x1.a63865fabd0ecp-2, -0x1.1470455746974p-57},
+    {0x1.ac478d020506fp-2, 0x1.d19914a95df12p-61},
+    {0x1.b25fefb60cb2ep-2, 0x1.831dd125d6faap-59},
+    {0x1.b56fa04462909p-2, 0x1.494b610665378p-56},
+    {0x1.bb9611b80e2fbp-2, 0x1.6fd02999b21e1p-59},
+    {0x1.c1c60693fa39ep-2, -0x1.bfc00b8f3feaap-56},
+    {0x1.c4e19b84723c2p-2, -0x1.6e6b67ccb006ap-56},
+    {0x1.cb200d2ceb643p-2, -0x1.89974d2ba308ap-58},
+    {0x1.d1684d49f46aep-2, 0x1.d98a582717953p-56},
+    {0x1.d490246defa6bp-2, 0x1.d7f4d3b3d406bp-56},
+    {0x1.dae75484c9616p-2, -0x1.0b5837185a661p-56},
+    {0x1.e148a1a2726cep-2, -0x1.ac81cc8a4dfb8p-56},
+    {0x1.e47d1d32e677ep-2, 0x1.96e555e2df7d3p-58},
+    {0x1.eaedd2eac990cp-2, 0x1.9d6bc9a591edep-57},
+    {0x1.ee2a156b413e5p-2, -0x1.74b71fb5e57e3p-62},
+    {0x1.f4aa7ee03192dp-2, -0x1.0d487f5aba5e5p-57},
+    {0x1.f7eeae6b5761dp-2, -0x1.ffca6a88d3d8ep-57},
+    {0x1.fe7f18eb03d3ep-2, 0x1.5c6299030cfddp-58},
+    {0x1.00e5ae5b207abp-1, 0x1.1713a36138e19p-57},
+    {0x1.04360be7603adp-1, -0x1.17f9e54e78104p-57},
+    {0x1.05e04c1aa2c06p-1, 0x1.862e53e39376p-60},
+    {0x1.078bf0533c568p-1, 0x1.2241edf5fd1f7p-57},
+    {0x1.0ae76e2d054fap-1, 0x1.0d710fcfc4e0dp-55},
+    {0x1.0c974c89431cep-1, -0x1.fac191a23c9cdp-56},
+    {0x1.0ffb54213a476p-1, -0x1.08822a328336cp-56},
+    {0x1.11af823c75aa8p-1, -0x1.91eee7772c7c2p-55},
+    {0x1.1365252bf0865p-1, -0x1.e96778ad07bbbp-56},
+    {0x1.16d4d38c119fap-1, 0x1.d7508e57620b2p-55},
+    {0x1.188ee40f23ca6p-1, 0x1.89df1568ca0bp-55},
+    {0x1.1a4a738b7a33cp-1, 0x1.58930213c987dp-55},
+    {0x1.1dc619de06944p-1, 0x1.b50bb38388177p-57},
+    {0x1.1f8635fc61659p-1, -0x1.2164ff40e9817p-56},
+    {0x1.2147dba47a394p-1, -0x1.5433d723a4c74p-55},
+    {0x1.24cfce6f80d9ap-1, 0x1.a5268d21148c6p-55},
+    {0x1.269621134db92p-1, 0x1.e0efadd9db02bp-55},
+    {0x1.285e0842ca384p-1, -0x1.d93cc9506f2p-55},
+    {0x1.2a2786d0ec107p-1, -0x1.6a0c343be95dcp-56},
+    {0x1.2dbf557b0df43p-1, -0x1.b941ee770436bp-56},
+    {0x1.2f8dab636337ap-1, -0x1.9811700a1baf8p-55},
+    {0x1.315da4434068bp-1, 0x1.6c3a5f12642c9p-57},
+    {0x1.332f4314ad796p-1, -0x1.6c3d4e8a817bap-55},
+    {0x1.36d77e9d34fd7p-1, -0x1.030a8308afc73p-55},
+    {0x1.38ae2171976e7p-1, 0x1.21512aa596ea3p-55},
+    {0x1.3a86767257111p-1, 0x1.700f448ce4d66p-56},
+    {0x1.3c6080c36bfb5p-1, 0x1.1930603d87b6ep-56},
+    {0x1.3e3c43918f76cp-1, 0x1.59673d064b8bap-55},
+    {0x1.4019c2125ca93p-1, 0x1.86cf0f38b461ap-57},
+    {0x1.43d9ff2f923c5p-1, -0x1.84f481051f71ap-56},
+    {0x1.45bcc464c893ap-1, 0x1.45b00234d80aap-57},
+    {0x1.47a1527e8a2d3p-1, 0x1.2541aca7d5844p-55},
+    {0x1.4987ace0dabbp-1, 0x1.f68ae35979f6p-55},
+    {0x1.4b6fd6f970c1fp-1, 0x1.c457b531506f6p-55},
+    {0x1.4d59d43fdaba2p-1, -0x1.34d6c7eb974a5p-57},
+    {0x1.4f45a835a4e19p-1, 0x1.d749362382a77p-56},
+    {0x1.513356667fc57p-1, 0x1.ca64cc3d52c87p-56},
+    {0x1.5322e26867857p-1, 0x1.988ba4aea614dp-56},
+    {0x1.55144fdbcbd62p-1, 0x1.d66a6522e0f04p-55},
+    {0x1.5707a26bb8c66p-1, 0x1.80bff3303dd48p-55},
+    {0x1.58fcddce004c4p-1, -0x1.c801a2d42e96cp-55},
+    {0x1.5af405c3649ep-1, -0x1.6714fbcd8135bp-55},
+    {0x1.5ced1e17c35c5p-1, 0x1.6812a0aac67dep-55},
+    {0x1.5ee82aa24192p-1, 0x1.1c066d235ee63p-56},
+    {0x1.60e52f45788e3p-1, 0x1.d4bcd02c7194cp-55}
+};
+
+/* Return an approximation of log(y) for y > 0 a normal double, with
+   absolute error bounded by 2^-51.9*|log(y)| + 2^-60. */
+static inline double
+log_fast (double y)
+{
+  b64u64_u u = {.f = y};
+  int e = (u.u >> 52) - 0x3ff, i = (u.u >> 45) & 127;
+  u.u = (u.u & 0xfffffffffffff) | 0x3ff0000000000000;
+  double z = __builtin_fma (R[i], u.f, -1.0); /* error < 2^-62 */
+  /* log(1+z) = z - z^2/2 + ... + z^7/7 + O(z^8), with |z^8/8| < 2^-65.1 */
+  static const double c[] = {-0x1p-1, 0x1.5555555555555p-2, -0x1p-2,
+                             0x1.999999999999ap-3, -0x1.5555555555555p-3,
+                             0x1.2492492492492p-3};
+  double z2 = z * z, z4 = z2 * z2;
+  double c0 = c[0] + z * c[1], c2 = c[2] + z * c[3], c4 = c[4] + z * c[5];
+  double p = z + z2 * (c0 + z2 * c2 + z4 * c4);
+  /* log2_h is an integer multiple of 2^-42, thus e*log2_h is exact */
+  const double log2_h = 0x1.62e42fefa38p-1, log2_l = 0x1.ef35793c7673p-45;
+  double ee = e;
+  return __builtin_fma (ee, log2_h, L[i][0]) + (p + __builtin_fma (ee, log2_l, L[i][1]));
+}
+
+/* Return f*(f+1)*...*(f+k-1), with 4 independent products to shorten the
+   dependency chain. All the additions are exact, and there are at most
+   k+3 rounding errors. */
+static inline double
+prod_fast (double f, int k)
+{
+  double q0 = 1.0, q1 = 1.0, q2 = 1.0, q3 = 1.0;
+  for (; k >= 4; k -= 4)
+  {
+    q0 *= f;
+    q1 *= f + 1.0;
+    q2 *= f + 2.0;
+    q3 *= f + 3.0;
+    f += 4.0;
+  }
+  for (; k > 0; k--)
+  {
+    q0 *= f;
+    f += 1.0;
+  }
+  return (q0 * q1) * (q2 * q3);
+}
+
+/* Return an approximation of Stirling's series
+   lgamma(x) - ((x-1/2)*log(x) - x + log(2*pi)/2) for x >= 12, with
+   relative error less than 2^-52 (the truncation error is less than
+   2^-58.9). */
+static inline double
+stirling_fast (double x)
+{
+  static const double c[] = {
+    0x1.5555555555555p-4, -0x1.6c16c16c16c17p-9, 0x1.a01a01a01a01ap-11,
+    -0x1.3813813813814p-11, 0x1.b951e2b18ff23p-11, -0x1.f6ab0d9993c7dp-10,
+    0x1.a41a41a41a41ap-8
+  };
+  double y = 1.0 / x, y2 = y * y, y4 = y2 * y2;
+  double c0 = c[0] + y2 * c[1], c2 = c[2] + y2 * c[3], c4 = c[4] + y2 * c[5];
+  return y * (c0 + y4 * (c2 + y4 * (c4 + y4 * c[6])));
+}
+
+/* Return an approximation of lgamma(x) for x >= 12 */
+static inline double
+lgamma_large_fast (double x)
+{
+  const double hl2pi = 0x1.d67f1c864beb5p-1; /* log(2*pi)/2 */
+  return __builtin_fma (x - 0.5, log_fast (x), -x) + (hl2pi + stirling_fast (x));
+}
+
+static inline double muldd(double xh, double xl, double ch, double cl, double *l){
+  double ahlh = ch*xl, alhh = cl*xh, ahhh = ch*xh, ahhl = __builtin_fma(ch, xh, -ahhh);
+  ahhl += alhh + ahlh;
+  ch = ahhh + ahhl;
+  *l = (ahhh - ch) + ahhl;
+  return ch;
+}
+
+static inline double mulddd(double xh, double xl, double ch, double *l){
+  double ahlh = ch*xl, ahhh = ch*xh, ahhl = __builtin_fma(ch, xh, -ahhh);
+  ahhl += ahlh;
+  ch = ahhh + ahhl;
+  *l = (ahhh - ch) + ahhl;
+  return ch;
+}
+
+/* Same as polydd() in powf.c, but with Knuth's 2Sum instead of Fast2Sum,
+   since here |x*(c[i+1] + ...)| can exceed |c[i]|. */
+static __attribute__((noinline)) double polydd(double xh, double xl, int n, const double c[][2], double *l){
+  int i = n-1;
+  double ch = c[i][0], cl = c[i][1];
+  while(--i>=0){
+    ch = muldd(xh,xl,ch,cl,&cl);
+    double th = ch + c[i][0], cp = th - ch, hp = th - cp;
+    double tl = (c[i][0] - cp) + (ch - hp);
+    ch = th;
+    cl += tl + c[i][1];
+  }
+  *l = cl;
+  return ch;
+}
+
+/* Return an approximation of (xh + xl) + (yh + yl), using Knuth's 2Sum for
+   the high parts, with error about 2^-104 relatively to the largest term. */
+static inline double
+adddd (double xh, double xl, double yh, double yl, double *l)
+{
+  double s = xh + yh, yp = s - xh, xp = s - yp;
+  *l = ((xh - xp) + (yh - yp)) + (xl + yl);
+  double h = s + *l;
+  *l = (s - h) + *l;
+  return h;
+}
+
+/* Return an approximation of (xh + xl)/(yh + yl), with relative error
+   about 2^-104. */
+static inline double
+divdd (double xh, double xl, double yh, double yl, double *l)
+{
+  double h = xh / yh;
+  double r = __builtin_fma (-h, yh, xh); /* exact */
+  r = __builtin_fma (-h, yl, r + xl);
+  *l = r / yh;
+  return h;
+}
+
+/* Return an approximation of log(h + l) for h > 0 a normal double and
+   |l| <= ulp(h), with absolute error about 2^-100 for the values we need.
+   We use the same reduction as in log_fast(), where z = R[i]*(h+l)/2^e - 1
+   is computed exactly as a double-double, and log(1+z) is evaluated with
+   a degree-13 Taylor expansion. */
+static double
+log_accurate (double h, double l, double *lo)
+{
+  static const double c[][2] = {
+    {0x1p+0, 0x0p+0}, {-0x1p-1, 0x0p+0},
+    {0x1.5555555555555p-2, 0x1.5555555555555p-56}, {-0x1p-2, 0x0p+0},
+    {0x1.999999999999ap-3, -0x1.999999999999ap-57},
+    {-0x1.5555555555555p-3, -0x1.5555555555555p-57},
+    {0x1.2492492492492p-3, 0x1.2492492492492p-57}, {-0x1p-3, 0x0p+0},
+    {0x1.c71c71c71c71cp-4, 0x1.c71c71c71c71cp-58},
+    {-0x1.999999999999ap-4, 0x1.999999999999ap-58},
+    {0x1.745d1745d1746p-4, -0x1.745d1745d1746p-59},
+    {-0x1.5555555555555p-4, -0x1.5555555555555p-58},
+    {0x1.3b13b13b13b14p-4, -0x1.3b13b13b13b14p-58}
+  };
+  static const double log2[] = {0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56};
+  b64u64_u u = {.f = h}, s;
+  int e = (u.u >> 52) - 0x3ff, i = (u.u >> 45) & 127;
+  u.u = (u.u & 0xfffffffffffff) | 0x3ff0000000000000;
+  s.u = (uint64_t) (0x3ff - e) << 52; /* 2^-e */
+  double ph = R[i] * u.f, pl = __builtin_fma (R[i], u.f, -ph);
+  double zh = ph - 1.0; /* exact by Sterbenz lemma */
+  double zl = pl + R[i] * (l * s.f);
+  ph = zh + zl;
+  zl = (zh - ph) + zl;
+  zh = ph;
+  /* log(1+z) = z*p(z) */
+  ph = polydd (zh, zl, 13, c, &pl);
+  ph = muldd (zh, zl, ph, pl, &pl);
+  double ee = e, eh, el;
+  eh = ee * log2[0];
+  el = __builtin_fma (ee, log2[0], -eh);
+  el = __builtin_fma (ee, log2[1], el);
+  eh = adddd (eh, el, L[i][0], L[i][1], &el);
+  return adddd (eh, el, ph, pl, lo);
+}
+
+/* Return an approximation of lgamma(x) for x >= 12, with relative error
+   about 2^-95 (the truncation error of Stirling's series is bounded by
+   2^-92.1, and lgamma(x) > 17.5). */
+static double
+lgamma_large_accurate (double x, double *l)
+{
+  static const double c[][2] = {
+    {0x1.5555555555555p-4, 0x1.5555555555555p-58},
+    {-0x1.6c16c16c16c17p-9, 0x1.f49f49f49f49fp-64},
+    {0x1.a01a01a01a01ap-11, 0x1.a01a01a01a01ap-71},
+    {-0x1.3813813813814p-11, 0x1.fb1fb1fb1fb2p-65},
+    {0x1.b951e2b18ff23p-11, 0x1.5c3a9ce01b952p-65},
+    {-0x1.f6ab0d9993c7dp-10, 0x1.f82553c999b0ep-64},
+    {0x1.a41a41a41a41ap-8, 0x1.069069069069p-62},
+    {-0x1.e4286cb0f5398p-6, 0x1.1efcdab896745p-61},
+    {0x1.6fe96381e068p-3, -0x1.79e2405a71f88p-61},
+    {-0x1.6476701181f3ap+0, 0x1.24246319da678p-56},
+    {0x1.ace44322ce006p+3, -0x1.62c2b1bbcdd32p-51},
+    {-0x1.39b2525cccc1bp+7, 0x1.52604768a30fcp-47},
+    {0x1.12234e81b4e82p+11, -0x1.2c5f92c5f92c6p-43},
+    {-0x1.1a198ae1c4ab8p+15, 0x1.4c012227b696ep-41},
+    {0x1.51a2089a6e11ap+19, 0x1.c219ee4fdc447p-36},
+    {-0x1.d1089b142d357p+23, -0x1.e2030b4d5de2p-31},
+    {0x1.6d29a0f6433b8p+28, -0x1.9dbcc48676f31p-26}
+  };
+  static const double hl2pi[] = {0x1.d67f1c864beb5p-1, -0x1.65b5a1b7ff5dfp-55};
+  double lh, ll, h, yh, yl, y2h, y2l;
+  /* (x - 1/2)*log(x) - x */
+  lh = log_accurate (x, 0.0, &ll);
+  h = mulddd (lh, ll, x, l);
+  h = adddd (h, *l, -0.5 * lh, -0.5 * ll, l);
+  h = adddd (h, *l, -x, 0.0, l);
+  h = adddd (h, *l, hl2pi[0], hl2pi[1], l);
+  /* add 1/x * sum(c[k]/x^(2k)) */
+  yh = 1.0 / x;
+  yl = __builtin_fma (-yh, x, 1.0) / x;
+  y2h = muldd (yh, yl, yh, yl, &y2l);
+  y2h = polydd (y2h, y2l, 17, c, &y2l);
+  y2h = muldd (yh, yl, y2h, y2l, &y2l);
+  return adddd (h, *l, y2h, y2l, l);
+}
+
+/* Return an approximation of Gamma(x) for -13 < x < 12, x not an integer,
+   with relative error about 2^-100. */
+static double
+gamma_accurate (double x, double *l)
+{
+  /* approximation of 1/Gamma(3/2+t) for |t| <= 1/2, with relative error
+     bounded by 2^-103.2 (the last coefficients only need double precision) */
+  static const double c[][2] = {
+    {0x1.20dd750429b6dp+0, 0x1.1ae3a914fed8p-56},
+    {-0x1.514d3d90584b3p-5, -0x1.f217f14a9604fp-59},
+    {-0x1.0da5a671c048ap-1, -0x1.c2fd1a6350eb5p-58},
+    {0x1.669be41a93895p-3, -0x1.8930f86196845p-57},
+    {0x1.a18540be32ca7p-5, 0x1.cd20ad68ab4bdp-59},
+    {-0x1.5955cc39724a3p-5, 0x1.c921520e93c98p-59},
+    {0x1.b16203e5e344dp-8, 0x1.a5e10d814d8e1p-62},
+    {0x1.15f7f060ff8c2p-9, 0x1.455edf4305d2cp-63},
+    {-0x1.232bd878ffabep-10, -0x1.cc94c1ee7f885p-64},
+    {0x1.3f845ff3a6edbp-13, -0x1.8c335d71c8ef3p-67},
+    {0x1.a963c6a36cac3p-16, 0x1.f356afb82c1f5p-72},
+    {-0x1.d24ca6f39ac58p-17, 0x1.06e551d751e3fp-71},
+    {0x1.216694b7d8eafp-19, 0x1.c321f6ddbdb3ap-73},
+    {0x1.f1b936cb20012p-25, 0x1.2d6ee7696e634p-79},
+    {-0x1.7ed587ef326ddp-24, -0x1.966e66494c9cfp-79},
+    {0x1.25d5da9efbe34p-26, -0x1.c96a3e285fc5ap-81},
+    {-0x1.00033deb57292p-30, 0x1.6651d774c7da9p-84},
+    {-0x1.26b8a316d08bep-32, 0x0p+0}, {0x1.480c1c3841a56p-34, 0x0p+0},
+    {-0x1.19ed23ba4140dp-37, 0x0p+0}, {-0x1.797ea4298a2f9p-44, 0x0p+0},
+    {0x1.7db76e15956fap-43, 0x0p+0}, {-0x1.f6490b9eec9acp-46, 0x0p+0},
+    {0x1.020cf43adf809p-49, 0x0p+0}, {0x1.428347c333581p-53, 0x0p+0}
+  };
+  double fl = __builtin_floor (x);
+  int m = (int) fl - 1; /* x = z + m with 1 <= z < 2 */
+  double z = x - m, ph, pl, qh = 1.0, ql = 0.0, h;
+  ph = polydd (z - 1.5, 0.0, 25, c, &pl);
+  double f = (m >= 0) ? z : x;
+  for (int k = (m >= 0) ? m : -m; k > 0; k--, f += 1.0)
+    qh = mulddd (qh, ql, f, &ql);
+  if (m >= 0)
+    h = divdd (qh, ql, ph, pl, l);
+  else
+  {
+    qh = muldd (qh, ql, ph, pl, &ql);
+    h = divdd (1.0, 0.0, qh, ql, l);
+  }
+  double s = h + *l;
+  *l = (h - s) + *l;
+  return s;
+}
+
+/* Round h + l to binary32, assuming |l| <= ulp(h)/2. We first round h + l
+   to odd on 53 bits, then convert to binary32: since 53 >= 24 + 2, this
+   double rounding is innocuous, for all rounding modes. */
+static inline float
+dd_to_float (double h, double l)
+{
+  b64u64_u u = {.f = h};
+  if (l != 0 && !(u.u & 1))
+    u.u += ((l > 0) == (h > 0)) ? 1 : -1;
+  return u.f;
+}
+
+static float __attribute__((noinline))
+cr_lgammaf_accurate (float x)
+{
+  /* Taylor expansions of lgamma(1+t) and lgamma(2+t) to order 8 */
+  static const double s1[][2] = {
+    {-0x1.2788cfc6fb619p-1, 0x1.6cb90701fbfabp-58},
+    {0x1.a51a6625307d3p-1, 0x1.1873d8912200cp-56},
+    {-0x1.9a4d55beab2d7p-2, 0x1.4c26d1b465993p-59},
+    {0x1.151322ac7d848p-2, 0x1.b5f91211196e5p-57},
+    {-0x1.a8b9c17aa6149p-3, -0x1.2e826a4fdae1ap-58},
+    {0x1.5b40cb100c306p-3, 0x1.4a79940f15696p-59},
+    {-0x1.2703a1dcea3aep-3, -0x1.6307fd0794ac4p-57},
+    {0x1.010b36af86397p-3, -0x1.741a635b224a6p-59}
+  };
+  static const double s2[][2] = {
+    {0x1.b0ee6072093cep-2, 0x1.6cb90701fbfabp-58},
+    {0x1.4a34cc4a60fa6p-2, 0x1.1873d8912200cp-56},
+    {-0x1.13e001a557607p-4, 0x1.fb68be2f8821fp-58},
+    {0x1.51322ac7d8483p-6, 0x1.afc89088cb729p-60},
+    {-0x1.e404fc218f5f2p-8, 0x1.e4a627cf1eb34p-62},
+    {0x1.7add6eadb6c3p-9, -0x1.5b7828c7fd7f4p-64},
+    {-0x1.38ac5c2bf8e08p-10, 0x1.8a4c1cfd9cec8p-65},
+    {0x1.0b36af86396e9p-11, -0x1.0698d6c892967p-65}
+  };
+  /* Taylor expansion of sin(pi*r)/r in r^2, to order r^30 */
+  static const double sp[][2] = {
+    {0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53},
+    {-0x1.4abbce625be53p+2, 0x1.05511c68476a8p-52},
+    {0x1.466bc6775aae2p+1, -0x1.6dc0cbddb0fc3p-54},
+    {-0x1.32d2cce62bd86p-1, 0x1.066847a026e69p-55},
+    {0x1.50783487ee782p-4, -0x1.1be14e6e8854ap-58},
+    {-0x1.e3074fde8871fp-8, -0x1.88ef203b0a336p-62},
+    {0x1.e8f434d018d63p-12, 0x1.94682b2571263p-67},
+    {-0x1.6fadb9f155744p-16, 0x1.bab97c50b4cdp-70},
+    {0x1.aaec32af93359p-21, 0x1.4fe55050e576ap-76},
+    {-0x1.8a404211f9547p-26, -0x1.6d424c0620248p-84},
+    {0x1.2877020d52cfp-31, -0x1.c9db31d99b9a3p-85},
+    {-0x1.7215f879e1ac9p-37, 0x1.a2cc59fc2e3e8p-91},
+    {0x1.859c594ba4573p-43, 0x1.46446588874ecp-98},
+    {-0x1.5e91aac4928dbp-49, 0x1.36e8311afce96p-103},
+    {0x1.10b5242e256ccp-55, -0x1.163d6ee411febp-112},
+    {-0x1.7271f9271ad31p-62, -0x1.548bf9784d77bp-119}
+  };
+  static const double euler[] = {0x1.2788cfc6fb619p-1, -0x1.6cb90701fbfabp-58};
+  static const double lnpi[] = {0x1.250d048e7a1bdp+0, 0x1.7abf2ad8d5088p-57};
+  double d = x, h, l, ah, al;
+  b32u32_u t = {.f = x};
+  uint32_t ax = t.u & 0x7fffffff;
+
+  if (ax < 0x31000000u) /* |x| < 2^-29 */
+  {
+    /* lgamma(x) = -log|x| - gamma*x + pi^2/12*x^2 + O(x^3) */
+    h = log_accurate (__builtin_fabs (d), 0.0, &l);
+    ah = euler[0] * d;
+    al = __builtin_fma (euler[0], d, -ah);
+    al = __builtin_fma (euler[1], d, al) - 0x1.a51a6625307d3p-1 * d * d;
+    h = adddd (-h, -l, -ah, -al, &l);
+  }
+  else if (d >= 12.0)
+    h = lgamma_large_accurate (d, &l);
+  else if (d < -12.0)
+  {
+    /* lgamma(x) = log(pi) - log|sin(pi*x)| - lgamma(1-x), where 1-x is
+       exact, and sin(pi*x) = +/-sin(pi*r) with |r| <= 1/2 */
+    double r = d - ROUNDEVEN (d), r2h, r2l;
+    r2h = r * r;
+    r2l = __builtin_fma (r, r, -r2h);
+    ah = polydd (r2h, r2l, 16, sp, &al);
+    ah = mulddd (ah, al, __builtin_fabs (r), &al);
+    ah = log_accurate (ah, al, &al);
+    h = lgamma_large_accurate (1.0 - d, &l);
+    h = adddd (h, l, ah, al, &l);
+    h = adddd (lnpi[0], lnpi[1], -h, -l, &l);
+  }
+  else if (__builtin_fabs (d - 1.0) < 0x1p-12)
+  {
+    h = polydd (d - 1.0, 0.0, 8, s1, &l);
+    h = mulddd (h, l, d - 1.0, &l);
+  }
+  else if (__builtin_fabs (d - 2.0) < 0x1p-12)
+  {
+    h = polydd (d - 2.0, 0.0, 8, s2, &l);
+    h = mulddd (h, l, d - 2.0, &l);
+  }
+  else
+  {
+    h = gamma_accurate (d, &l);
+    if (h < 0)
+    {
+      h = -h;
+      l = -l;
+    }
+    h = log_accurate (h, l, &l);
+  }
+  return dd_to_float (h, l);
+}
+
+float
+cr_lgammaf (float x)
+{
+  b32u32_u t = {.f = x};
+  uint32_t ax = t.u & 0x7fffffff;
+
+  if (__builtin_expect (ax >= 0x7f800000u, 0)) /* NaN or Inf */
+    return (ax > 0x7f800000u) ? x + x : __builtin_inff ();
+
+  double d = x, y, err;
+  if (__builtin_expect (ax < 0x31000000u, 0)) /* |x| < 2^-29 */
+  {
+    if (ax == 0)
+    {
+      errno = ERANGE;
+      return 1.0f / __builtin_fabsf (x); /* pole error */
+    }
+    /* lgamma(x) = -log|x| - gamma*x + O(x^2), with |lgamma(x)| > 20 */
+    y = -log_fast (__builtin_fabs (d)) - 0x1.2788cfc6fb619p-1 * d;
+    err = __builtin_fabs (y) * 0x1p-50;
+  }
+  else if (d >= 12.0)
+  {
+    /* The relative error of log_fast() is bounded by 2^-51.9 + 2^-61.8,
+       and we have x*log(x) < 1.68*lgamma(x) for x >= 12, with further
+       rounding errors bounded by 3 ulps. */
+    y = lgamma_large_fast (d);
+    err = __builtin_fabs (y) * 0x1p-49;
+  }
+  else if (d < -12.0)
+  {
+    double fl = __builtin_floor (d);
+    if (fl == d) /* negative integer: pole error */
+    {
+      errno = ERANGE;
+      return 1.0f / 0.0f;
+    }
+    /* 1-x is exact, and so is r = x - roundeven(x), with |r| <= 1/2 */
+    static const double c[] = {
+    0x1.921fb54442d18p+1, -0x1.4abbce625be39p+2, 0x1.466bc67759fcap+1,
+    -0x1.32d2cce5e6546p-1, 0x1.5078346aa719fp-4, -0x1.e307419cd9ba5p-8,
+    0x1.e8f020c9c7e5bp-12, -0x1.6f04b22f4ceeap-16, 0x1.8f8d070c38947p-21
+    };
+    double r = d - ROUNDEVEN (d), r2 = r * r, r4 = r2 * r2, r8 = r4 * r4;
+    double c0 = c[0] + r2 * c[1], c2 = c[2] + r2 * c[3];
+    double c4 = c[4] + r2 * c[5], c6 = c[6] + r2 * c[7];
+    double s = __builtin_fabs (r) * ((c0 + r4 * c2) + r8 * (c4 + r4 * (c6 + r4 * c[8])));
+    const double lnpi = 0x1.250d048e7a1bdp+0;
+    double g = lgamma_large_fast (1.0 - d);
+    y = (lnpi - log_fast (s)) - g;
+    /* the relative error on s is bounded by 2^-51, and |log(s)| < 14.3 */
+    err = g * 0x1p-49 + 0x1p-48;
+  }
+  else
+  {
+    double t1 = d - 1.0, t2 = d - 2.0;
+    if (__builtin_fabs (t1) <= 0.125)
+    {
+      if (t1 == 0)
+        return 0.0f;
+      /* lgamma(1+t) = t*p(t), with relative error bounded by 2^-56.6 */
+      static const double c[] = {
+    -0x1.2788cfc6fb619p-1, 0x1.a51a6625307d3p-1, -0x1.9a4d55beab19bp-2,
+    0x1.151322ac7d991p-2, -0x1.a8b9c17b2bc2cp-3, 0x1.5b40cb0feef07p-3,
+    -0x1.2703a12426e2fp-3, 0x1.010b3685fc9f8p-3, -0x1.c8076b824f43cp-4,
+    0x1.9a0261a13f818p-4, -0x1.74336173be87ap-4, 0x1.552d5bacc53aap-4,
+    -0x1.4ac243ed02e7bp-4, 0x1.31955b0aa17bbp-4
+      };
+      double u2 = t1 * t1, u4 = u2 * u2, u8 = u4 * u4;
+      double c0 = c[0] + t1 * c[1], c2 = c[2] + t1 * c[3];
+      double c4 = c[4] + t1 * c[5], c6 = c[6] + t1 * c[7];
+      double c8 = c[8] + t1 * c[9], c10 = c[10] + t1 * c[11];
+      double c12 = c[12] + t1 * c[13];
+      c0 += u2 * c2;
+      c4 += u2 * c6;
+      c8 += u2 * c10;
+      c0 += u4 * c4;
+      c8 += u4 * c12;
+      y = t1 * (c0 + u8 * c8);
+      err = __builtin_fabs (y) * 0x1p-49;
+    }
+    else if (__builtin_fabs (t2) <= 0.125)
+    {
+      if (t2 == 0)
+        return 0.0f;
+      /* lgamma(2+t) = t*p(t), with relative error bounded by 2^-56.2 */
+      static const double c[] = {
+    0x1.b0ee6072093cep-2, 0x1.4a34cc4a60fa6p-2, -0x1.13e001a55744fp-4,
+    0x1.51322ac7d9796p-6, -0x1.e404fc23d489p-8, 0x1.7add6ea1206e9p-9,
+    -0x1.38ac577d659c1p-10, 0x1.0b36cba3683c7p-11, -0x1.d404a3313b536p-13,
+    0x1.a0ef0530bb37fp-14, -0x1.78676913f0589p-15, 0x1.6e57ee070a774p-16
+      };
+      double u2 = t2 * t2, u4 = u2 * u2, u8 = u4 * u4;
+      double c0 = c[0] + t2 * c[1], c2 = c[2] + t2 * c[3];
+      double c4 = c[4] + t2 * c[5], c6 = c[6] + t2 * c[7];
+      double c8 = c[8] + t2 * c[9], c10 = c[10] + t2 * c[11];
+      c0 += u2 * c2;
+      c4 += u2 * c6;
+      c8 += u2 * c10;
+      c0 += u4 * c4;
+      y = t2 * (c0 + u8 * c8);
+      err = __builtin_fabs (y) * 0x1p-49;
+    }
+    else
+    {
+      double fl = __builtin_floor (d);
+      if (__builtin_expect (fl == d && d < 0, 0)) /* pole error */
+      {
+        errno = ERANGE;
+        return 1.0f / 0.0f;
+      }
+      /* approximation of 1/Gamma(3/2+t) for |t| <= 1/2, with relative
+         error bounded by 2^-54.5 */
+      static const double c[] = {
+    0x1.20dd750429b6dp+0, -0x1.514d3d9058425p-5, -0x1.0da5a671c0477p-1,
+    0x1.669be41a9240ap-3, 0x1.a18540be2fe56p-5, -0x1.5955cc389679ep-5,
+    0x1.b16203e759bfdp-8, 0x1.15f7ef5d34355p-9, -0x1.232bd8a32b7a3p-10,
+    0x1.3f84fdd5608c4p-13, 0x1.a963dd4f902ebp-16, -0x1.d2801f03b1bd2p-17,
+    0x1.216a1c993db8bp-19, 0x1.3d613392188cep-24, -0x1.817f741bdf988p-24
+      };
+      int m = (int) fl - 1; /* x = z + m with 1 <= z < 2 */
+      double z = d - m, u = z - 1.5, u2 = u * u, u4 = u2 * u2, u8 = u4 * u4;
+      double c0 = c[0] + u * c[1], c2 = c[2] + u * c[3], c4 = c[4] + u * c[5];
+      double c6 = c[6] + u * c[7], c8 = c[8] + u * c[9];
+      double c10 = c[10] + u * c[11], c12 = c[12] + u * c[13];
+      c0 += u2 * c2;
+      c4 += u2 * c6;
+      c8 += u2 * c10;
+      c12 += u2 * c[14];
+      c0 += u4 * c4;
+      c8 += u4 * c12;
+      double p = c0 + u8 * c8, g;
+      if (m >= 0)
+        g = prod_fast (z, m) / p;
+      else
+        g = 1.0 / (p * __builtin_fabs (prod_fast (d, -m)));
+      /* The relative error on g is bounded by (13+6)*2^-52 < 2^-47.7, which
+         gives an absolute error bounded by 2^-47.7 on log(g). */
+      y = log_fast (g);
+      err = 0x1p-47 + __builtin_fabs (y) * 0x1p-51;
+    }
+  }
+  float lo = y - err, hi = y + err;
+  if (__builtin_expect (lo == hi, 1))
+    return lo;
+  return cr_lgammaf_accurate (x);
+}
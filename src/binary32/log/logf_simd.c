@@ -0,0 +1,81 @@
+/* Vector variants of the correctly-rounded logarithm function for binary32 value.
+
+Copyright (c) 2022 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+
+#include "logf_kernel.h"
+#include "simd.h"
+#include "simd_impl.h"
+
+typedef union {float f; uint32_t u;} b32u32_u;
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* cr_logf() without branch, for its vector variants (see simd_impl.h):
+   the special cases (+-0, x < 0, +inf and nan) and the exceptions are
+   computed along the generic path and chosen with selects, and subnormals
+   are normalized by a multiplication by 2^23 (only done on subnormals, to
+   raise no spurious overflow). */
+CR_SIMD_VARIANT float __cr_logf_simd(float x) {
+  b32u32_u t = {.f = x};
+  uint32_t ux = t.u, sub = ux < 1u<<23;
+  b32u32_u ts = {.u = ux & -sub};
+  ts.f *= 0x1p23f; // exact
+  uint32_t uy = sub ? ts.u : ux;
+  uint64_t m = uy&(~0u>>9); m <<= 52-23;
+  int e = (uy>>23) - 0x7f - (sub ? 23 : 0);
+  int j;
+  double z = cr_logf_reduce(m, &e, &j); // z is exact
+  double c0 = cr_logf_poly(z);
+  const double ln2l = 0x1.7f7d1cf79abcap-20, ln2h = 0x1.62e4p-1;
+  double Lh = ln2h * e, Ll = ln2l * e;
+  b64u64_u res = {.f =  __builtin_fma(z, c0, Ll-cr_logf_lix(j)) + Lh};
+  float r = res.f;
+  // exceptions, only looked for when the last bits of res are zero
+  {
+    uint32_t hit = (res.u&0xfffffffl) == 0;
+    b64u64_u xd = {.u = m | 0x3fful<<52};
+    uint32_t rn = hit & (xd.f + 0x1p-54 == xd.f - 0x1p-54); // round-to-nearest mode
+    r = cr_sel(rn & (ux == 0x3c413d3a), -0x1.1c2b1ep+2f, r); // x = 0x1.827a74p-7
+    r = cr_sel(rn & (ux == 0x41178feb), 0x1.1fcbcep+1f, r);  // x = 0x1.2f1fd6p+3
+    r = cr_sel(rn & (ux == 0x4c5d65a5), 0x1.1e0696p+4f, r);  // x = 0x1.bacb4ap+25
+    r = cr_sel(rn & (ux == 0x65d890d3), 0x1.a9a3f2p+5f, r);  // x = 0x1.b121a6p+76
+    r = cr_sel(rn & (ux == 0x6f31a8ec), 0x1.08b512p+6f, r);  // x = 0x1.6351d8p+95
+    r = cr_sel(hit & (ux == 0x3f800000), 0.0f, r);          // x = 1
+  }
+  // +-0, x < 0, +inf and nan
+  uint32_t inf_or_nan = ((ux>>23)&0xff) == 0xff, nan = inf_or_nan & (ux<<9 != 0);
+  float sp = cr_sel((ux>>31) & !nan, __builtin_nanf("-"), x);
+  sp = cr_sel(ux<<1 == 0, -__builtin_inff(), sp);
+  return cr_sel((ux<<1 == 0) | (ux >= 0xffu<<23), sp, r);
+}
+
+CR_SIMD_ALIASES_F(logf)
+
+void cr_logf_array(float *y, const float *x, unsigned long n){
+#pragma omp simd
+  for(unsigned long i = 0; i < n; i++)
+    y[i] = __cr_logf_simd(x[i]);
+}
@@ -0,0 +1,109 @@
+/* Vector variants of the correctly-rounded radix-10 logarithm function for binary32 value.
+
+Copyright (c) 2022 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+
+#include "logf_kernel.h"
+#include "simd.h"
+#include "simd_impl.h"
+
+typedef union {float f; uint32_t u;} b32u32_u;
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* the exceptions of cr_log10f(), in a hash table: the entry of x is
+   st[(ux*0x257e8455)>>27], these indices being distinct (the unused entries
+   have x = +0, which is a special case anyway) */
+static const struct {union{float arg; uint32_t uarg;}; float rh, rl;} st[32] = {
+  {{0}, 0, 0},
+  {{0x1.7d784p+26f}, 8, 0},
+  {{0x1.0p+0f}, 0, 0},
+  {{0x1.4p+3f}, 1, 0},
+  {{0}, 0, 0},
+  {{0x1.312dp+23f}, 7, 0},
+  {{0}, 0, 0},
+  {{0}, 0, 0},
+  {{0x1.269f06p+31f}, 0x1.2c9314p+3f, -0x1.ae2a32p-50f},
+  {{0x1.9p+6f}, 2, 0},
+  {{0x1.ad74bcp+115f}, 0x1.16bebap+5f, 0x1.c148bep-53f},
+  {{0x1.388p+13f}, 4, 0},
+  {{0x1.84da26p-57f}, -0x1.0fa278p+4f, -0x1.015ca4p-51f},
+  {{0x1.fddcf4p-98f}, -0x1.d33a46p+4f, 0x1.fffffep-21f},
+  {{0x1.5cf1a6p-88f}, -0x1.a5b2aep+4f, -0x1.fffffep-21f},
+  {{0x1.dcd65p+29f}, 9, 0},
+  {{0}, 0, 0},
+  {{0x1.1727b8p-91f}, -0x1.b5b2aep+4f, -0x1.fffffep-21f},
+  {{0}, 0, 0},
+  {{0}, 0, 0},
+  {{0x1.f4p+9f}, 3, 0},
+  {{0}, 0, 0},
+  {{0}, 0, 0},
+  {{0}, 0, 0},
+  {{0x1.5d46acp-110f}, -0x1.07d3b4p+5f, 0x1.507944p-49f},
+  {{0}, 0, 0},
+  {{0}, 0, 0},
+  {{0x1.ac3030p+84f}, 0x1.98289cp+4f, 0x1.37abdep-48f},
+  {{0x1.2a05f2p+33f}, 10, 0},
+  {{0x1.86ap+16f}, 5, 0},
+  {{0}, 0, 0},
+  {{0x1.e848p+19f}, 6, 0},
+};
+
+/* cr_log10f() without branch, for its vector variants (see simd_impl.h):
+   the special cases and the exceptions are handled like in
+   __cr_logf_simd(). */
+CR_SIMD_VARIANT float __cr_log10f_simd(float x) {
+  b32u32_u t = {.f = x};
+  uint32_t ux = t.u, sub = ux < 1u<<23;
+  b32u32_u ts = {.u = ux & -sub};
+  ts.f *= 0x1p23f; // exact
+  uint32_t uy = sub ? ts.u : ux;
+  uint64_t m = uy&(~0u>>9); m <<= 52-23;
+  int e = (uy>>23) - 0x7f - (sub ? 23 : 0);
+  int j;
+  double z = cr_logf_reduce(m, &e, &j); // z is exact
+  double c0 = cr_logf_poly(z);
+  const double iln10 = 0x1.bcb7b1526e50ep-2;
+  b64u64_u res = {.f = (z*iln10)*c0 + (e*0x1.34413509f79ffp-2 - cr_logf_lix(j)*iln10)};
+  float r = res.f;
+  // exceptions, only looked for when res is close to a float: one lookup
+  // in the hash table, and rh + rl is computed at run time, in the current
+  // rounding mode
+  uint32_t k = (ux*0x257e8455u)>>27;
+  r = cr_sel((ux == st[k].uarg) & (((res.u+2)&0xfffffffl) <= 4), st[k].rh + st[k].rl, r);
+  // +-0, x < 0, +inf and nan
+  uint32_t inf_or_nan = ((ux>>23)&0xff) == 0xff, nan = inf_or_nan & (ux<<9 != 0);
+  float sp = cr_sel((ux>>31) & !nan, __builtin_nanf("-"), x);
+  sp = cr_sel(ux<<1 == 0, -__builtin_inff(), sp);
+  return cr_sel((ux<<1 == 0) | (ux >= 0xffu<<23), sp, r);
+}
+
+CR_SIMD_ALIASES_F(log10f)
+
+void cr_log10f_array(float *y, const float *x, unsigned long n){
+#pragma omp simd
+  for(unsigned long i = 0; i < n; i++)
+    y[i] = __cr_log10f_simd(x[i]);
+}
@@ -0,0 +1,83 @@
+/* Array version of the correctly-rounded biased argument natural logarithm function for binary32 value.
+
+Copyright (c) 2022 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+
+#include "logf_kernel.h"
+#include "simd.h"
+#include "simd_impl.h"
+
+typedef union {float f; uint32_t u;} b32u32_u;
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* the exceptions of cr_log1pf() with |x| >= 2^-5 */
+static const struct {union{float arg; uint32_t uarg;}; float rh, rl;} st[] = {
+  {{ 0x1.f317eep+36f },  0x1.99ef44p+4f , -0x1.b4324ep-50f},
+  {{ 0x1.ad3d10p+58f },  0x1.45c146p+5f ,  0x1.0afadap-48f},
+  {{ 0x1.b121a6p+76f },  0x1.a9a3f2p+5f , -0x1.fffffep-20f},
+  {{ 0x1.bcf94cp+77f },  0x1.af66c0p+5f ,  0x1.794878p-47f},
+  {{ 0x1.6351d8p+95f },  0x1.08b512p+6f , -0x1.fffffep-19f},
+  {{ 0x1.2fe614p+117f},  0x1.451436p+6f ,  0x1.2be426p-50f},
+};
+
+float cr_log1pf(float);
+
+/* The generic path of cr_log1pf (|x| >= 2^-5), together with the special
+   cases, without branch, for cr_log1pf_array(): *slow is set for the other
+   inputs. */
+static inline float log1pf_fast(float x, uint32_t *slow){
+  double z = x;
+  b32u32_u t = {.f = x};
+  uint32_t ux = t.u, ax = ux&(~0u>>1);
+  *slow = ax < 0x3d000000;
+  b64u64_u tt = {.f = z}; tt.f += 1;
+  uint64_t m = tt.u&(~0ul>>12);
+  int e = (tt.u>>52) - 0x3ff;
+  int j;
+  z = cr_logf_reduce(m, &e, &j);
+  double c0 = cr_logf_poly(z);
+  b64u64_u res = {.f = z*c0 + (e*0x1.62e42fefa39efp-1 - cr_logf_lix(j))};
+  float r = res.f;
+  // exceptions: rh + rl is computed at run time, in the current rounding mode
+  float rh = 0, rl = 0;
+  uint32_t hit = 0;
+  for(unsigned i = 0; i < sizeof(st)/sizeof(st[0]); i++){
+    uint32_t c = ux == st[i].uarg;
+    rh = cr_sel(c, st[i].rh, rh);
+    rl = cr_sel(c, st[i].rl, rl);
+    hit |= c;
+  }
+  r = cr_sel(hit, rh + rl, r);
+  // x <= -1, +inf and nan
+  float sp = cr_sel(ax > 0xffu<<23, x, cr_sel(ux>>31, __builtin_nanf("-"), __builtin_inff()));
+  sp = cr_sel(ux == 0x17fu<<23, -__builtin_inff(), sp);
+  r = cr_sel((ux >= 0x17fu<<23) | (ax >= 0xffu<<23), sp, r);
+  return r;
+}
+
+void cr_log1pf_array(float *y, const float *x, unsigned long n){
+  cr_array_f(y, x, n, log1pf_fast, cr_log1pf);
+}
@@ -8,9 +8,7 @@ static inline int doloop (void)
 {
   /* log2 is defined for x > 0 */
   uint32_t nmin = asuint (0x1p-149f), nmax = asuint (0x1.fffffep127f);
-#pragma omp parallel for schedule(dynamic,1024)
-  for (uint32_t n = nmin; n <= nmax; n++)
+  FOR_EACH_INPUT (n, nmin, nmax)
     doit (n);
-  printf ("all ok\n");
-  return 0;
+  return report ();
 }
@@ -0,0 +1,67 @@
+/* Vector variants of the correctly-rounded binary logarithm function for binary32 value.
+
+Copyright (c) 2022 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+
+#include "logf_kernel.h"
+#include "simd.h"
+#include "simd_impl.h"
+
+typedef union {float f; uint32_t u;} b32u32_u;
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* cr_log2f() without branch, for its vector variants (see simd_impl.h):
+   the special cases and the powers of 2 are handled like in
+   __cr_logf_simd(). */
+CR_SIMD_VARIANT float __cr_log2f_simd(float x) {
+  b32u32_u t = {.f = x};
+  uint32_t ux = t.u, sub = ux < 1u<<23;
+  b32u32_u ts = {.u = ux & -sub};
+  ts.f *= 0x1p23f; // exact
+  uint32_t uy = sub ? ts.u : ux;
+  uint64_t m = uy&(~0u>>9); m <<= 52-23;
+  int e = (uy>>23) - 0x7f - (sub ? 23 : 0);
+  float pe = e; // x = 2^e when m = 0
+  int j;
+  double z = cr_logf_reduce(m, &e, &j); // z is exact
+  double c0 = cr_logf_poly(z);
+  const double iln2 = 0x1.71547652b82fep+0;
+  float r = (z*iln2)*c0 + (e - cr_logf_lix(j)*iln2);
+  r = cr_sel(m == 0, pe, r);
+  // +-0, x < 0, +inf and nan
+  uint32_t inf_or_nan = ((ux>>23)&0xff) == 0xff, nan = inf_or_nan & (ux<<9 != 0);
+  float sp = cr_sel((ux>>31) & !nan, __builtin_nanf("-"), x);
+  sp = cr_sel(ux<<1 == 0, -__builtin_inff(), sp);
+  return cr_sel((ux<<1 == 0) | (ux >= 0xffu<<23), sp, r);
+}
+
+CR_SIMD_ALIASES_F(log2f)
+
+void cr_log2f_array(float *y, const float *x, unsigned long n){
+#pragma omp simd
+  for(unsigned long i = 0; i < n; i++)
+    y[i] = __cr_log2f_simd(x[i]);
+}
@@ -9,13 +9,11 @@ static inline int doloop (void)
 {
   /* log1p is defined for x > -1 */
   uint32_t nmin = asuint (0x1p-149), nmax = asuint (0x1.fffffep127f);
-#pragma omp parallel for schedule(dynamic,1024)
-  for (uint32_t n = nmin; n <= nmax; n++)
+  FOR_EACH_INPUT (n, nmin, nmax)
   {
     doit (n);
     if (asfloat (n | 0x80000000) > -1)
       doit (n | 0x80000000);
   }
-  printf ("all ok\n");
-  return 0;
+  return report ();
 }
@@ -0,0 +1,69 @@
+/* Array version of the correctly-rounded biased argument base-2 logarithm function for binary32 value.
+
+Copyright (c) 2022 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+
+#include "logf_kernel.h"
+#include "simd.h"
+#include "simd_impl.h"
+
+typedef union {float f; uint32_t u;} b32u32_u;
+typedef union {double f; uint64_t u;} b64u64_u;
+
+float cr_log2p1f(float);
+
+/* The generic path of cr_log2p1f (|x| >= 0x1.6f544cp-6), together with the special
+   cases, without branch, for cr_log2p1f_array(): *slow is set for the other
+   inputs. */
+static inline float log2p1f_fast(float x, uint32_t *slow){
+  double z = x;
+  b32u32_u t = {.f = x};
+  uint32_t ux = t.u, ax = ux&(~0u>>1);
+  *slow = ax < 0x3cb7aa26u;
+  b64u64_u tt = {.f = z + 1.0};
+  uint64_t m = tt.u&(~0ul>>12);
+  int e = (tt.u>>52) - 0x3ff;
+  int j;
+  z = cr_logf_reduce(m, &e, &j);
+  double c0 = cr_logf_poly(z);
+  const double iln2 = 0x1.71547652b82fep+0;
+  b64u64_u res = {.f = (z*iln2)*c0 + (e - cr_logf_lix(j)*iln2)};
+  float r = res.f;
+  // exceptions: rh + rl is computed at run time, in the current rounding mode
+  uint32_t c0x = ux == 0x52928e33u, c1x = ux == 0x4ebd09e3u;
+  float rh = cr_sel(c0x, 0x1.318ffap+5f, 0x1.e90026p+4f);
+  float rl = cr_sel(c0x, 0x1.fp-20f, 0x1.fp-21f);
+  r = cr_sel(c0x | c1x, rh + rl, r);
+  // x <= -1, +inf and nan
+  float sp = cr_sel(ax > 0xffu<<23, x, cr_sel(ux>>31, __builtin_nanf("-"), __builtin_inff()));
+  sp = cr_sel(ux == 0x17fu<<23, -__builtin_inff(), sp);
+  r = cr_sel((ux >= 0x17fu<<23) | (ax >= 0xffu<<23), sp, r);
+  return r;
+}
+
+void cr_log2p1f_array(float *y, const float *x, unsigned long n){
+  cr_array_f(y, x, n, log2p1f_fast, cr_log2p1f);
+}
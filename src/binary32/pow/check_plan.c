@@ -0,0 +1,135 @@
+/* Check the plan interface of cr_powf() against cr_powf() itself.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <fenv.h>
+#include <math.h>
+
+#include "powf.h"
+
+float cr_powf (float, float);
+
+int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
+char *rnd_name[] = { "RNDN", "RNDZ", "RNDU", "RNDD" };
+
+typedef union { float f; uint32_t u; } b32u32_u;
+
+/* exponents for which a plan is checked, in addition to random ones */
+static const float Y[] = { 0x1.d1745ep-2f /* 1/2.2 */, 0x1.19999ap+1f /* 2.2 */,
+                           0.5f, 1.5f, 2.0f, 3.0f, -1.0f, -3.0f, 0.25f, 7.0f,
+                           0x1.8p+1f, -0x1.8p-1f, 0x1p-20f, 0x1.fffffep+23f };
+
+#define N 100003 /* not a multiple of the block size of cr_powf_exec_array */
+
+static float x[N], r[N], yv[N], ra[N];
+
+/* random binary32 number, neither zero, nor Inf or NaN */
+static float
+random_float (void)
+{
+  b32u32_u v;
+  do
+    v.u = ((uint32_t) rand () << 16) ^ (uint32_t) rand ();
+  while ((v.u & 0x7fffffff) == 0 || (v.u & 0x7f800000) == 0x7f800000);
+  return v.f;
+}
+
+/* compare cr_powf_array() with cr_powf() for the exponents yv[] */
+static int
+check_array (void)
+{
+  cr_powf_array (x, yv, ra, N);
+  for (int i = 0; i < N; i++)
+  {
+    b32u32_u u = {.f = cr_powf (x[i], yv[i])}, w = {.f = ra[i]};
+    if (u.u != w.u)
+    {
+      printf ("FAIL x=%a y=%a cr_powf=%a array=%a\n", x[i], yv[i], u.f, w.f);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int
+check (float y)
+{
+  cr_powf_plan_t p = cr_powf_prepare (y);
+  cr_powf_exec_array (&p, x, r, N);
+  for (int i = 0; i < N; i++)
+  {
+    /* cr_powf() does not deal with overflow and underflow yet */
+    double t = y * log2 (fabs (x[i]));
+    if (t > 128 || t < -150)
+      continue;
+    b32u32_u u = {.f = cr_powf (x[i], y)}, v = {.f = cr_powf_exec (&p, x[i])},
+      w = {.f = r[i]};
+    if (u.u != v.u || u.u != w.u)
+    {
+      printf ("FAIL x=%a y=%a cr_powf=%a exec=%a exec_array=%a\n",
+              x[i], y, u.f, v.f, w.f);
+      return 1;
+    }
+  }
+  for (int i = 0; i < N; i++)
+    yv[i] = y;
+  return check_array ();
+}
+
+int
+main (void)
+{
+  int fails = 0;
+  srand (1);
+  for (int i = 0; i < N; i++)
+    x[i] = random_float ();
+  for (int k = 0; k < 4; k++)
+  {
+    fesetround (rnd1[k]);
+    for (unsigned j = 0; j < sizeof (Y) / sizeof (Y[0]); j++)
+      fails += check (Y[j]);
+    for (int j = 0; j < 100; j++)
+      fails += check (random_float ());
+    /* a different exponent for each input, in the range where x^y is
+       neither too large nor too small for most x */
+    for (int j = 0; j < 10; j++)
+    {
+      for (int i = 0; i < N; i++)
+        yv[i] = (i & 1) ? (float) (rand () % 9 - 4)
+          : ldexpf ((float) rand () / (float) RAND_MAX - 0.5f, rand () % 10 - 6);
+      fails += check_array ();
+    }
+    if (fails)
+    {
+      printf ("%s: %d failure(s)\n", rnd_name[k], fails);
+      exit (1);
+    }
+  }
+  printf ("all ok\n");
+  return 0;
+}
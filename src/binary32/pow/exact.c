@@ -1,4 +1,5 @@
-/* Count/print non-trivial exact and midpoint cases for binary32 power function.
+/* Count/print non-trivial exact and midpoint cases for binary32 power function,
+   and for the related pownf, rootnf and compoundnf functions.
 
 Copyright (c) 2022 Paul Zimmermann, Inria.
 
@@ -39,6 +40,10 @@ SOFTWARE.
    $ ./a.out -mid 0 # count only exact cases
    ...
    # count=842073
+
+   With -pown, only integer values of y are considered, with -rootn we
+   consider x^(1/n) and with -compound (1+x)^n for an integer n (y is then
+   printed as an integer).
 */
 
 #include <stdio.h>
@@ -54,6 +59,12 @@ int mid = 1;   /* by default, we count or print midpoint cases */
 unsigned long count = 0; /* number of solutions */
 int check = 0; /* check solutions */
 
+#define MODE_POW      0 /* x^y */
+#define MODE_POWN     1 /* x^n for an integer n */
+#define MODE_ROOTN    2 /* x^(1/n) for an integer n */
+#define MODE_COMPOUND 3 /* (1+x)^n for an integer n */
+int mode = MODE_POW;
+
 static void
 print_sol (float x, float y)
 {
@@ -68,7 +79,12 @@ print_sol (float x, float y)
     assert (ret == 0);
     ret = mpfr_set_flt (yy, y, MPFR_RNDN);
     assert (ret == 0);
-    ret = mpfr_pow (zz, xx, yy, MPFR_RNDN);
+    if (mode == MODE_ROOTN)
+      ret = mpfr_rootn_si (zz, xx, (long) y, MPFR_RNDN);
+    else if (mode == MODE_COMPOUND)
+      ret = mpfr_compound_si (zz, xx, (long) y, MPFR_RNDN);
+    else
+      ret = mpfr_pow (zz, xx, yy, MPFR_RNDN);
     assert (ret == 0);
     mpfr_exp_t e = mpfr_get_exp (zz);
     assert (e <= 128);
@@ -84,7 +100,12 @@ print_sol (float x, float y)
   }
   count ++;
   if (print)
-    printf ("%a,%a\n", x, y);
+  {
+    if (mode == MODE_POW)
+      printf ("%a,%a\n", x, y);
+    else
+      printf ("%a,%ld\n", x, (long) y);
+  }
 }
 
 /* y positive integer: both x and -x are solutions */
@@ -242,7 +263,7 @@ count_pow2_x (int e)
 
   /* case y = n/2^f */
   int f = 1;
-  while ((e % 2) == 0)
+  while ((e % 2) == 0 && mode != MODE_POWN)
   {
     /* invariant: e = e_orig/2^f */
     e = e / 2;
@@ -270,6 +291,127 @@ count_pow2_x (int e)
   printf ("# x=2^%d: %lu\n", e, local_count);
 }
 
+/* rootn(x,n) = w*2^k with w odd is exact iff x = w^n*2^(k*n), which
+   requires w^n < 2^24, thus for n < 0 or n > 15 we need w = 1 (see
+   count_rootn_pow2_x). Midpoint cases are not possible, since the n-th
+   power of a 25-bit odd integer has more than 24 bits. Here n >= 2 and
+   w >= 3: both x and -x are solutions for n odd. */
+static void
+count_rootn_y (int n)
+{
+  unsigned long local_count = 0;
+  mpfr_t z;
+  mpfr_init2 (z, 24);
+  for (unsigned long w = 3; ; w += 2)
+  {
+    unsigned long m = 1;
+    for (int j = 0; j < n; j++)
+      m *= w;
+    if (m >= 0x1000000)
+      break;
+    int bits = 64 - __builtin_clzl (m);
+    /* x = m*2^(k*n) with k*n >= -149 and k*n + bits - 1 <= 127 */
+    for (int k = - (149 / n); k * n + bits - 1 <= 127; k++)
+    {
+      mpfr_set_ui_2exp (z, m, k * n, MPFR_RNDN);
+      float x = mpfr_get_flt (z, MPFR_RNDN);
+      print_sol (x, (float) n);
+      local_count ++;
+      if (n & 1)
+      {
+        print_sol (-x, (float) n);
+        local_count ++;
+      }
+    }
+  }
+  mpfr_clear (z);
+  printf ("# n=%d: %lu\n", n, local_count);
+}
+
+/* x = +/-2^e: rootn(x,n) is exact for n dividing e, with n <> 0, 1,
+   unless it overflows (e = -149 and n = -1) */
+static void
+count_rootn_pow2_x (int e)
+{
+  unsigned long local_count = 0;
+  if (e == 0) /* trivial solutions */
+    return;
+  float x = ldexpf (1.0f, e);
+  int ae = (e > 0) ? e : -e;
+  for (int n = -ae; n <= ae; n++)
+    if (n != 0 && n != 1 && (e % n) == 0 && e / n <= 127)
+    {
+      print_sol (x, (float) n);
+      local_count ++;
+      if (n & 1)
+      {
+        print_sol (-x, (float) n);
+        local_count ++;
+      }
+    }
+  printf ("# x=2^%d: %lu\n", e, local_count);
+}
+
+/* print the solution (u-1,n) if x = u-1 is a non-zero binary32 number,
+   where u = w*2^k, and return 1 in that case */
+static int
+compound_sol (unsigned long w, int k, int n)
+{
+  mpfr_t z;
+  int ret = 0;
+  mpfr_init2 (z, 256);
+  mpfr_set_ui_2exp (z, w, k, MPFR_RNDN);
+  mpfr_sub_ui (z, z, 1, MPFR_RNDN); /* exact */
+  if (!mpfr_zero_p (z) && mpfr_min_prec (z) <= 24
+      && mpfr_get_exp (z) - (mpfr_exp_t) mpfr_min_prec (z) >= -149)
+  {
+    print_sol (mpfr_get_flt (z, MPFR_RNDN), (float) n);
+    ret = 1;
+  }
+  mpfr_clear (z);
+  return ret;
+}
+
+/* compound(x,n) = u^n with u = 1+x: write u = w*2^k with w odd, then
+   u^n = w^n*2^(k*n) is exact or a midpoint iff w^n < 2^(24+mid), with the
+   exponent constraints of binary32. For n < 0 we need w = 1, and for w >= 3
+   we need n <= 15 as for count_uint_y(). Since x = u-1 should fit in 24
+   bits, we have -48 <= k <= 24. */
+static void
+count_compound (void)
+{
+  unsigned long local_count;
+  /* case w >= 3 */
+  for (int n = 2; n <= 15; n++)
+  {
+    local_count = 0;
+    for (unsigned long w = 3; ; w += 2)
+    {
+      unsigned long m = 1;
+      for (int j = 0; j < n; j++)
+        m *= w;
+      if (m >= (0x1000000ul << mid))
+        break;
+      int bits = 64 - __builtin_clzl (m);
+      for (int k = -48; k <= 24; k++)
+        if (k * n >= -149 - mid && k * n + bits - 1 <= 127)
+          local_count += compound_sol (w, k, n);
+    }
+    printf ("# n=%d: %lu\n", n, local_count);
+  }
+  /* case w = 1: u^n = 2^(k*n) */
+  for (int k = -48; k <= 24; k++)
+  {
+    local_count = 0;
+    if (k == 0) /* x = 0 */
+      continue;
+    for (int n = -150; n <= 150; n++)
+      if (n != 0 && n != 1 && k * n >= -149 - mid && k * n <= 127)
+        local_count += compound_sol (1, k, n);
+    printf ("# u=2^%d: %lu\n", k, local_count);
+  }
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -287,6 +429,24 @@ main (int argc, char *argv[])
       argv ++;
       argc --;
     }
+    else if (strcmp (argv[1], "-pown") == 0)
+    {
+      mode = MODE_POWN;
+      argv ++;
+      argc --;
+    }
+    else if (strcmp (argv[1], "-rootn") == 0)
+    {
+      mode = MODE_ROOTN;
+      argv ++;
+      argc --;
+    }
+    else if (strcmp (argv[1], "-compound") == 0)
+    {
+      mode = MODE_COMPOUND;
+      argv ++;
+      argc --;
+    }
     else if (argc >= 3 && strcmp (argv[1], "-mid") == 0)
     {
       mid = atoi (argv[2]);
@@ -300,6 +460,23 @@ main (int argc, char *argv[])
     }
   }
 
+  if (mode == MODE_ROOTN)
+  {
+    for (int n = 2; n <= 15; n++)
+      count_rootn_y (n);
+    for (int e = -149; e <= 127; e++)
+      count_rootn_pow2_x (e);
+    printf ("# count=%lu\n", count);
+    return 0;
+  }
+
+  if (mode == MODE_COMPOUND)
+  {
+    count_compound ();
+    printf ("# count=%lu\n", count);
+    return 0;
+  }
+
   /* First deal with integer y >= 2. If x is not a power of 2, then y <= 15
      whatever the value of mid, since 3^15 has 24 bits, and 3^16 has 26 bits.
      Indeed, assume x = m*2^e with m odd, then m >= 3, thus we should have
@@ -311,7 +488,7 @@ main (int argc, char *argv[])
      which implies f <= 3 whatever the value of mid, since 3^(2^3) has 13 bits, and 3^(2^4)
      has 26 bits.
      For the same reason as above, n <= 15. */
-  for (int f = 1; f <= 3; f++)
+  for (int f = 1; f <= 3 && mode != MODE_POWN; f++)
     for (int n = 1; n <= 15; n += 2)
       count_uint_2exp_y (n, f);
   /* Now deal with x=2^e. */
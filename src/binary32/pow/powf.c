@@ -25,6 +25,9 @@ SOFTWARE.
 */
 
 #include <stdint.h>
+#include <stddef.h>
+#include "powf.h"
+#include "exp2f_kernel.h"
 
 typedef union {float f; uint32_t u;} b32u32_u;
 typedef union {double f; uint64_t u;} b64u64_u;
@@ -96,41 +99,47 @@ static __attribute__((noinline)) double polydd(double xh, double xl, int n, cons
   return ch;
 }
 
-static float as_powf_accurate2(float, float);
+static float as_powf_accurate2(float, const cr_powf_plan_t *);
 
-float cr_powf(float x0, float y0){
-  static const double ix[] = {
-    0x1p+0, 0x1.f07c1f07cp-1, 0x1.e1e1e1e1ep-1, 0x1.d41d41d42p-1,
-    0x1.c71c71c72p-1, 0x1.bacf914c2p-1, 0x1.af286bca2p-1, 0x1.a41a41a42p-1,
-    0x1.99999999ap-1, 0x1.8f9c18f9cp-1, 0x1.861861862p-1, 0x1.7d05f417dp-1,
-    0x1.745d1745dp-1, 0x1.6c16c16c1p-1, 0x1.642c8590bp-1, 0x1.5c9882b93p-1,
-    0x1.555555555p-1, 0x1.4e5e0a72fp-1, 0x1.47ae147aep-1, 0x1.414141414p-1,
-    0x1.3b13b13b1p-1, 0x1.3521cfb2bp-1, 0x1.2f684bda1p-1, 0x1.29e4129e4p-1,
-    0x1.249249249p-1, 0x1.1f7047dc1p-1, 0x1.1a7b9611ap-1, 0x1.15b1e5f75p-1,
-    0x1.111111111p-1, 0x1.0c9714fbdp-1, 0x1.084210842p-1, 0x1.041041041p-1, 0x1p-1
-  };
-  
-  static const double lix[][2] = {
-    {0x0p+0, 0x0p+0}, {-0x1.6cp-5, 0x1.4b229b87f3f89p-15},
-    {-0x1.66p-4, -0x1.fb7d654235799p-15}, {-0x1.08p-3, -0x1.8b119b2c9c87bp-12},
-    {-0x1.5cp-3, -0x1.a39fa6533294dp-19}, {-0x1.acp-3, -0x1.ebc5b663dd4b8p-12},
-    {-0x1.fcp-3, 0x1.f4a37fe0fa46fp-14}, {-0x1.24p-2, -0x1.01eac33103e6bp-12},
-    {-0x1.4ap-2, 0x1.61ed0d15725ep-12}, {-0x1.6ep-2, -0x1.10e6ceb499ba9p-13},
-    {-0x1.92p-2, 0x1.115db8ada837dp-12}, {-0x1.b4p-2, -0x1.fafdce266d7aep-12},
-    {-0x1.d6p-2, -0x1.d4f80cd19906fp-12}, {-0x1.f8p-2, 0x1.5ea5ccd0a7396p-12},
-    {0x1.e8p-2, -0x1.0500d67fe62ebp-13}, {0x1.c8p-2, 0x1.9dc2d41aa4626p-14},
-    {0x1.a8p-2, 0x1.ff2e2ff321344p-11}, {0x1.8ap-2, 0x1.130157f4c3a3ep-11},
-    {0x1.6cp-2, 0x1.61ed0cad929ccp-11}, {0x1.5p-2, -0x1.2089a632d7949p-11},
-    {0x1.32p-2, 0x1.7fdc6dfb2d21ap-11}, {0x1.16p-2, 0x1.380a6c36088f3p-11},
-    {0x1.f6p-3, -0x1.3ab7dc7ba81acp-18}, {0x1.cp-3, -0x1.cc2c0061ef1a2p-14},
-    {0x1.8ap-3, 0x1.130157c97bbep-12}, {0x1.56p-3, 0x1.ee14ff34c4128p-14},
-    {0x1.22p-3, 0x1.b5b854c4fde69p-12}, {0x1.ep-4, 0x1.635d1df7cb0b5p-13},
-    {0x1.7ep-4, -0x1.3f6d2636c101ep-13}, {0x1.1cp-4, -0x1.33567f1b193a4p-14},
-    {0x1.78p-5, -0x1.8d66c5313a71dp-14}, {0x1.74p-6, 0x1.f7430ee200ep-17}, {0x0p+0, 0x0p+0}
-  };
-
-  double x = x0, y = y0;
-  b64u64_u tx = {.f = x}, ty = {.f = y};
+/* The tables of the reduction of the fast path: ix[j] ~ 1/(1+j/32), and
+   lix[j][0] + lix[j][1] ~ log2(ix[j]), plus 1 for j > 13 (where the
+   exponent is incremented). */
+static const double ix[] = {
+  0x1p+0, 0x1.f07c1f07cp-1, 0x1.e1e1e1e1ep-1, 0x1.d41d41d42p-1,
+  0x1.c71c71c72p-1, 0x1.bacf914c2p-1, 0x1.af286bca2p-1, 0x1.a41a41a42p-1,
+  0x1.99999999ap-1, 0x1.8f9c18f9cp-1, 0x1.861861862p-1, 0x1.7d05f417dp-1,
+  0x1.745d1745dp-1, 0x1.6c16c16c1p-1, 0x1.642c8590bp-1, 0x1.5c9882b93p-1,
+  0x1.555555555p-1, 0x1.4e5e0a72fp-1, 0x1.47ae147aep-1, 0x1.414141414p-1,
+  0x1.3b13b13b1p-1, 0x1.3521cfb2bp-1, 0x1.2f684bda1p-1, 0x1.29e4129e4p-1,
+  0x1.249249249p-1, 0x1.1f7047dc1p-1, 0x1.1a7b9611ap-1, 0x1.15b1e5f75p-1,
+  0x1.111111111p-1, 0x1.0c9714fbdp-1, 0x1.084210842p-1, 0x1.041041041p-1, 0x1p-1
+};
+
+static const double lix[][2] = {
+  {0x0p+0, 0x0p+0}, {-0x1.6cp-5, 0x1.4b229b87f3f89p-15},
+  {-0x1.66p-4, -0x1.fb7d654235799p-15}, {-0x1.08p-3, -0x1.8b119b2c9c87bp-12},
+  {-0x1.5cp-3, -0x1.a39fa6533294dp-19}, {-0x1.acp-3, -0x1.ebc5b663dd4b8p-12},
+  {-0x1.fcp-3, 0x1.f4a37fe0fa46fp-14}, {-0x1.24p-2, -0x1.01eac33103e6bp-12},
+  {-0x1.4ap-2, 0x1.61ed0d15725ep-12}, {-0x1.6ep-2, -0x1.10e6ceb499ba9p-13},
+  {-0x1.92p-2, 0x1.115db8ada837dp-12}, {-0x1.b4p-2, -0x1.fafdce266d7aep-12},
+  {-0x1.d6p-2, -0x1.d4f80cd19906fp-12}, {-0x1.f8p-2, 0x1.5ea5ccd0a7396p-12},
+  {0x1.e8p-2, -0x1.0500d67fe62ebp-13}, {0x1.c8p-2, 0x1.9dc2d41aa4626p-14},
+  {0x1.a8p-2, 0x1.ff2e2ff321344p-11}, {0x1.8ap-2, 0x1.130157f4c3a3ep-11},
+  {0x1.6cp-2, 0x1.61ed0cad929ccp-11}, {0x1.5p-2, -0x1.2089a632d7949p-11},
+  {0x1.32p-2, 0x1.7fdc6dfb2d21ap-11}, {0x1.16p-2, 0x1.380a6c36088f3p-11},
+  {0x1.f6p-3, -0x1.3ab7dc7ba81acp-18}, {0x1.cp-3, -0x1.cc2c0061ef1a2p-14},
+  {0x1.8ap-3, 0x1.130157c97bbep-12}, {0x1.56p-3, 0x1.ee14ff34c4128p-14},
+  {0x1.22p-3, 0x1.b5b854c4fde69p-12}, {0x1.ep-4, 0x1.635d1df7cb0b5p-13},
+  {0x1.7ep-4, -0x1.3f6d2636c101ep-13}, {0x1.1cp-4, -0x1.33567f1b193a4p-14},
+  {0x1.78p-5, -0x1.8d66c5313a71dp-14}, {0x1.74p-6, 0x1.f7430ee200ep-17}, {0x0p+0, 0x0p+0}
+};
+
+/* Fast path of cr_powf(x0,y): return an approximation of |x0|^y, within
+   44 ulps (in double precision). There is no branch, thus the compiler can
+   vectorize loops calling this function. */
+static inline double powf_fast(const cr_powf_plan_t *p, float x0){
+  double x = x0, y = p->y16;
+  b64u64_u tx = {.f = x};
   uint64_t m = tx.u & ~0ul>>12;
   int e = ((tx.u>>52)&0x7ff) - 0x3ff;
   int j = (m + (1l<<(52-6)))>>(52-5), k = j>13;
@@ -148,41 +157,242 @@ float cr_powf(float x0, float y0){
   c0 += z2*c2;
   c4 += z2*c6;
   c0 += z4*c4;
-  double l = z*c0 - lix[j][1];
-  y *= 16;
-  double zt = (e - lix[j][0])*y;
+  const double *lx = lix[0]; /* flat indices, so that loads can be gathers */
+  double l = z*c0 - lx[2*j+1];
+  double zt = (e - lx[2*j])*y;
   z = l*y + zt;
-  double ia = __builtin_floor(z), h = __builtin_fma(l, y, zt - ia);
-  static const double ce[] =
-    {0x1.62e42fefa398bp-5, 0x1.ebfbdff84555ap-11, 0x1.c6b08d4ad86d3p-17,
-     0x1.3b2ad1b1716a2p-23, 0x1.5d7472718ce9dp-30, 0x1.4a1d7f457ac56p-37};
-  static const double tb[] =
-    {0x1p+0, 0x1.0b5586cf9890fp+0, 0x1.172b83c7d517bp+0, 0x1.2387a6e756238p+0,
-     0x1.306fe0a31b715p+0, 0x1.3dea64c123422p+0, 0x1.4bfdad5362a27p+0, 0x1.5ab07dd485429p+0,
-     0x1.6a09e667f3bcdp+0, 0x1.7a11473eb0187p+0, 0x1.8ace5422aa0dbp+0, 0x1.9c49182a3f09p+0,
-     0x1.ae89f995ad3adp+0, 0x1.c199bdd85529cp+0, 0x1.d5818dcfba487p+0, 0x1.ea4afa2a490dap+0};
-  long il = ia, jl = il&0xf, el = il - jl;
-  el >>= 4;
-  double s = tb[jl];
-  b64u64_u su = {.u = (el + 0x3fful)<<52};
-  s *= su.f;
-  double h2 = h*h;
-  c0 = ce[0] + h*ce[1];
-  c2 = ce[2] + h*ce[3];
-  c4 = ce[4] + h*ce[5];
-  c0 += h2*(c2 + h2*c4);
-  double w = s*h;
-  b64u64_u rr = {.f = s + w*c0};
+  /* ia = floor(z), computed without __builtin_floor() which prevents
+     vectorization: for |z| < 2^51, t is an integer next to z, whatever the
+     rounding mode */
+  double t = (z + 0x1.8p+52) - 0x1.8p+52, ia = t - (t > z);
+  double h = __builtin_fma(l, y, zt - ia);
+  return cr_exp2f_kernel(ia, h, 0x3ff);
+}
+
+/* Round the fast path approximation r of |x0|^y, or call the accurate path
+   when rounding cannot be decided. */
+static inline float powf_round(const cr_powf_plan_t *p, float x0, double r){
+  b64u64_u rr = {.f = r};
   float res = rr.f;
   uint64_t off = 44;
-  if(((rr.u+off)&0xfffffff) <= 2*off) return as_powf_accurate2(x0,y0);
-  int et = ((ty.u>>52)&0x7ff) - 0x3ff;
-  uint64_t kk = ty.u<<(11+et);
-  if(!(kk<<1)&&kk) return __builtin_copysignf(res,x0);
+  if(((rr.u+off)&0xfffffff) <= 2*off) return as_powf_accurate2(x0,p);
+  if(p->odd) return __builtin_copysignf(res,x0);
   return res;
 }
 
-float as_powf_accurate2(float x0, float y0){
+static inline cr_powf_plan_t powf_prepare(float y0){
+  cr_powf_plan_t p;
+  b32u32_u ty = {.f = y0};
+  int et = ((ty.u>>23)&0xff) - 0x7f;
+  p.y = y0;
+  p.y16 = 16.0*y0;
+  /* y0 is an odd integer iff its last non-zero bit is the unit bit */
+  p.odd = 0 <= et && et <= 23 && ty.u<<(8+et) == 0x80000000u;
+  return p;
+}
+
+float cr_powf(float x0, float y0){
+  cr_powf_plan_t p = powf_prepare(y0);
+  return powf_round(&p, x0, powf_fast(&p, x0));
+}
+
+cr_powf_plan_t cr_powf_prepare(float y0){
+  return powf_prepare(y0);
+}
+
+float cr_powf_exec(const cr_powf_plan_t *p, float x0){
+  return powf_round(p, x0, powf_fast(p, x0));
+}
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__) && defined(__AVX512VL__)
+#define POWF_AVX512
+#include <immintrin.h>
+
+/* With AVX-512, the array versions evaluate the fast path on 8 inputs at
+   once.  A gather per table lookup would cost more than the rest of the
+   evaluation, thus the tables are kept in registers: the 32 first entries
+   of ix[] and lix[][] (the last ones are those of j = 0, up to the exponent)
+   and the 16 entries of 2^(j/16) fit in 8 registers each, and a lookup is
+   done with two vpermt2pd (which pick among 16 entries) and a blend. */
+
+typedef struct {
+  __m512d ix[4], lh[4], ll[4], tb[2];
+} powf_regs_t;
+
+static inline void powf_regs_init(powf_regs_t *t){
+  /* de-interleave lix[][] */
+  const __m512i even = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+  const __m512i odd = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+  for(int i = 0; i < 4; i++){
+    __m512d a = _mm512_loadu_pd(lix[8*i]), b = _mm512_loadu_pd(lix[8*i+4]);
+    t->ix[i] = _mm512_loadu_pd(ix + 8*i);
+    t->lh[i] = _mm512_permutex2var_pd(a, even, b);
+    t->ll[i] = _mm512_permutex2var_pd(a, odd, b);
+  }
+  t->tb[0] = _mm512_loadu_pd(__cr_exp2f_data.tb);
+  t->tb[1] = _mm512_loadu_pd(__cr_exp2f_data.tb + 8);
+}
+
+/* T[j] for 0 <= j < 32, and v for j = 32 */
+static inline __m512d powf_lookup33(const __m512d T[4], __m512i j, double v){
+  __m512d lo = _mm512_permutex2var_pd(T[0], j, T[1]);
+  __m512d hi = _mm512_permutex2var_pd(T[2], j, T[3]);
+  __m512d r = _mm512_mask_blend_pd(_mm512_test_epi64_mask(j, _mm512_set1_epi64(16)), lo, hi);
+  return _mm512_mask_blend_pd(_mm512_cmpeq_epi64_mask(j, _mm512_set1_epi64(32)), r, _mm512_set1_pd(v));
+}
+
+/* powf_fast() and the rounding of powf_round() for x0[0..7] and
+   y16 = 16*y: return the rounded results (without the sign of x0), and set
+   *slow to the mask of the inputs which need cr_powf(): those for which the
+   rounding cannot be decided, and those with x0 = 0, Inf or NaN, or whose
+   result is too large or too small (including y = Inf or NaN), which
+   cr_powf() alone decides how to handle. */
+static inline __m256 powf_fast8(const powf_regs_t *t, __m256 x0, __m512d y, __mmask8 *slow){
+  const __m512i mmask = _mm512_set1_epi64(~0ul>>12), one = _mm512_set1_epi64(0x3fful<<52);
+  __m512d x = _mm512_cvtps_pd(x0);
+  __m512i tx = _mm512_castpd_si512(x);
+  __m512i m = _mm512_and_si512(tx, mmask);
+  __m512i e = _mm512_sub_epi64(_mm512_and_si512(_mm512_srli_epi64(tx, 52), _mm512_set1_epi64(0x7ff)),
+                               _mm512_set1_epi64(0x3ff));
+  __m512i j = _mm512_srli_epi64(_mm512_add_epi64(m, _mm512_set1_epi64(1l<<(52-6))), 52-5);
+  e = _mm512_mask_add_epi64(e, _mm512_cmpgt_epi64_mask(j, _mm512_set1_epi64(13)), e, _mm512_set1_epi64(1));
+  __m512d xd = _mm512_castsi512_pd(_mm512_or_si512(m, one));
+  __m512d z = _mm512_fmsub_pd(xd, powf_lookup33(t->ix, j, 0x1p-1), _mm512_set1_pd(1.0));
+  static const double c[] =
+    {0x1.71547652b82fep+0, -0x1.71547652b82fep-1, 0x1.ec709dc3a2d0bp-2, -0x1.71547652bc4a9p-2,
+     0x1.2776c441b72ep-2, -0x1.ec709bdf453ecp-3, 0x1.a6406efd4b877p-3, -0x1.717d824a520f7p-3};
+  __m512d z2 = _mm512_mul_pd(z, z), z4 = _mm512_mul_pd(z2, z2);
+  __m512d c6 = _mm512_fmadd_pd(z, _mm512_set1_pd(c[7]), _mm512_set1_pd(c[6]));
+  __m512d c4 = _mm512_fmadd_pd(z, _mm512_set1_pd(c[5]), _mm512_set1_pd(c[4]));
+  __m512d c2 = _mm512_fmadd_pd(z, _mm512_set1_pd(c[3]), _mm512_set1_pd(c[2]));
+  __m512d c0 = _mm512_fmadd_pd(z, _mm512_set1_pd(c[1]), _mm512_set1_pd(c[0]));
+  c0 = _mm512_fmadd_pd(z2, c2, c0);
+  c4 = _mm512_fmadd_pd(z2, c6, c4);
+  c0 = _mm512_fmadd_pd(z4, c4, c0);
+  __m512d l = _mm512_fmsub_pd(z, c0, powf_lookup33(t->ll, j, 0.0));
+  __m512d zt = _mm512_mul_pd(_mm512_sub_pd(_mm512_cvtepi64_pd(e), powf_lookup33(t->lh, j, 0.0)), y);
+  z = _mm512_fmadd_pd(l, y, zt);
+  __m512d ia = _mm512_roundscale_pd(z, _MM_FROUND_TO_NEG_INF|_MM_FROUND_NO_EXC);
+  __m512d h = _mm512_fmadd_pd(l, y, _mm512_sub_pd(zt, ia));
+  /* cr_exp2f_kernel(ia, h, 0x3ff) */
+  __m512i i = _mm512_cvtpd_epi64(ia); /* ia is an integer */
+  __m512i se = _mm512_slli_epi64(_mm512_add_epi64(_mm512_srai_epi64(i, 4), _mm512_set1_epi64(0x3ff)), 52);
+  __m512d s = _mm512_mul_pd(_mm512_permutex2var_pd(t->tb[0], i, t->tb[1]), _mm512_castsi512_pd(se));
+  __m512d w = _mm512_mul_pd(s, h);
+  const double *ce = __cr_exp2f_data.c;
+  __m512d h2 = _mm512_mul_pd(h, h);
+  __m512d d0 = _mm512_fmadd_pd(h, _mm512_set1_pd(ce[1]), _mm512_set1_pd(ce[0]));
+  __m512d d2 = _mm512_fmadd_pd(h, _mm512_set1_pd(ce[3]), _mm512_set1_pd(ce[2]));
+  __m512d d4 = _mm512_fmadd_pd(h, _mm512_set1_pd(ce[5]), _mm512_set1_pd(ce[4]));
+  d0 = _mm512_fmadd_pd(h2, _mm512_fmadd_pd(h2, d4, d2), d0);
+  __m512d r = _mm512_fmadd_pd(w, d0, s);
+  /* powf_round(), and the inputs left to cr_powf() */
+  __m512i rr = _mm512_castpd_si512(r);
+  rr = _mm512_and_si512(_mm512_add_epi64(rr, _mm512_set1_epi64(44)), _mm512_set1_epi64(0xfffffff));
+  *slow = _mm512_cmple_epu64_mask(rr, _mm512_set1_epi64(2*44))
+    | ~_mm512_cmp_pd_mask(_mm512_abs_pd(z), _mm512_set1_pd(0x1.fp+10), _CMP_LT_OQ)
+    | _mm512_cmpeq_epi64_mask(_mm512_and_si512(tx, _mm512_set1_epi64(0x7fful<<52)), _mm512_set1_epi64(0x7fful<<52))
+    | _mm512_cmpeq_epi64_mask(_mm512_slli_epi64(tx, 1), _mm512_setzero_si512());
+  return _mm512_cvtpd_ps(r);
+}
+
+/* The index i0+k and the input x0 of each lane k set in slow, appended to
+   idx[] and xs[] from index m: return the new number of elements. */
+static inline unsigned powf_append(unsigned *idx, float *xs, unsigned m, unsigned i0, __m256 x0, __mmask8 slow){
+  float v[8];
+  _mm256_storeu_ps(v, x0);
+  for(unsigned k = slow; k; k &= k - 1){
+    unsigned b = __builtin_ctz(k);
+    idx[m] = i0 + b;
+    xs[m++] = v[b];
+  }
+  return m;
+}
+#endif
+
+#define POWF_BLOCK 256
+
+/* The inputs are processed by blocks: with AVX-512, the fast path is first
+   computed with powf_fast8() for the whole block, the few inputs which it
+   cannot decide being set aside, and they go to cr_powf_exec() afterwards
+   (r may be x).  Otherwise, the fast path is computed for the whole block in
+   a loop which the compiler can vectorize, then the results are rounded,
+   and the few hard cases go to the accurate path. */
+void cr_powf_exec_array(const cr_powf_plan_t *p, const float *x, float *r, size_t n){
+#ifdef POWF_AVX512
+  powf_regs_t t;
+  unsigned idx[POWF_BLOCK];
+  float xs[POWF_BLOCK];
+  powf_regs_init(&t);
+  __m512d y = _mm512_set1_pd(p->y16);
+  __m256i sgn = _mm256_set1_epi32(p->odd ? 0x80000000 : 0);
+  for(size_t i = 0; i < n; i += POWF_BLOCK){
+    unsigned k = (n - i < POWF_BLOCK) ? n - i : POWF_BLOCK, m = 0, j = 0;
+    for(; j + 8 <= k; j += 8){
+      __mmask8 slow;
+      __m256 x0 = _mm256_loadu_ps(x + i + j);
+      __m256 v = powf_fast8(&t, x0, y, &slow);
+      m = powf_append(idx, xs, m, j, x0, slow);
+      v = _mm256_or_ps(v, _mm256_and_ps(x0, _mm256_castsi256_ps(sgn)));
+      _mm256_storeu_ps(r + i + j, v);
+    }
+    for(; j < k; j++){
+      idx[m] = j;
+      xs[m++] = x[i+j];
+    }
+    for(unsigned l = 0; l < m; l++) r[i+idx[l]] = cr_powf_exec(p, xs[l]);
+  }
+#else
+  double t[64];
+  for(size_t i = 0; i < n; i += 64){
+    size_t k = (n - i < 64) ? n - i : 64;
+    for(size_t j = 0; j < k; j++) t[j] = powf_fast(p, x[i+j]);
+    for(size_t j = 0; j < k; j++) r[i+j] = powf_round(p, x[i+j], t[j]);
+  }
+#endif
+}
+
+/* Same as cr_powf_exec_array(), but with a different exponent for each
+   input: y is an odd integer when its last non-zero bit is the unit bit. */
+void cr_powf_array(const float *x, const float *y, float *r, size_t n){
+#ifdef POWF_AVX512
+  powf_regs_t t;
+  unsigned idx[POWF_BLOCK];
+  float xs[POWF_BLOCK], ys[POWF_BLOCK];
+  powf_regs_init(&t);
+  for(size_t i = 0; i < n; i += POWF_BLOCK){
+    unsigned k = (n - i < POWF_BLOCK) ? n - i : POWF_BLOCK, m = 0, j = 0;
+    for(; j + 8 <= k; j += 8){
+      __mmask8 slow;
+      __m256 x0 = _mm256_loadu_ps(x + i + j), y0 = _mm256_loadu_ps(y + i + j);
+      __m512d y16 = _mm512_mul_pd(_mm512_cvtps_pd(y0), _mm512_set1_pd(16.0));
+      __m256 v = powf_fast8(&t, x0, y16, &slow);
+      unsigned m0 = m;
+      m = powf_append(idx, xs, m, j, x0, slow);
+      for(unsigned l = m0; l < m; l++) ys[l] = y[i+idx[l]];
+      /* odd integers y: 0 <= et <= 23 and ty.u<<(8+et) == 0x80000000 */
+      __m256i ty = _mm256_castps_si256(y0);
+      __m256i et = _mm256_sub_epi32(_mm256_and_si256(_mm256_srli_epi32(ty, 23), _mm256_set1_epi32(0xff)),
+                                    _mm256_set1_epi32(0x7f));
+      __mmask8 odd = _mm256_cmplt_epu32_mask(et, _mm256_set1_epi32(24))
+        & _mm256_cmpeq_epi32_mask(_mm256_sllv_epi32(ty, _mm256_add_epi32(et, _mm256_set1_epi32(8))),
+                                  _mm256_set1_epi32(0x80000000));
+      v = _mm256_mask_or_ps(v, odd, v, _mm256_and_ps(x0, _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000))));
+      _mm256_storeu_ps(r + i + j, v);
+    }
+    for(; j < k; j++){
+      idx[m] = j;
+      xs[m] = x[i+j];
+      ys[m++] = y[i+j];
+    }
+    for(unsigned l = 0; l < m; l++) r[i+idx[l]] = cr_powf(xs[l], ys[l]);
+  }
+#else
+  for(size_t i = 0; i < n; i++) r[i] = cr_powf(x[i], y[i]);
+#endif
+}
+
+float as_powf_accurate2(float x0, const cr_powf_plan_t *p){
   static const double o[] = {1, 2};
   static const double ch[][2] =
     {{0x1.71547652b82fep+1, 0x1.777d0ffda2b89p-55}, {0x1.ec709dc3a03fdp-1, 0x1.d27f04ff73b3ap-55},
@@ -203,7 +413,7 @@ float as_powf_accurate2(float x0, float y0){
      {0x1.c3bd65182746dp-36, 0x1.84ad0689d30ep-91}, {0x1.8161931d765c3p-40, -0x1.254c6535279cep-95},
      {0x1.314943a26c9e2p-44, -0x1.f4f2fdc14fb82p-98}, {0x1.c36e53b459602p-49, 0x1.f0d06a5a63c41p-103},
      {0x1.397637b3876a4p-53, -0x1.5632c551ae458p-107}, {0x1.98fbfefdddb51p-58, -0x1.fd134923d52b4p-115}};
-  double x = x0, y = y0;
+  double x = x0, y = p->y;
   b64u64_u t = {.f = x};
   int e = ((t.u>>52)&0x7ff) - 0x3ff;
   t.u &= ~0ul>>12;
@@ -220,9 +430,6 @@ float as_powf_accurate2(float x0, float y0){
   eh -= ee;
   eh = polydd(eh, el, 18, ce, &el);
   b64u64_u r = {.u = (0x3fful+(long)ee)<<52};
-  b32u32_u ty = {.f = y0};
-  int et = ((ty.u>>23)&0xff) - 0x7f;
-  unsigned kk = ty.u<<(8+et), isint = !(kk<<1|et>>31) || et>=23;
   b64u64_u ll = {.f = el}, lh = {.f = eh};
   if(((ll.u>>(6*4-1))&((1<<29)-1)) == ((1<<29)-1)){
     if(eh<1){
@@ -285,7 +492,7 @@ float as_powf_accurate2(float x0, float y0){
   
   eh *= r.f;
   el *= r.f;
-  if(isint && kk){
+  if(p->odd){
     eh = __builtin_copysign(eh, x0);
   }
   float res = eh;
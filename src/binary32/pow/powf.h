@@ -0,0 +1,49 @@
+/* Plan interface to the binary32 power function, for a fixed exponent.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef CR_POWF_H
+#define CR_POWF_H
+
+#include <stddef.h>
+
+/* The quantities of cr_powf(x,y) which only depend on y: a plan is computed
+   once by cr_powf_prepare(y), then cr_powf_exec(&plan,x) returns the same
+   value as cr_powf(x,y), for any x. */
+typedef struct {
+  float y;    /* the exponent */
+  double y16; /* 16*y, as used by the fast path */
+  int odd;    /* non-zero iff y is an odd integer */
+} cr_powf_plan_t;
+
+cr_powf_plan_t cr_powf_prepare (float);
+float cr_powf_exec (const cr_powf_plan_t *, float);
+/* r[i] = cr_powf (x[i], y) for 0 <= i < n */
+void cr_powf_exec_array (const cr_powf_plan_t *, const float *, float *, size_t);
+
+/* r[i] = cr_powf (x[i], y[i]) for 0 <= i < n */
+void cr_powf_array (const float *, const float *, float *, size_t);
+
+#endif
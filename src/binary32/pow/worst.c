@@ -1,4 +1,4 @@
-/* Compute worst cases of powf.
+/* Compute worst cases of powf, pownf, rootnf and compoundnf.
 
 Copyright (c) 2022 Paul Zimmermann, Inria.
 
@@ -32,6 +32,25 @@ Example:
 -ymax 0x1p1 stops the search at y < 0x1p1
 -d 2 uses a degree-2 approximation (use degree 0 for |y| very small)
 -inv considers the inverse function (faster for |y| small)
+
+The following options search worst cases of related functions, where y is
+an integer n, and the search is done for ymin <= n <= ymax (both included,
+by default 2 <= n <= 16):
+-pown considers x^n (pownf)
+-rootn considers x^(1/n) (rootnf)
+-compound considers (1+x)^n (compoundnf), for x > 0 by default,
+   or for -1 < x < 0 with -neg, and |x| >= 2^-20 unless -xmin is given
+Since pownf and rootnf are odd or even in x, only x > 0 is considered.
+-inv is only available for x^y and -pown. Example:
+
+./worst -m 40 -rootn -ymin -16 -ymax 16 -d 2
+
+The search over x is done by the engine of ../support/worst_engine.c, for
+which this file is the plug-in of x^y (and of the related functions): see
+../support/worst_engine.h for the options common to all functions.  The
+search over z with -inv is specific to x^y.
+
+To compile: make worst CFLAGS="-O3 -march=native"
 */
 
 #include <stdio.h>
@@ -44,6 +63,7 @@ Example:
 #include <math.h>
 #include <sys/types.h>
 #include <sys/resource.h>
+#include "worst_engine.h"
 
 #ifdef TIME
 int
@@ -59,10 +79,6 @@ cputime ()
 /* define COUNT to only count the number of (x,y) pairs to check */
 // #define COUNT
 
-/* define PRINT_EXACT to print also the exact cases
-   (otherwise we only count them) */
-// #define PRINT_EXACT
-
 #define TRACEX 0x1.81e7dep-79f
 #define TRACEY -0x1.24eadp-20f
 #define TRACEZ 16782903
@@ -70,51 +86,65 @@ cputime ()
 
 #define PREC_INV 100
 
-int target_m; /* number of identical bits after round bit */
-unsigned long nsols = 0, nexact = 0;
-unsigned long calls_mpfr_pow = 0; /* number of calls to mpfr_pow */
-unsigned long calls_print_sol = 0; /* number of calls to print_sol[2] */
-unsigned long tot_checks = 0;
-int d = -1; /* degree of approximating polynomial (default 1) */
-float Xmin = 0x1p-149f;
-float Xmax = 0x1.fffffep127f;
 int inv = 0; /* if inv is non-zero, search for HR cases of the inverse */
-int verbose = 0;
 
-typedef union { uint32_t n; float x; } union_t;
+/* function f(x,y) under consideration */
+#define MODE_POW      0 /* x^y */
+#define MODE_POWN     1 /* x^n for an integer n */
+#define MODE_ROOTN    2 /* x^(1/n) for an integer n */
+#define MODE_COMPOUND 3 /* (1+x)^n for an integer n */
+int mode = MODE_POW;
+/* with -compound and -neg (xneg is non-zero), search for -1 < x < 0 */
 
-static inline uint32_t
-asuint (float x)
+/* set z to f(x,y) rounded according to rnd, where y is an integer for
+   all modes except MODE_POW */
+static int
+f_eval (mpfr_t z, mpfr_t x, float y, mpfr_rnd_t rnd)
 {
-  union_t u;
-  u.x = x;
-  return u.n;
+  if (mode == MODE_ROOTN)
+    return mpfr_rootn_si (z, x, (long) y, rnd);
+  if (mode == MODE_COMPOUND)
+    return mpfr_compound_si (z, x, (long) y, rnd);
+  mpfr_t yy;
+  mpfr_init2 (yy, 24);
+  mpfr_set_flt (yy, y, MPFR_RNDN);
+  int inex = mpfr_pow (z, x, yy, rnd);
+  mpfr_clear (yy);
+  return inex;
 }
 
-static float
-asfloat (uint32_t n)
+/* set yy to the exponent p such that f(x,y) = b^p, where b is the base
+   (see set_base), i.e., p = 1/y for -rootn, and p = y otherwise */
+static void
+set_exponent (mpfr_t yy, float y)
 {
-  union_t u;
-  u.n = n;
-  return u.x;
+  if (mode == MODE_ROOTN)
+  {
+    mpfr_set_si (yy, 1, MPFR_RNDN);
+    mpfr_div_si (yy, yy, (long) y, MPFR_RNDN);
+  }
+  else
+    mpfr_set_flt (yy, y, MPFR_RNDN);
 }
 
-float
-ref_pow (uint32_t m, int e, float y, mpfr_rnd_t rnd)
+/* set b to the base of f(x,y): 1+x for -compound, and x otherwise;
+   b should have enough precision for the result to be exact */
+static void
+set_base (mpfr_t b, mpfr_t x)
 {
-  mpfr_t xx, yy;
-  mpfr_init2 (xx, 24);
-  mpfr_init2 (yy, 24);
-  mpfr_set_ui_2exp (xx, m, e, MPFR_RNDN);
-  mpfr_set_flt (yy, y, MPFR_RNDN);
-  int inex = mpfr_pow (yy, xx, yy, rnd);
-#pragma omp atomic update
-  calls_mpfr_pow ++;
-  mpfr_subnormalize (yy, inex, rnd);
-  float ret = mpfr_get_flt (yy, MPFR_RNDN);
-  mpfr_clear (xx);
-  mpfr_clear (yy);
-  return ret;
+  if (mode == MODE_COMPOUND)
+    mpfr_add_ui (b, x, 1, MPFR_RNDN);
+  else
+    mpfr_set (b, x, MPFR_RNDN);
+}
+
+static void
+print_xy (float x, float y)
+{
+  if (mode == MODE_POW)
+    printf ("%a,%a", x, y);
+  else
+    printf ("%a,%ld", x, (long) y);
 }
 
 /* return z^(1/y) rounded wrt rnd, with z=n*2^e */
@@ -129,7 +159,7 @@ ref_pow_inv (uint32_t n, int e, float y, mpfr_rnd_t rnd)
   mpfr_ui_div (yy, 1, yy, MPFR_RNDN);
   int inex = mpfr_pow (yy, zz, yy, rnd);
 #pragma omp atomic update
-  calls_mpfr_pow ++;
+  calls_eval ++;
   mpfr_subnormalize (yy, inex, rnd);
   float ret = mpfr_get_flt (yy, MPFR_RNDN);
   mpfr_clear (zz);
@@ -137,10 +167,9 @@ ref_pow_inv (uint32_t n, int e, float y, mpfr_rnd_t rnd)
   return ret;
 }
 
-/* return the smallest x=m*2^e >= Xmin such that 2^-150 <= x^y <= 2^128,
-   where m is the returned value, and e is stored in the 2nd argument */
-static uint32_t
-get_xmin (float y, int *e)
+/* return the smallest x >= Xmin such that 2^-150 <= x^y <= 2^128 */
+static float
+get_xmin (float y)
 {
   mpfr_t x, z, u, yy;
   mpfr_init2 (x, 24);
@@ -154,15 +183,15 @@ get_xmin (float y, int *e)
     mpfr_set_ui_2exp (z, 1, -150, MPFR_RNDN);  /* exact */
     mpfr_pow (x, z, u, MPFR_RNDD);             /* x <= (2^-150)^(1/y) */
 #pragma omp atomic update
-    calls_mpfr_pow ++;
+    calls_eval ++;
     mpfr_pow (z, x, yy, MPFR_RNDZ);
-    calls_mpfr_pow ++;
+    calls_eval ++;
     while (mpfr_cmp_ui_2exp (z, 1, -150) < 0)
     {
       mpfr_nextabove (x);
       mpfr_pow (z, x, yy, MPFR_RNDZ);
 #pragma omp atomic update
-      calls_mpfr_pow ++;
+      calls_eval ++;
     }
   }
   else /* y < 0: z^(1/y) is decreasing */
@@ -171,28 +200,26 @@ get_xmin (float y, int *e)
     mpfr_set_ui_2exp (z, 1, 128, MPFR_RNDN);   /* exact */
     mpfr_pow (x, z, u, MPFR_RNDU);             /* x >= (2^128)^(1/y) */
 #pragma omp atomic update
-    calls_mpfr_pow ++;
+    calls_eval ++;
     mpfr_pow (z, x, yy, MPFR_RNDZ);
-    calls_mpfr_pow ++;
+    calls_eval ++;
     while (mpfr_cmp_ui_2exp (z, 1, 128) >= 0)
     {
       mpfr_nextabove (x);
       mpfr_pow (z, x, yy, MPFR_RNDZ);
 #pragma omp atomic update
-      calls_mpfr_pow ++;
+      calls_eval ++;
     }
   }
   mpfr_set_flt (z, Xmin, MPFR_RNDN);
   if (mpfr_cmp (x, z) < 0)
     mpfr_set (x, z, MPFR_RNDN);
-  *e = mpfr_get_exp (x) - 24;
-  mpfr_mul_2si (x, x, -*e, MPFR_RNDN);
-  uint32_t m = mpfr_get_ui (x, MPFR_RNDN);
+  float ret = mpfr_get_flt (x, MPFR_RNDU); /* x might be a subnormal */
   mpfr_clear (x);
   mpfr_clear (yy);
   mpfr_clear (z);
   mpfr_clear (u);
-  return m;
+  return ret;
 }
 
 /* return the smallest 25-bit z such that x^y <= z for Xmin <= x <= Xmax
@@ -208,7 +235,7 @@ get_zmin (float y, int *e)
   mpfr_set_flt (u, y, MPFR_RNDN);           /* exact */
   mpfr_pow (t, t, u, MPFR_RNDU);            /* Xmin^y <= t */
 #pragma omp atomic update
-  calls_mpfr_pow ++;
+  calls_eval ++;
   *e = mpfr_get_exp (t);
   mpfr_mul_2si (t, t, 25 - *e, MPFR_RNDN);
   assert (mpfr_integer_p (t) && mpfr_fits_ulong_p (t, MPFR_RNDN));
@@ -221,8 +248,8 @@ get_zmin (float y, int *e)
 }
 
 /* return the largest x <= Xmax such that 2^-150 <= x^y <= 0x1.ffffffp127f */
-static uint32_t
-get_xmax (float y, int *e)
+static float
+get_xmax (float y)
 {
   mpfr_t x, yy, z, u;
   mpfr_init2 (x, 24);
@@ -237,14 +264,14 @@ get_xmax (float y, int *e)
     mpfr_nextbelow (z);
     mpfr_pow (x, z, u, MPFR_RNDU);            /* 0x1.ffffffp127f^(1/y) <= x */
 #pragma omp atomic update
-    calls_mpfr_pow ++;
+    calls_eval ++;
     mpfr_pow (z, x, yy, MPFR_RNDU);
     while (mpfr_cmp_ui_2exp (z, 0x1ffffff, 103) > 0)
     {
       mpfr_nextbelow (x);
       mpfr_pow (z, x, yy, MPFR_RNDU);
 #pragma omp atomic update
-      calls_mpfr_pow ++;
+      calls_eval ++;
     }
   }
   else /* y < 0 */
@@ -253,27 +280,25 @@ get_xmax (float y, int *e)
     mpfr_set_ui_2exp (z, 1, -150, MPFR_RNDN);  /* exact */
     mpfr_pow (x, z, u, MPFR_RNDD);
 #pragma omp atomic update
-    calls_mpfr_pow ++;
+    calls_eval ++;
     mpfr_pow (z, x, yy, MPFR_RNDD);
     while (mpfr_cmp_ui_2exp (z, 1, -150) < 0)
     {
       mpfr_nextbelow (x);
       mpfr_pow (z, x, yy, MPFR_RNDD);
 #pragma omp atomic update
-      calls_mpfr_pow ++;
+      calls_eval ++;
     }
   }
   mpfr_set_flt (z, Xmax, MPFR_RNDN);
   if (mpfr_cmp (x, z) > 0)
     mpfr_set (x, z, MPFR_RNDN);
-  *e = mpfr_get_exp (x) - 24;
-  mpfr_mul_2si (x, x, -*e, MPFR_RNDN);
-  uint32_t m = mpfr_get_ui (x, MPFR_RNDN);
+  float ret = mpfr_get_flt (x, MPFR_RNDD);
   mpfr_clear (x);
   mpfr_clear (yy);
   mpfr_clear (z);
   mpfr_clear (u);
-  return m;
+  return ret;
 }
 
 /* return the largest 25-bit z such that z <= x^y for Xmin <= x <= Xmax
@@ -289,7 +314,7 @@ get_zmax (float y, int *e)
   mpfr_set_flt (u, y, MPFR_RNDN);             /* exact */
   mpfr_pow (t, t, u, MPFR_RNDD);              /* t <= FLT_MAX^y */
 #pragma omp atomic update
-  calls_mpfr_pow ++;
+  calls_eval ++;
   *e = mpfr_get_exp (t);
   mpfr_mul_2si (t, t, 25 - *e, MPFR_RNDN);
   assert (mpfr_integer_p (t) && mpfr_fits_ulong_p (t, MPFR_RNDN));
@@ -300,190 +325,163 @@ get_zmax (float y, int *e)
   return z;
 }
 
+/* return -1 if f(x,y) < 2^-150, 1 if f(x,y) > 0x1.ffffffp127,
+   and 0 otherwise, where x = asfloat (u), or -asfloat (u) with -neg */
 static int
-get_exp (float x)
-{
-  int e;
-  float y = y;
-  y = frexpf (x, &e);
-  return e;
-}
-
-/* return non-zero if a solution is found */
-static int
-print_sol (float x, float y)
+f_cmp_range (uint32_t u, float y)
 {
-#pragma omp atomic update
-  calls_print_sol ++;
-
-  if (x == 1.0f) /* don't print solutions with x=1 */
-    return 0;
-  mpfr_t xx, yy, zz, tt;
-  int k, found = 0;
+  mpfr_t xx, zz;
   mpfr_init2 (xx, 24);
-  mpfr_init2 (yy, 24);
-  mpfr_init2 (zz, 24 + target_m);
-  mpfr_init2 (tt, 24 + 1);
-  mpfr_set_flt (xx, x, MPFR_RNDN);
-  mpfr_set_flt (yy, y, MPFR_RNDN);
-
-  /* first check if x^y is exact on 25 bits */
-  int ret = mpfr_pow (zz, xx, yy, MPFR_RNDN);
-#pragma omp atomic update
-  calls_mpfr_pow ++;
-  ret = mpfr_set (tt, zz, MPFR_RNDN) || ret;
-  if (ret == 0)
-  {
-#ifdef PRINT_EXACT
-#pragma omp critical
-    {
-      printf ("%a,%a # exact\n", x, y);
-      fflush (stdout);
-      found = 1;
-    }
-#endif
-#pragma omp atomic update
-    nexact ++;
-    goto end;
-  }
-
-  /* check if we have at least target_m identical bits after the round bit */
-  if (mpfr_cmp (tt, zz) != 0)
-    goto end;
-
-  /* if at least target_m identical bits, determine the nb of identical bits */
-  for (k = target_m + 1; ; k++)
-  {
-    mpfr_set_prec (zz, 24 + k);
-    mpfr_pow (zz, xx, yy, MPFR_RNDN);
-#pragma omp atomic update
-    calls_mpfr_pow ++;
-    mpfr_set (tt, zz, MPFR_RNDN);
-    if (mpfr_cmp (tt, zz) != 0)
-      break;
-  }
-#pragma	omp critical
-  {
-    printf ("%a,%a # %d\n", x, y, k - 1);
-    fflush (stdout);
-    found = 1;
-  }
+  mpfr_init2 (zz, 25);
+  mpfr_set_flt (xx, xneg ? -asfloat (u) : asfloat (u), MPFR_RNDN);
+  f_eval (zz, xx, y, MPFR_RNDZ);
 #pragma omp atomic update
-    nsols ++;
- end:
+  calls_eval ++;
+  int ret = (mpfr_cmp_ui_2exp (zz, 1, -150) < 0) ? -1
+    : (mpfr_cmp_ui_2exp (zz, 0x1ffffff, 103) > 0) ? 1 : 0;
   mpfr_clear (xx);
-  mpfr_clear (yy);
   mpfr_clear (zz);
-  mpfr_clear (tt);
-  return found;
+  return ret;
 }
 
-/* return non-zero if a solution is found */
+/* For -rootn and -compound, put in [x0,x1] the range of
+   Xmin <= |x| <= Xmax such that 2^-150 <= f(x,y) <= 0x1.ffffffp127,
+   using the fact that f(x,y) is monotonic in |x|.
+   Return 0 if that range is empty. */
 static int
-print_sol2 (uint32_t x, int e, float y)
+get_xrange (float y, float *x0, float *x1)
 {
-#pragma omp atomic update
-  calls_print_sol ++;
-
-  assert (0x800000 <= x && x < 0x1000000);
-  mpfr_t xx, yy, zz, tt;
-  int k, found = 0;
-  mpfr_init2 (xx, 24);
-  mpfr_init2 (yy, 24);
-  mpfr_init2 (zz, 24 + target_m);
-  mpfr_init2 (tt, 24 + 1);
-  mpfr_set_ui_2exp (xx, x, e, MPFR_RNDN);
-  
-  if (mpfr_cmp_ui (xx, 1) == 0)
-    goto end; /* don't print solutions with x=1 */
-
-  if (mpfr_get_exp (xx) - mpfr_min_prec (xx) < -149)
-    goto end; /* non representable subnormal */
-
-  mpfr_set_flt (yy, y, MPFR_RNDN);
-
-  /* first check if x^y is exact on 25 bits */
-  int ret = mpfr_pow (zz, xx, yy, MPFR_RNDN);
-#pragma omp atomic update
-  calls_mpfr_pow ++;
-  ret = mpfr_set (tt, zz, MPFR_RNDN) || ret;
-  if (ret == 0)
+  float xmax = Xmax;
+  if (xneg && xmax >= 1.0f)
+    xmax = 0x1.fffffep-1f; /* we need x > -1 */
+  /* f(x,y) increases with |x| iff dir = 1 */
+  int dir = (y > 0) != xneg ? 1 : -1;
+  uint32_t a = asuint (Xmin), b = asuint (xmax) + 1, lo, hi;
+  /* find the smallest u in [a,b) such that dir*f_cmp_range(u) >= 0,
+     or b if there is none */
+  while (a < b)
+  {
+    uint32_t c = a + (b - a) / 2;
+    if (dir * f_cmp_range (c, y) >= 0)
+      b = c;
+    else
+      a = c + 1;
+  }
+  lo = a;
+  /* find the smallest u in [lo,xmax] such that dir*f_cmp_range(u) > 0,
+     or xmax+1 if there is none */
+  b = asuint (xmax) + 1;
+  while (a < b)
   {
-#ifdef PRINT_EXACT
-#pragma omp critical
-    {
-      printf ("%a,%a # exact\n", ldexpf (x, e), y);
-      fflush (stdout);
-      found = 1;
-    }
-#endif
-#pragma omp atomic update
-    nexact ++;
-    goto end;
+    uint32_t c = a + (b - a) / 2;
+    if (dir * f_cmp_range (c, y) > 0)
+      b = c;
+    else
+      a = c + 1;
   }
+  if (a == lo)
+    return 0;
+  hi = a - 1;
+  *x0 = asfloat (lo);
+  *x1 = asfloat (hi);
+  return 1;
+}
 
-  /* check if we have at least target_m identical bits after the round bit */
-  if (mpfr_cmp (tt, zz) != 0)
-    goto end;
+static int
+get_exp (float x)
+{
+  int e;
+  float y = y;
+  y = frexpf (x, &e);
+  return e;
+}
 
-  /* if at least target_m identical bits, determine the number of identical
-     bits */
-  for (k = target_m + 1; ; k++)
+/* set d1 and d2 to the first and second derivatives of f(x,y) = b^p,
+   which are b^p*(p/b) and b^p*p*(p-1)/b^2, where fx approximates b^p */
+static void
+pow_deriv (mpfr_t d1, mpfr_t d2, mpfr_t x, mpfr_t fx, float y)
+{
+  mpfr_prec_t p = mpfr_get_prec (d1);
+  mpfr_t yy, base, t;
+  mpfr_init2 (yy, p + 16);
+  mpfr_init2 (base, 256); /* enough for 1+x to be exact */
+  mpfr_init2 (t, p + 16);
+  set_exponent (yy, y); /* exact, except 1/y for -rootn */
+  set_base (base, x);
+  /* the relative error is bounded by (1+theta)^3-1 where 0 <= theta < 2^-p,
+     which is less than 4*theta */
+  mpfr_mul (d1, fx, yy, MPFR_RNDN);
+  mpfr_div (d1, d1, base, MPFR_RNDN);
+  while (1)
   {
-    mpfr_set_prec (zz, 24 + k);
-    mpfr_pow (zz, xx, yy, MPFR_RNDN);
-#pragma omp atomic update
-    calls_mpfr_pow ++;
-    mpfr_set (tt, zz, MPFR_RNDN);
-    if (mpfr_cmp (tt, zz) != 0)
+    int ret = mpfr_sub_ui (t, yy, 1, MPFR_RNDN);
+    if (ret == 0)
       break;
+    mpfr_prec_round (t, 2 * mpfr_get_prec (t), MPFR_RNDN);
   }
-#pragma	omp critical
-  {
-    printf ("%a,%a # %d\n", ldexpf (x, e), y, k - 1);
-    fflush (stdout);
-    found = 1;
-  }
-#pragma omp atomic update
-    nsols ++;
- end:
-  mpfr_clear (xx);
+  /* two more roundings: the relative error is less than 6*theta */
+  mpfr_mul (d2, d1, t, MPFR_RNDN);
+  mpfr_div (d2, d2, base, MPFR_RNDN);
   mpfr_clear (yy);
-  mpfr_clear (zz);
-  mpfr_clear (tt);
-  return found;
+  mpfr_clear (base);
+  mpfr_clear (t);
 }
 
-/* exhaustive search using MPFR from x0 = m0*2^e to x1 = m1*2^e */
-static unsigned long
-search_binade_mpfr (uint32_t m0, uint32_t m1, int e, float y)
+/* The 3rd derivative is b^(p-3)*p*(p-1)*(p-2), which is maximal at the
+   largest base if p >= 3, and at the smallest one otherwise (this also holds
+   for p < 0), where the base increases with |x|, except with -neg. */
+static void
+pow_deriv3 (mpfr_t d3, mpfr_t x0, mpfr_t x1, float y)
 {
-  //  if (y == TRACEY && ldexpf (m0, e) <= TRACEX && TRACEX <= ldexpf (m1, e)) printf ("search_binade_mpfr: m0=%u m1=%u e=%d\n", m0, m1, e);
-  mpfr_t xx, yy, zz, tt;
-  unsigned long calls = 0;
-  mpfr_init2 (xx, 24);
-  mpfr_init2 (yy, 24);
-  mpfr_init2 (zz, 24 + target_m);
-  mpfr_init2 (tt, 24 + 1);
-  mpfr_set_flt (yy, y, MPFR_RNDN);
-  for (uint32_t m = m0; m <= m1; m++)
-  {
-    mpfr_set_ui_2exp (xx, m, e, MPFR_RNDN);
-    mpfr_pow (zz, xx, yy, MPFR_RNDN);
-    calls ++;
-    mpfr_set (tt, zz, MPFR_RNDN);
-    if (mpfr_cmp (tt, zz) == 0)
-      print_sol2 (m, e, y);
-  }
-  mpfr_clear (xx);
+  mpfr_t yy, base;
+  mpfr_init2 (yy, PREC_INV);
+  mpfr_init2 (base, 256);
+  set_exponent (yy, y);
+  int right = (mpfr_cmp_ui (yy, 3) >= 0) != xneg;
+  set_base (base, right ? x1 : x0);
+  f_eval (d3, right ? x1 : x0, y, MPFR_RNDU);
+#pragma omp atomic update
+  calls_eval ++;
+  mpfr_div (d3, d3, base, MPFR_RNDU);
+  mpfr_div (d3, d3, base, MPFR_RNDU);
+  mpfr_div (d3, d3, base, MPFR_RNDU);
+  mpfr_mul (d3, d3, yy, MPFR_RNDU);
+  mpfr_sub_ui (yy, yy, 1, MPFR_RNDA);
+  mpfr_mul (d3, d3, yy, MPFR_RNDA);
+  mpfr_sub_ui (yy, yy, 1, MPFR_RNDA);
+  mpfr_mul (d3, d3, yy, MPFR_RNDA);
+  mpfr_abs (d3, d3, MPFR_RNDA);
   mpfr_clear (yy);
-  mpfr_clear (zz);
-  mpfr_clear (tt);
-#pragma omp atomic update
-  calls_mpfr_pow += calls;
-  return m1 - m0 + 1;
+  mpfr_clear (base);
 }
 
+static int
+pow_xrange (float y, float *xmin, float *xmax)
+{
+  if (mode == MODE_ROOTN || mode == MODE_COMPOUND)
+    return get_xrange (y, xmin, xmax);
+  *xmin = get_xmin (y);
+  *xmax = get_xmax (y);
+  return 1;
+}
+
+/* don't print solutions with x=1 */
+static int
+pow_skip (float x, float y)
+{
+  (void) y;
+  return x == 1.0f;
+}
+
+static const worst_function_t pow_function = {
+  .eval = f_eval,
+  .deriv = pow_deriv,
+  .deriv3 = pow_deriv3,
+  .xrange = pow_xrange,
+  .skip = pow_skip,
+  .print = print_xy,
+};
+
 static void
 check_sol_z (uint32_t n, int e, float y, mpfr_t yy, mpfr_t iy, int target_m)
 {
@@ -497,7 +495,7 @@ check_sol_z (uint32_t n, int e, float y, mpfr_t yy, mpfr_t iy, int target_m)
   mpfr_pow (z2, xx, yy, MPFR_RNDN);
   mpfr_set (tt, z2, MPFR_RNDN);
   if (mpfr_cmp (tt, z2) == 0)
-    print_sol (mpfr_get_flt (xx, MPFR_RNDN), y);
+    worst_print_sol (mpfr_get_flt (xx, MPFR_RNDN), y);
   mpfr_clear (xx);
   mpfr_clear (tt);
   mpfr_clear (z2);
@@ -526,7 +524,7 @@ search_binade_mpfr_z (uint32_t n0, uint32_t n1, int e, float y)
     mpfr_pow (z2, xx, yy, MPFR_RNDN);
     mpfr_set (tt, z2, MPFR_RNDN);
     if (mpfr_cmp (tt, z2) == 0)
-      print_sol (mpfr_get_flt (xx, MPFR_RNDN), y);
+      worst_print_sol (mpfr_get_flt (xx, MPFR_RNDN), y);
 
     calls += 2;
   }
@@ -536,7 +534,7 @@ search_binade_mpfr_z (uint32_t n0, uint32_t n1, int e, float y)
   mpfr_clear (z2);
   mpfr_clear (tt);
 #pragma omp atomic update
-  calls_mpfr_pow += calls;
+  calls_eval += calls;
   return n1 - n0 + 1;
 }
 
@@ -574,138 +572,6 @@ cmp_significand (mpfr_t x, mpfr_t z)
 }
 
 #ifndef USE_MPFR
-/* let f(x) = x^y, x0 = m0*2^e, x1 = m1*2^e.
-   Let a the bits of f(x0) after the round bit,
-   b the bits of f'(x0)*ulp(f(x0)) after the round bit,
-   and c the bits of f''(x0)*ulp(f(x0))^2 after the round bit.
-   Let ea (resp. eb and ec) the maximal error on a (resp. on b and c),
-   and ed the maximal error coming from the 3rd derivative,
-   where the error in ea includes the bound to have at least m
-   identical bits after the round bit.
-   A necessary condition to have at least m identical bits after the
-   round bit for x0+i*ulp(x0) is:
-   |a + i*b + i^2*c| cmod 2^64 < ea + i*eb + i^2*ec + i^3*ed,
-   where 'cmod' means a centered modulus.
-   The return values (a,b,c) are the initial values of the difference table,
-   so that by doing a += b and b += c (in that order) we get in a the next
-   value of a + i*b + i^2*c. More precisely we return (a,b+c,2c).
-   Idem for the return values of (ea,eb,ec,ed): we return
-   (ea,eb+ec+ed,2ec+6ed,6ed).
-   Return -1 if failure.
-  */
-static int
-init_quadratic (uint32_t m0, uint32_t m1, int e, float y,
-                uint64_t *a, uint64_t *b,
-                uint64_t *c, uint64_t *ea, uint64_t *eb, uint64_t *ec,
-                uint64_t *ed)
-{
-  int ret = -1; /* failure */
-  // printf ("init_quadratic m0=%u m1=%u e=%d y=%a\n", m0, m1, e, y);
-  mpfr_t xx, yy, aa, bb, cc, dd;
-  mpfr_init2 (xx, 24);
-  mpfr_init2 (yy, 24);
-  mpfr_init2 (aa, 24 + 1 + 64);
-  mpfr_init2 (bb, 24 + 1 + 64);
-  mpfr_init2 (cc, 100);
-  mpfr_init2 (dd, 24 + 1 + 64);
-  mpfr_set_ui_2exp (xx, m0, e, MPFR_RNDN);
-  mpfr_exp_t exp_x = mpfr_get_exp (xx);
-  mpfr_set_flt (yy, y, MPFR_RNDN);
-  mpfr_pow (aa, xx, yy, MPFR_RNDN); /* err < 1 ulp */
-#pragma omp atomic update
-  calls_mpfr_pow ++;
-  mpfr_set (bb, aa, MPFR_RNDN);     /* err < 1 ulp */
-  mpfr_exp_t exp_a = mpfr_get_exp (aa);
-  if (exp_a < -125) /* subnormal number */
-    exp_a = -125; /* multiply aa below by 2^150 */
-  mpfr_mul_2si (aa, aa, 25 - exp_a, MPFR_RNDN); /* exact */
-  /* now 2^24 <= aa < 2^25 */
-  mpfr_frac (aa, aa, MPFR_RNDN); /* exact */
-  mpfr_mul_2ui (aa, aa, 64, MPFR_RNDN); /* exact */
-  *a = my_mpfr_get_ui (aa, MPFR_RNDN); /* exact */
-  // printf ("a=%lu\n", *a);
-  *ea = 1;
-  /* derivative is x^y*(y/x) */
-  mpfr_mul (bb, bb, yy, MPFR_RNDN);
-  mpfr_div (bb, bb, xx, MPFR_RNDN);
-  mpfr_set (cc, bb, MPFR_RNDN);     /* cc approximates x^y*(y/x) */
-  /* the relative error is bounded by (1+theta)^3-1 where 0 <= theta < 2^(1-p)
-     which is less than 4*theta for p>=3 (here p = 89). */
-  mpfr_exp_t ulp_x = exp_x - 24;
-  mpfr_mul_2si (bb, bb, ulp_x, MPFR_RNDN); /* multiply by ulp(x) */
-  mpfr_mul_2si (bb, bb, 25 - exp_a, MPFR_RNDN); /* scale like aa */
-  mpfr_frac (bb, bb, MPFR_RNDN); /* exact */
-  mpfr_mul_2ui (bb, bb, 64, MPFR_RNDN);
-  *b = my_mpfr_get_ui (bb, MPFR_RNDN); /* exact */
-  // printf ("b=%lu\n", *b);
-  *eb = 2; /* 1 ulp for the rounding to 64 bits, and 4*2^(1-89) for the
-              above roundings */
-  /* 2nd derivative is x^(y-2)*y*(y-1), where we saved x^(y-1)*y in cc */
-#pragma omp atomic update
-  calls_mpfr_pow ++;
-  mpfr_div (cc, cc, xx, MPFR_RNDN);
-  while (1)
-  {
-    int ret = mpfr_sub_ui (aa, yy, 1, MPFR_RNDN);
-    if (ret == 0)
-      break;
-    mpfr_prec_round (aa, 2 * mpfr_get_prec (aa), MPFR_RNDN);
-  }
-  mpfr_mul (cc, cc, aa, MPFR_RNDN);
-  mpfr_mul_2si (cc, cc, 2 * ulp_x, MPFR_RNDN); /* multiply by ulp(x)^2 */
-  mpfr_mul_2si (cc, cc, 25 - exp_a, MPFR_RNDN); /* scale like aa */
-  /* divide by 2 since Taylor expansion is f''(x0)/2 */
-  mpfr_div_2ui (cc, cc, 1, MPFR_RNDN);
-  mpfr_frac (cc, cc, MPFR_RNDN);
-  mpfr_mul_2ui (cc, cc, 64, MPFR_RNDN);
-  *c = my_mpfr_get_ui (cc, MPFR_RNDN);
-  // printf ("c=%lu\n", *c);
-  *ec = 5; /* 1 ulp for mpfr_pow, 1 for each division by xx,
-              1 for the multiply by y, one for the multiply by y-1 */
-  /* 3rd derivative is x^(y-3)*y*(y-1)*(y-2).
-     If y >= 3, it is maximal at x1, otherwise it is maximal at x0
-     (this also holds for y < 0). */
-  mpfr_set_ui_2exp (xx, (y >= 3.0f) ? m1 : m0, e, MPFR_RNDU);
-  mpfr_pow (dd, xx, yy, MPFR_RNDU);
-#pragma omp atomic update
-  calls_mpfr_pow ++;
-  mpfr_div (dd, dd, xx, MPFR_RNDU);
-  mpfr_div (dd, dd, xx, MPFR_RNDU);
-  mpfr_div (dd, dd, xx, MPFR_RNDU);
-  mpfr_mul (dd, dd, yy, MPFR_RNDU);
-  mpfr_sub_ui (yy, yy, 1, MPFR_RNDA);
-  mpfr_mul (dd, dd, yy, MPFR_RNDA);
-  mpfr_sub_ui (yy, yy, 1, MPFR_RNDA);
-  mpfr_mul (dd, dd, yy, MPFR_RNDA);
-  mpfr_abs (dd, dd, MPFR_RNDA);
-  mpfr_mul_2si (dd, dd, 3 * ulp_x, MPFR_RNDA); /* multiply by ulp(x)^3 */
-  mpfr_mul_2si (dd, dd, 25 - exp_a, MPFR_RNDA); /* scale like aa */
-  /* divide by 6 since 3rd term of explicit Taylor expansion is
-     f'''(x0)/3! */
-  mpfr_div_ui (dd, dd, 6, MPFR_RNDA);
-  if (mpfr_cmpabs_ui (dd, 1) >= 0)
-    goto end;
-  mpfr_mul_2ui (dd, dd, 64, MPFR_RNDA);
-  mpfr_abs (dd, dd, MPFR_RNDA);
-  *ed = mpfr_get_ui (dd, MPFR_RNDA);
-  // printf ("ed=%lu\n", *ed);
-  /* add error bound to ea */
-  *ea += (uint64_t) 1 << (64 - target_m);
-  ret = 1;
- end:
-  mpfr_clear (xx);
-  mpfr_clear (yy);
-  mpfr_clear (aa);
-  mpfr_clear (bb);
-  mpfr_clear (cc);
-  mpfr_clear (dd);
-  *b += *c;
-  *c += *c;
-  *eb = *eb + *ec + *ed;
-  *ec = 2 * *ec + 6 * *ed;
-  *ed = 6 * *ed;
-  return ret;
-}
 
 /* return -1 if failure, iy is an approximation of 1/y */
 static int
@@ -728,7 +594,7 @@ init_quadratic_z (uint32_t m0, uint32_t m1, int e, float y,
   int opt = cmp_significand (aa, zz);
   // if (bug) mpfr_printf ("a=%Ra\n", aa);
 #pragma omp atomic update
-  calls_mpfr_pow ++;
+  calls_eval ++;
   mpfr_set (bb, aa, MPFR_RNDN);     /* err < 1 ulp */
   mpfr_exp_t exp_a = mpfr_get_exp (aa);
   mpfr_mul_2si (aa, aa, 24 - exp_a, MPFR_RNDN); /* exact */
@@ -756,7 +622,7 @@ init_quadratic_z (uint32_t m0, uint32_t m1, int e, float y,
               above roundings */
   /* 2nd derivative is z^(iy-2)*iy*(iy-1), where we saved z^iy in cc */
 #pragma omp atomic update
-  calls_mpfr_pow ++;
+  calls_eval ++;
   mpfr_div (cc, cc, zz, MPFR_RNDN);
   while (1)
   {
@@ -785,7 +651,7 @@ init_quadratic_z (uint32_t m0, uint32_t m1, int e, float y,
   mpfr_set_ui_2exp (zz, (cmp) ? m1 : m0, e, MPFR_RNDA);
   mpfr_pow (dd, zz, iy, MPFR_RNDA);
 #pragma omp atomic update
-  calls_mpfr_pow ++;
+  calls_eval ++;
   mpfr_div (dd, dd, zz, MPFR_RNDA);
   mpfr_div (dd, dd, zz, MPFR_RNDA);
   mpfr_div (dd, dd, zz, MPFR_RNDA);
@@ -835,53 +701,6 @@ init_quadratic_z (uint32_t m0, uint32_t m1, int e, float y,
 #endif
 
 #ifndef USE_MPFR
-/* Use a quadratic approximation a + b*i + c*i^2,
-   with error bounded by ea + eb*i + ec*i^2 + ed*i^3.
-   Return 0 in case of failure, otherwise return the number m1-m0+1 of values
-   checked. */
-static unsigned long
-search_binade_quadratic (uint32_t m0, uint32_t m1, int e, float y)
-{
-  // int bug = y == TRACEY && ldexpf (m0, e) <= TRACEX && TRACEX <= ldexpf (m1, e);
-  // if (bug) printf ("search_binade_quadratic: m0=%u m1=%u e=%d\n", m0, m1, e);
-  uint64_t a, b, c, ea, eb, ec, ed;
-  int ret = init_quadratic (m0, m1, e, y, &a, &b, &c, &ea, &eb, &ec, &ed);
-  if (ret == -1)
-    return 0;
-  // if (bug) printf ("m0=%u m1=%u e=%d y=%a a=%lu b=%lu c=%lu ea=%lu eb=%lu ec=%lu ed=%lu\n", m0, m1, e, y, a, b, c, ea, eb, ec, ed);
-  //  uint32_t last_init = m0;
-  for (uint32_t m = m0; m <= m1; )
-  {
-    /* check if a cmod 2^64 < ea */
-    // if (y == TRACEY && ldexpf (m, e) == TRACEX) printf ("last_init=%u m=%u\n", last_init, m);
-    if (a + ea <= ea + ea)
-      print_sol2 (m, e, y);
-    m ++;
-    if (m > m1)
-      break;
-    a += b;
-    b += c;
-    if (ea > (1ul << 53))
-    {
-    recompute:
-      ret = init_quadratic (m, m1, e, y, &a, &b, &c, &ea, &eb, &ec, &ed);
-      if (ret == -1)
-        return 0;
-      // last_init = m;
-      continue;
-    }
-    assert (ea + eb >= ea);
-    ea += eb;
-    if (ea > 0x8000000000000000ul)
-      goto recompute;
-    assert (eb + ec >= eb);
-    eb += ec;
-    assert (ec + ed >= ec);
-    ec += ed;
-  }
-  return m1 - m0 + 1;
-}
-
 /* Use a quadratic approximation a + b*i + c*i^2,
    with error bounded by ea + eb*i + ec*i^2 + ed*i^3.
    Return 0 in case of failure, otherwise return the number m1-m0+1 of values
@@ -891,49 +710,56 @@ search_binade_quadratic_z (uint32_t m0, uint32_t m1, int e, float y)
 {
   // int bug = y == TRACEY && e == TRACEE && m0 <= TRACEZ && TRACEZ <= m1;
   // if (bug) printf ("search_binade_quadratic_z m0=%u m1=%u e=%d\n", m0, m1, e);
-  uint64_t a, b, c, ea, eb, ec, ed;
+  worst_quad_t q;
   mpfr_t yy, iy;
   mpfr_init2 (yy, 24);
   mpfr_init2 (iy, PREC_INV);
   mpfr_set_flt (yy, y, MPFR_RNDN);
   mpfr_ui_div (iy, 1, yy, MPFR_RNDN);
-  int my = init_quadratic_z (m0, m1, e, y, &a, &b, &c, &ea, &eb, &ec, &ed, iy);
+  int my = init_quadratic_z (m0, m1, e, y, &q.a, &q.b, &q.c, &q.ea, &q.eb,
+                         &q.ec, &q.ed, iy);
   // uint32_t last_init = m0;
   if (my == -1)
     goto end;
-  // if (bug) printf ("m0=%u m1=%u a=%lu b=%lu c=%lu ea=%lu eb=%lu ec=%lu ed=%lu\n", m0, m1, a, b, c, ea, eb, ec, ed);
+  // if (bug) printf ("m0=%u m1=%u a=%lu b=%lu c=%lu ea=%lu eb=%lu ec=%lu ed=%lu\n", m0, m1, q.a, q.b, q.c, q.ea, q.eb, q.ec, q.ed);
   for (uint32_t m = m0; m <= m1; )
   {
+#ifdef WORST_SCAN_LANES
+    m = worst_scan_quadratic (m, m1, &q);
+    if (m > m1)
+      break;
+#endif
     /* check if a cmod 2^64 < ea */
-    // if (y == TRACEY && e == TRACEE && m == TRACEZ) printf ("m=%u a=%lu ea=%lu last_init=%u\n", m, a, ea, last_init);
-    if (a + ea <= ea + ea)
+    // if (y == TRACEY && e == TRACEE && m == TRACEZ) printf ("m=%u a=%lu ea=%lu last_init=%u\n", m, q.a, q.ea, last_init);
+    if (q.a + q.ea <= q.ea + q.ea)
       check_sol_z (m, e, y, yy, iy, my);
     m ++;
     if (m > m1)
       break;
-    a += b;
-    b += c;
-    if (ea > (1ul << 53))
+    q.a += q.b;
+    q.b += q.c;
+    if (q.ea > (1ul << 53))
     {
     recompute:
-      my = init_quadratic_z (m, m1, e, y, &a, &b, &c, &ea, &eb, &ec, &ed, iy);
+      my = init_quadratic_z (m, m1, e, y, &q.a, &q.b, &q.c, &q.ea, &q.eb,
+                             &q.ec, &q.ed, iy);
       // last_init = m;
       if (my == -1)
         goto end;
-      // if (y == TRACEY && e == TRACEE && m == 16782902) printf ("m=%u a=%lu b=%lu c=%lu ea=%lu eb=%lu ec=%lu ed=%lu\n", m, a, b, c, ea, eb, ec, ed);
+      // if (y == TRACEY && e == TRACEE && m == 16782902) printf ("m=%u a=%lu b=%lu c=%lu ea=%lu eb=%lu ec=%lu ed=%lu\n", m, q.a, q.b, q.c, q.ea, q.eb, q.ec, q.ed);
       continue;
     }
-    if (ea + eb < ea)
+    if (q.ea + q.eb < q.ea)
       goto recompute;
-    ea += eb;
-    if (ea >= 0x8000000000000000ul) /* ensure ea + ea does not overflow */
+    q.ea += q.eb;
+    if (q.ea >= 0x8000000000000000ul) /* ensure ea + ea does not overflow */
       goto recompute;
-    if (eb + ec < eb)
+    if (q.eb + q.ec < q.eb)
       goto recompute;
-    eb += ec;
-    if (ec + ed < ec)
+    q.eb += q.ec;
+    if (q.ec + q.ed < q.ec)
       goto recompute;
-    ec += ed;
+    q.ec += q.ed;
   }
  end:
   mpfr_clear (yy);
@@ -942,30 +768,6 @@ search_binade_quadratic_z (uint32_t m0, uint32_t m1, int e, float y)
 }
 #endif
 
-/* search m-worst cases of x^y for x0 <= x <= x1, where 2^e <= x^y < 2^(e+1),
-   and x0 = m0*2^e, and x1 = m1*2^e, where z0 = x0^y.
-   x0 and x1 are in the same binade. */
-static void
-search_binade_x (uint32_t m0, uint32_t m1, int e, float y)
-{
-  // if (y == TRACEY && asfloat (n0) <= TRACEX && TRACEX <= asfloat (n1)) printf ("search_binade: x0=%a x1=%a y=%a\n", asfloat (n0), asfloat (n1), y);
-  unsigned long checks;
-#ifdef USE_MPFR
-  checks = search_binade_mpfr (m0, m1, e, y);
-#else
-  if (d == 0)
-    checks = search_binade_mpfr (m0, m1, e, y);
-  else
-  {
-    checks = search_binade_quadratic (m0, m1, e, y);
-    if (checks == 0)
-      checks = search_binade_mpfr (m0, m1, e, y);
-  }
-#endif
-#pragma omp atomic update
-  tot_checks += checks;
-}
-
 static void
 search_binade_z (uint32_t n0, uint32_t n1, int e, float y)
 {
@@ -984,39 +786,6 @@ search_binade_z (uint32_t n0, uint32_t n1, int e, float y)
   tot_checks += checks;
 }
 
-/* search m-worst cases of x^y for x0 <= x <= x1,
-   where x0 = m0*2^e, and x1 = m1*2^e are in the same binade */
-static void
-search_x (uint32_t m0, uint32_t m1, int e, float y)
-{
-  // printf ("enter search x0=%a x1=%a y=%a\n", x0, x1, y);
-  /* first split the input range so that x^y is in the same binade */
-  float z0 = ref_pow (m0, e, y, MPFR_RNDZ);
-  float z1 = ref_pow (m1, e, y, MPFR_RNDZ);
-  int e0 = get_exp (z0);
-  int e1 = get_exp (z1);
-  if (e0 == e1)
-  {
-    search_binade_x (m0, m1, e, y);
-    return;
-  }
-  /* split by dichotomy to find smallest x such that 2^(e0+1) <= x^y */
-  uint32_t a = m0;
-  uint32_t b = m1;
-  while (a + 1 < b)
-  {
-    uint32_t c = (a + b) / 2;
-    float z = ref_pow (c, e, y, MPFR_RNDZ);
-    if (get_exp (z) == e0)
-      a = c;
-    else
-      b = c;
-  }
-  assert (a + 1 == b);
-  search_binade_x (m0, a, e, y);
-  search_x (b, m1, e, y);
-}
-
 static void
 search_z (uint32_t n0, uint32_t n1, int e, float y)
 {
@@ -1054,43 +823,6 @@ search_z (uint32_t n0, uint32_t n1, int e, float y)
   search_z (b, n1, e, y);
 }
 
-/* check worst cases with at least m identical bits after the round bit
-   of x^y, for y = asfloat (n) */
-static void
-doit_x (float y)
-{
-  int emin, emax;
-  uint32_t mmin = get_xmin (y, &emin);
-  // printf ("y=%a mmin=%u emin=%d\n", y, mmin, emin);
-  uint32_t mmax = get_xmax (y, &emax);
-  // printf ("y=%a mmax=%u emax=%d\n", y, mmax, emax);
-  if (verbose)
-    printf ("y=%a xmin=%a xmax=%a\n", y, ldexpf (mmin, emin),
-            ldexpf (mmax, emax));
-  assert (emin < emax || (emin == emax && mmin <= mmax));
-#ifdef COUNT
-  unsigned long count = 0;
-  while (emin < emax)
-  {
-    count += 0x1000000 - mmin;
-    emin ++;
-    mmin = 0x800000;
-  }
-  /* last binade */
-  count += mmax - mmin;
-#pragma omp atomic update
-  tot_checks += count;
-  return;
-#endif
-  while (emin < emax)
-  {
-    search_x (mmin, 0xffffff, emin, y);
-    emin ++;
-    mmin = 0x800000;
-  }
-  /* last binade is maybe incomplete */
-  search_x (mmin, mmax, emin, y);
-}
 
 static void
 doit_z (float y)
@@ -1131,14 +863,13 @@ doit_z (float y)
 }
 
 static void
-doit (uint32_t n)
+doit (float y)
 {
 #ifdef TIME
   int st = cputime ();
 #endif
-  float y = asfloat (n);
   if (inv == 0)
-    doit_x (y);
+    worst_doit_x (y);
   else
     doit_z (y);
 #ifdef TIME
@@ -1150,12 +881,8 @@ doit (uint32_t n)
 int
 main (int argc, char *argv[])
 {
-  /* print command line */
-  printf ("#");
-  for (int i = 0; i < argc; i++)
-    printf (" %s", argv[i]);
-  printf ("\n");
-  fflush (stdout);
+  worst_f = &pow_function;
+  worst_print_args (argc, argv);
 
   /* y>0: for 0 < y < 0x1.3d46d8p-32, x^y = 1 (to nearest) for all binary32 x
      y<0: for -0x1.715478p-32 < y < 0, x^y = 1 for all binary32 x */
@@ -1165,94 +892,64 @@ main (int argc, char *argv[])
   float ymax = 0x1.9fe368p+30f; /* one ulp more since ymax is not treated */
   while (argc >= 2 && argv[1][0] == '-')
   {
-    if (strcmp (argv[1], "-m") == 0)
-    {
-      target_m = atoi (argv[2]);
-      argv += 2;
-      argc -= 2;
-    }
-    else if (strcmp (argv[1], "-d") == 0)
+    int k = worst_option (argc, argv);
+    if (k != 0)
     {
-      d = atoi (argv[2]);
-      assert (d == 0 || d == 2);
-      argv += 2;
-      argc -= 2;
-    }
-    else if (strcmp (argv[1], "-xmin") == 0)
-    {
-      Xmin = strtod (argv[2], NULL);
-      argv += 2;
-      argc -= 2;
-    }
-    else if (strcmp (argv[1], "-xmax") == 0)
-    {
-      Xmax = strtod (argv[2], NULL);
-      argv += 2;
-      argc -= 2;
-    }
-    else if (strcmp (argv[1], "-ymin") == 0)
-    {
-      ymin = strtod (argv[2], NULL);
-      argv += 2;
-      argc -= 2;
-    }
-    else if (strcmp (argv[1], "-ymax") == 0)
-    {
-      ymax = strtod (argv[2], NULL);
-      argv += 2;
-      argc -= 2;
+      argv += k;
+      argc -= k;
+      continue;
     }
-    else if (strcmp (argv[1], "-inv") == 0)
-    {
+    if (strcmp (argv[1], "-inv") == 0)
       inv = 1;
-      argv += 1;
-      argc -= 1;
-    }
-    else if (strcmp (argv[1], "-v") == 0)
-    {
-      verbose ++;
-      argv += 1;
-      argc -= 1;
-    }
+    else if (strcmp (argv[1], "-pown") == 0)
+      mode = MODE_POWN;
+    else if (strcmp (argv[1], "-rootn") == 0)
+      mode = MODE_ROOTN;
+    else if (strcmp (argv[1], "-compound") == 0)
+      mode = MODE_COMPOUND;
     else
     {
       fprintf (stderr, "Error, unknown option %s\n", argv[1]);
       exit (1);
     }
+    argv += 1;
+    argc -= 1;
+  }
+  if (ymin_set)
+    ymin = Ymin;
+  if (ymax_set)
+    ymax = Ymax;
+
+  worst_check_options ();
+  assert (xneg == 0 || mode == MODE_COMPOUND);
+  assert (inv == 0 || mode == MODE_POW || mode == MODE_POWN);
+
+  /* For |x| small, (1+x)^n = 1 + n*x + n*(n-1)/2*x^2 + ..., which has many
+     identical bits after the round bit for all x: such inputs are not
+     interesting, thus we start at 2^-20 by default. */
+  if (mode == MODE_COMPOUND && xmin_set == 0)
+    Xmin = 0x1p-20f;
+
+  if (mode != MODE_POW)
+  {
+    /* integer exponents ymin <= n <= ymax, exactly representable */
+    long n0 = ymin_set ? (long) ymin : 2;
+    long n1 = ymax_set ? (long) ymax : 16;
+    assert (-0x1000000 <= n0 && n0 <= n1 && n1 <= 0x1000000);
+#pragma omp parallel for schedule(dynamic,1)
+    for (long n = n0; n <= n1; n++)
+    {
+      /* skip trivial exponents, and rootn(x,-1) = 1/x, rootn(x,2) = sqrt(x)
+         for which cr_rootnf() relies on a single rounding */
+      if (n == 0 || n == 1 || (mode == MODE_ROOTN && (n == -1 || n == 2)))
+        continue;
+      doit ((float) n);
+    }
+    worst_print_stats ();
+    return 0;
   }
 
-  if (d == -1)
-  {
-    fprintf (stderr, "Error, missing -d option\n");
-    exit (1);
-  }
-
-  assert (0 < target_m && target_m < 64);
-
-  /* ymin and ymax should be of same sign */
-  assert ((ymin > 0 && ymax > 0) || (ymin < 0 && ymax < 0));
-  assert (ymin < ymax);
-  uint32_t nmin, nmax;
-  if (ymin > 0)
-  {
-    nmin = asuint (ymin);
-    nmax = asuint (ymax);
-  }
-  else
-  {
-    nmin = asuint (ymax) + 1;
-    nmax = asuint (ymin) + 1;
-  }
-  assert (nmin < nmax);
-#ifndef COUNT
-#pragma omp parallel for schedule(dynamic,1)
-#else
-#pragma omp parallel for
-#endif
-  for (uint32_t n = nmin; n < nmax; n++)
-    doit (n);
-  /* check y < 0 here */
-  printf ("# tot_checks=%lu\n", tot_checks);
-  printf ("# worst=%lu exact=%lu calls_mpfr_pow=%lu calls_print_sol=%lu\n",
-          nsols, nexact, calls_mpfr_pow, calls_print_sol);
+  worst_for_each_y (ymin, ymax, doit);
+  worst_print_stats ();
+  return 0;
 }
@@ -0,0 +1,48 @@
+/* Correctly-rounded power function x^y = exp(y*log(x)) of two binary32 values.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE. */
+
+#include <mpfr.h>
+#include "fenv_mpfr.h"
+
+/* reference code using MPFR */
+float
+ref_powr (float x, float y)
+{
+  mpfr_ptr xm = ref_var (0, 24);
+  mpfr_ptr ym = ref_var (1, 24);
+  mpfr_ptr zm = ref_var (2, 24);
+  mpfr_set_flt (xm, x, MPFR_RNDN);
+  mpfr_set_flt (ym, y, MPFR_RNDN);
+  /* unlike pow(), powr(1,NaN) is NaN (C23 F.10.4.6), but mpfr_powr()
+     returns 1 as mpfr_pow() */
+  if (mpfr_nan_p (ym))
+  {
+    return y + y;
+  }
+  int inex = mpfr_powr (zm, xm, ym, rnd2[rnd]);
+  mpfr_subnormalize (zm, inex, rnd2[rnd]);
+  float ret = mpfr_get_flt (zm, MPFR_RNDN);
+  return ret;
+}
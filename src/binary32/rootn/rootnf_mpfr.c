@@ -0,0 +1,62 @@
+/* Correctly-rounded n-th root function of a binary32 value.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE. */
+
+#include <mpfr.h>
+#include "fenv_mpfr.h"
+
+/* reference code using MPFR */
+float
+ref_rootn (float x, long long n)
+{
+  mpfr_ptr xm = ref_var (0, 24);
+  mpfr_ptr zm = ref_var (1, 24);
+  mpfr_set_flt (xm, x, MPFR_RNDN);
+  int inex;
+  if (n > 0)
+    inex = mpfr_rootn_si (zm, xm, n, rnd2[rnd]);
+  else
+  {
+    /* mpfr_rootn_si() (at least in MPFR 4.2.2) returns 1 instead of its
+       neighbour below or above for huge negative n and directed roundings,
+       thus we compute 1/rootn(x,-n) with 128 bits instead, which is enough
+       since 1/rootn(x,-n) is either exact, or far from binary32 numbers
+       and midpoints compared to 2^-128 */
+    mpfr_ptr tm;
+    mpfr_exp_t emin = mpfr_get_emin (), emax = mpfr_get_emax ();
+    mpfr_set_emin (mpfr_get_emin_min ());
+    mpfr_set_emax (mpfr_get_emax_max ());
+    tm = ref_var (2, 128);
+    unsigned long m = -(unsigned long) n;
+    mpfr_rootn_ui (tm, xm, m, MPFR_RNDN);
+    mpfr_ui_div (tm, 1, tm, MPFR_RNDN);
+    inex = mpfr_set (zm, tm, rnd2[rnd]);
+    mpfr_set_emin (emin);
+    mpfr_set_emax (emax);
+    inex = mpfr_check_range (zm, inex, rnd2[rnd]);
+  }
+  mpfr_subnormalize (zm, inex, rnd2[rnd]);
+  float ret = mpfr_get_flt (zm, MPFR_RNDN);
+  return ret;
+}
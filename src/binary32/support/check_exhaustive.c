@@ -30,8 +30,32 @@ SOFTWARE.
 #include <stdint.h>
 #include <string.h>
 #include <fenv.h>
+#include <unistd.h>
 #include <omp.h>
 
+/* The loop of doloop() (in function_under_test.h) is written as
+     FOR_EACH_INPUT (n, nmin, nmax) { ... }
+   for the encodings nmin <= n <= nmax: it runs by chunks of 2^CHUNK_BITS
+   consecutive encodings, chunk c being [c*2^CHUNK_BITS, (c+1)*2^CHUNK_BITS),
+   each one with an OpenMP parallel loop.  Only the chunks selected by the
+   --range and --shard options are run, and with --checkpoint the index of
+   the next chunk is saved after each one, so that an interrupted run can be
+   resumed.  doloop() ends with report(), which prints the summary. */
+
+#define CHUNK_BITS 20
+
+typedef struct { uint32_t c, lo, hi; } chunk_t;
+
+static int next_chunk (chunk_t *, uint32_t, uint32_t);
+static void chunk_done (chunk_t *);
+static int report (void);
+
+#define FOR_EACH_INPUT(n, nmin, nmax)                                   \
+  for (chunk_t chunk_ = {0, 0, 0}; next_chunk (&chunk_, nmin, nmax);    \
+       chunk_done (&chunk_))                                            \
+    _Pragma ("omp parallel for schedule(dynamic,1024)")                 \
+    for (uint32_t n = chunk_.lo; n <= chunk_.hi; n++)
+
 #include "function_under_test.h"
 
 float cr_function_under_test (float);
@@ -46,6 +70,39 @@ int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
 int rnd = 0;
 int keep = 0;
 
+/* the encodings range_lo <= n < range_hi of the loop of doloop(), and the
+   chunks c with c mod shard_n = shard_k */
+unsigned long range_lo = 0, range_hi = 1ul << 32;
+uint32_t shard_k = 0, shard_n = 1;
+char *checkpoint = NULL;
+uint32_t first_chunk = 0; /* from the checkpoint */
+unsigned long failures = 0, restored_failures = 0;
+
+/* With --keep, each thread records its failures in its own buffer, without
+   lock nor output in the parallel loop: the buffers are merged and printed
+   (by increasing encoding) at the end of each chunk, before the checkpoint.
+   The number of inputs checked by each thread is kept there too, for the
+   progress line. */
+typedef struct { uint32_t n; float y, z; } failure_t;
+
+typedef struct {
+  failure_t *fail;
+  size_t count, size;
+  unsigned long inputs;
+} __attribute__((aligned(64))) thread_log_t; /* one per cache line */
+
+thread_log_t *logs;
+int nthreads;
+
+/* failures by sign and biased exponent of x (0 for subnormals) */
+unsigned long binade_failures[2][256];
+
+/* progress: selected encodings done and in total, inputs checked, and the
+   start time */
+unsigned long done_encodings = 0, total_encodings = 0, inputs = 0;
+double start_time;
+int progress = 0; /* if stderr is a terminal */
+
 typedef union { uint32_t n; float x; } union_t;
 
 float
@@ -79,12 +136,194 @@ doit (uint32_t n)
   z = cr_function_under_test (x);
   /* Note: the test y != z would not distinguish +0 and -0, instead we compare
      the 32-bit encodings. */
+  thread_log_t *l = logs + omp_get_thread_num ();
+  l->inputs ++;
   if (asuint (y) != asuint (z))
   {
-    printf ("FAIL x=%a ref=%a y=%a\n", x, y, z);
-    fflush (stdout);
-    if (!keep) exit (1);
+    if (!keep)
+    {
+      printf ("FAIL x=%a ref=%a y=%a\n", x, y, z);
+      fflush (stdout);
+      exit (1);
+    }
+    if (l->count == l->size)
+    {
+      l->size = l->size ? 2 * l->size : 1024;
+      l->fail = realloc (l->fail, l->size * sizeof (failure_t));
+      if (l->fail == NULL)
+      {
+        fprintf (stderr, "Error, cannot allocate the failure buffer\n");
+        exit (1);
+      }
+    }
+    l->fail[l->count++] = (failure_t) {n, y, z};
+  }
+}
+
+static int
+cmp_failure (const void *a, const void *b)
+{
+  uint32_t n = ((const failure_t *) a)->n, m = ((const failure_t *) b)->n;
+  return (n > m) - (n < m);
+}
+
+/* print the failures of the threads, and empty their buffers */
+static void
+flush_failures (void)
+{
+  size_t count = 0;
+  for (int t = 0; t < nthreads; t++)
+    count += logs[t].count;
+  failure_t *all = malloc (count * sizeof (failure_t) + 1);
+  if (all == NULL)
+  {
+    fprintf (stderr, "Error, cannot allocate the failures\n");
+    exit (1);
+  }
+  count = 0;
+  for (int t = 0; t < nthreads; t++)
+  {
+    memcpy (all + count, logs[t].fail, logs[t].count * sizeof (failure_t));
+    count += logs[t].count;
+    logs[t].count = 0;
+    inputs += logs[t].inputs;
+    logs[t].inputs = 0;
+  }
+  qsort (all, count, sizeof (failure_t), cmp_failure);
+  for (size_t i = 0; i < count; i++)
+  {
+    printf ("FAIL x=%a ref=%a y=%a\n", asfloat (all[i].n), all[i].y, all[i].z);
+    binade_failures[all[i].n >> 31][(all[i].n >> 23) & 0xff] ++;
   }
+  failures += count;
+  fflush (stdout);
+  free (all);
+}
+
+/* the line of progress, on stderr, rewritten after each chunk */
+static void
+print_progress (void)
+{
+  double t = omp_get_wtime () - start_time;
+  double eta = done_encodings ? t * (total_encodings - done_encodings)
+    / done_encodings : 0;
+  fprintf (stderr, "\r%5.1f%% %lu input(s), %.3g/s, %lu failure(s), ETA %lu:%02lu:%02lu ",
+           total_encodings ? 100.0 * done_encodings / total_encodings : 100.0,
+           inputs, t > 0 ? inputs / t : 0.0, failures, (unsigned long) eta / 3600,
+           (unsigned long) eta / 60 % 60, (unsigned long) eta % 60);
+}
+
+/* The checkpoint file has a single line, which also records the options, so
+   that a run is not resumed with other ones. */
+#define CHECKPOINT_FORMAT "rnd=%d range=%lx:%lx shard=%u/%u next=%u failures=%lu\n"
+
+static void
+read_checkpoint (void)
+{
+  FILE *f = fopen (checkpoint, "r");
+  if (f == NULL)
+    return; /* first run */
+  int r;
+  unsigned long lo, hi;
+  uint32_t k, n;
+  if (fscanf (f, CHECKPOINT_FORMAT, &r, &lo, &hi, &k, &n, &first_chunk,
+              &failures) != 7
+      || r != rnd || lo != range_lo || hi != range_hi || k != shard_k
+      || n != shard_n)
+  {
+    fprintf (stderr, "Error, %s does not match the options\n", checkpoint);
+    exit (1);
+  }
+  fclose (f);
+  restored_failures = failures;
+}
+
+/* write a new file and rename it, so that the checkpoint is never partly
+   written */
+static void
+write_checkpoint (uint32_t next)
+{
+  char tmp[strlen (checkpoint) + 5];
+  sprintf (tmp, "%s.tmp", checkpoint);
+  FILE *f = fopen (tmp, "w");
+  if (f == NULL || fprintf (f, CHECKPOINT_FORMAT, rnd, range_lo, range_hi,
+                            shard_k, shard_n, next, failures) < 0
+      || fclose (f) != 0 || rename (tmp, checkpoint) != 0)
+  {
+    fprintf (stderr, "Error, cannot write %s\n", checkpoint);
+    exit (1);
+  }
+}
+
+/* Set *ch to the next chunk (from ch->c) of the selected ones meeting
+   [nmin, nmax], restricted to them, and return 1, or return 0 if there is
+   none left. */
+static int
+next_chunk (chunk_t *ch, uint32_t nmin, uint32_t nmax)
+{
+  unsigned long lo = range_lo > nmin ? range_lo : nmin;
+  unsigned long hi = range_hi - 1 < nmax ? range_hi - 1 : nmax;
+  if (lo > hi)
+    return 0;
+  unsigned long c = ch->c;
+  if (c < first_chunk)
+    c = first_chunk;
+  if (c < lo >> CHUNK_BITS)
+    c = lo >> CHUNK_BITS;
+  c += (shard_n + shard_k - c % shard_n) % shard_n;
+  if (c > hi >> CHUNK_BITS)
+    return 0;
+  if (total_encodings == 0) /* first call */
+    for (unsigned long d = c; d <= hi >> CHUNK_BITS; d += shard_n)
+    {
+      unsigned long a = d << CHUNK_BITS, b = ((d + 1) << CHUNK_BITS) - 1;
+      total_encodings += (b < hi ? b : hi) - (a > lo ? a : lo) + 1;
+    }
+  ch->c = c;
+  ch->lo = c << CHUNK_BITS > lo ? c << CHUNK_BITS : lo;
+  ch->hi = ((c + 1) << CHUNK_BITS) - 1 < hi ? ((c + 1) << CHUNK_BITS) - 1 : hi;
+  return 1;
+}
+
+static void
+chunk_done (chunk_t *ch)
+{
+  flush_failures ();
+  done_encodings += ch->hi - ch->lo + 1;
+  if (progress)
+    print_progress ();
+  ch->c ++;
+  if (checkpoint != NULL)
+    write_checkpoint (ch->c);
+}
+
+/* Print the failures by binade, or "all ok". */
+static int
+report (void)
+{
+  static const char *name[] = {"rndn", "rndz", "rndu", "rndd"};
+  if (progress)
+    fprintf (stderr, "\n");
+  if (failures == 0)
+  {
+    printf ("all ok\n");
+    return 0;
+  }
+  printf ("%s: %lu failure(s)", name[rnd], failures);
+  if (restored_failures)
+    printf (", %lu before the restart", restored_failures);
+  printf ("\n");
+  for (int s = 0; s < 2; s++)
+    for (int e = 0; e < 256; e++)
+      if (binade_failures[s][e])
+      {
+        if (e == 0)
+          printf ("  %ssubnormal: %lu\n", s ? "-" : "", binade_failures[s][e]);
+        else
+          printf ("  %s[2^%d,2^%d): %lu\n", s ? "-" : "", e - 127, e - 126,
+                  binade_failures[s][e]);
+      }
+  return 0;
 }
 
 int
@@ -122,6 +361,38 @@ main (int argc, char *argv[])
           argc --;
           argv ++;
         }
+      else if (strcmp (argv[1], "--range") == 0 && argc >= 3)
+        {
+          /* --range start:end, for start <= n < end */
+          char *end;
+          range_lo = strtoull (argv[2], &end, 0);
+          if (*end != ':' || (range_hi = strtoull (end + 1, &end, 0),
+                              *end != '\0' || range_hi > 1ul << 32))
+            {
+              fprintf (stderr, "Error, invalid range %s\n", argv[2]);
+              exit (1);
+            }
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--shard") == 0 && argc >= 3)
+        {
+          /* --shard k/N, for the chunks c with c mod N = k */
+          if (sscanf (argv[2], "%u/%u", &shard_k, &shard_n) != 2
+              || shard_k >= shard_n)
+            {
+              fprintf (stderr, "Error, invalid shard %s\n", argv[2]);
+              exit (1);
+            }
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--checkpoint") == 0 && argc >= 3)
+        {
+          checkpoint = argv[2];
+          argc -= 2;
+          argv += 2;
+        }
       else
         {
           fprintf (stderr, "Error, unknown option %s\n", argv[1]);
@@ -129,5 +400,18 @@ main (int argc, char *argv[])
         }
     }
 
+  if (checkpoint != NULL)
+    read_checkpoint ();
+  nthreads = omp_get_max_threads ();
+  logs = aligned_alloc (64, nthreads * sizeof (thread_log_t));
+  if (logs == NULL)
+  {
+    fprintf (stderr, "Error, cannot allocate the thread logs\n");
+    exit (1);
+  }
+  memset (logs, 0, nthreads * sizeof (thread_log_t));
+  progress = isatty (2);
+  start_time = omp_get_wtime ();
+
   return doloop();
 }
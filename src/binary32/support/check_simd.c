@@ -0,0 +1,252 @@
+/* Check the vector variants of a binary32 function against the scalar one.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+/* The vector variants of cr_function_under_test (see simd.h) are called
+   from a "#pragma omp simd" loop, which the compiler must vectorize (the
+   Makefile checks that check_simd.o calls them), on all binary32 inputs,
+   and their results compared bit for bit with those of the scalar function,
+   as compiled for the other checks.  The array version
+   (cr_array_function_under_test) is checked in the same way.
+   The time spent in each loop is also printed, in nanoseconds per call, for
+   all inputs, then for the random inputs used by perf.sh (the array
+   versions send some ranges to the scalar function, which may be a large
+   part of all binary32 numbers but not of the inputs of an application).
+
+   Without -DCHECK_SIMD_CLONES (see the SIMD_CLONES variable of the
+   Makefile), only the array version is checked, for the functions which
+   have no vector variant.
+
+   With -DCOMPARE_LIBMVEC (see the LIBMVEC variable of the Makefile), the
+   same loop also calls the vector variants of the GNU libmvec (those of
+   function_under_test, for example _ZGVdN8v_expf): their time is printed
+   too, with the number of their results which are not correctly rounded (a
+   nan being correct whatever its sign and payload). */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fenv.h>
+#include <omp.h>
+
+#include "simd.h"
+#include "random_under_test.h"
+
+#ifdef CHECK_SIMD_CLONES
+CR_DECLARE_SIMD float cr_function_under_test (float);
+#else
+float cr_function_under_test (float);
+#endif
+void cr_array_function_under_test (float *, const float *, unsigned long);
+#ifdef COMPARE_LIBMVEC
+CR_DECLARE_SIMD float function_under_test (float);
+#endif
+
+int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
+char *rnd_name[] = { "rndn", "rndz", "rndu", "rndd" };
+
+int keep = 0;
+
+#define BLOCK 4096
+
+typedef union { uint32_t n; float x; } union_t;
+
+/* the timings and counts of doblock() */
+enum { SCALAR, SIMD, ARRAY, LIBMVEC, NTIMES };
+static const char *loop_name[NTIMES] = { "scalar", "simd", "array", "libmvec" };
+
+#ifdef COMPARE_LIBMVEC
+/* the encoding n is that of a nan (of any sign and payload) */
+static inline int
+isnan_bits (uint32_t n)
+{
+  return (n & 0x7fffffff) > 0x7f800000;
+}
+#endif
+
+/* compare y[i] to the scalar results z[i] for the inputs x[i] */
+static long
+compare (const union_t *x, const union_t *y, const union_t *z, const char *name)
+{
+  long bad = 0;
+
+  for (int i = 0; i < BLOCK; i++)
+    if (y[i].n != z[i].n)
+      {
+        bad ++;
+#pragma omp critical
+        {
+          printf ("FAIL x=%a scalar=%a %s=%a\n", x[i].x, z[i].x, name, y[i].x);
+          fflush (stdout);
+        }
+        if (!keep) exit (1);
+      }
+  return bad;
+}
+
+/* check the inputs n0 to n0 + BLOCK - 1 in the current rounding mode, add
+   the time spent in each loop to t[], and return the number of differences
+   (for libmvec, the number of incorrect results is added to *wrong) */
+static long
+doblock (uint32_t n0, double t[NTIMES], long *wrong)
+{
+  union_t x[BLOCK], y[BLOCK], z[BLOCK];
+  long bad = 0;
+  double t0, t1;
+
+  for (int i = 0; i < BLOCK; i++)
+    x[i].n = n0 + i;
+  t0 = omp_get_wtime ();
+  for (int i = 0; i < BLOCK; i++)
+    z[i].x = cr_function_under_test (x[i].x);
+  t1 = omp_get_wtime ();
+  t[SCALAR] += t1 - t0;
+#ifdef CHECK_SIMD_CLONES
+#pragma omp simd
+  for (int i = 0; i < BLOCK; i++)
+    y[i].x = cr_function_under_test (x[i].x);
+  t[SIMD] += omp_get_wtime () - t1;
+  bad += compare (x, y, z, loop_name[SIMD]);
+#endif
+  t0 = omp_get_wtime ();
+  cr_array_function_under_test (&y[0].x, &x[0].x, BLOCK);
+  t[ARRAY] += omp_get_wtime () - t0;
+  bad += compare (x, y, z, loop_name[ARRAY]);
+#ifdef COMPARE_LIBMVEC
+  t0 = omp_get_wtime ();
+#pragma omp simd
+  for (int i = 0; i < BLOCK; i++)
+    y[i].x = function_under_test (x[i].x);
+  t[LIBMVEC] += omp_get_wtime () - t0;
+  for (int i = 0; i < BLOCK; i++)
+    *wrong += y[i].n != z[i].n && !(isnan_bits (y[i].n) && isnan_bits (z[i].n));
+#else
+  (void) wrong;
+#endif
+  return bad;
+}
+
+static long
+doloop (int rnd)
+{
+  long bad = 0, wrong = 0;
+  double t[NTIMES] = { 0 };
+
+#pragma omp parallel reduction(+: bad, wrong, t[:NTIMES])
+  {
+    fesetround (rnd1[rnd]);
+#pragma omp for schedule(dynamic,16)
+    for (uint64_t n = 0; n < 0x100000000ul; n += BLOCK)
+      bad += doblock (n, t, &wrong);
+    fesetround (FE_TONEAREST);
+  }
+  printf ("%s: %ld difference(s), ns/call:", rnd_name[rnd], bad);
+  for (int i = 0; i < NTIMES; i++)
+    if (t[i] != 0)
+      printf (" %s %.3f", loop_name[i], 1e9 * t[i] / 0x1p32);
+  printf ("\n");
+#ifdef COMPARE_LIBMVEC
+  printf ("%s: libmvec: %ld incorrect result(s)\n", rnd_name[rnd], wrong);
+#endif
+  return bad;
+}
+
+/* time the loops on the random inputs of perf.sh, in the current
+   rounding mode */
+static void
+doperf (void)
+{
+  enum { N = 1 << 16, REPEAT = 200 };
+  static float x[N], y[N];
+  double t[NTIMES] = { 0 }, t0;
+
+  for (int i = 0; i < N; i++)
+    x[i] = random_under_test ();
+  for (int r = 0; r < REPEAT; r++)
+    {
+      t0 = omp_get_wtime ();
+      for (int i = 0; i < N; i++)
+        y[i] = cr_function_under_test (x[i]);
+      t[SCALAR] += omp_get_wtime () - t0;
+#ifdef CHECK_SIMD_CLONES
+      t0 = omp_get_wtime ();
+#pragma omp simd
+      for (int i = 0; i < N; i++)
+        y[i] = cr_function_under_test (x[i]);
+      t[SIMD] += omp_get_wtime () - t0;
+#endif
+      t0 = omp_get_wtime ();
+      cr_array_function_under_test (y, x, N);
+      t[ARRAY] += omp_get_wtime () - t0;
+#ifdef COMPARE_LIBMVEC
+      t0 = omp_get_wtime ();
+#pragma omp simd
+      for (int i = 0; i < N; i++)
+        y[i] = function_under_test (x[i]);
+      t[LIBMVEC] += omp_get_wtime () - t0;
+#endif
+    }
+  printf ("random inputs, ns/call:");
+  for (int i = 0; i < NTIMES; i++)
+    if (t[i] != 0)
+      printf (" %s %.3f", loop_name[i], 1e9 * t[i] / ((double) N * REPEAT));
+  printf ("\n");
+}
+
+int
+main (int argc, char *argv[])
+{
+  int rnd = -1;
+
+  while (argc >= 2)
+    {
+      if (strcmp (argv[1], "--rndn") == 0)
+        rnd = 0;
+      else if (strcmp (argv[1], "--rndz") == 0)
+        rnd = 1;
+      else if (strcmp (argv[1], "--rndu") == 0)
+        rnd = 2;
+      else if (strcmp (argv[1], "--rndd") == 0)
+        rnd = 3;
+      else if (strcmp (argv[1], "--keep") == 0)
+        keep = 1;
+      else
+        {
+          fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+          exit (1);
+        }
+      argc --;
+      argv ++;
+    }
+
+  long bad = 0;
+  for (int r = 0; r < 4; r++)
+    if (rnd < 0 || rnd == r)
+      bad += doloop (r);
+  doperf ();
+  if (bad == 0)
+    printf ("all ok\n");
+  return bad != 0;
+}
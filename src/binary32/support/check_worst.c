@@ -36,8 +36,17 @@ SOFTWARE.
 
 #include "function_under_test.h"
 
-float cr_function_under_test (float, float);
-float ref_function_under_test (float, float);
+/* type of the second argument: float by default, or long long for functions
+   like pownf() whose second argument is an integer (set from the Makefile) */
+#ifndef TYPE_ARG2
+#define TYPE_ARG2 float
+#endif
+
+#define FORMAT_ARG2(a,b) _Generic ((TYPE_ARG2) 0, long long: a "%lld" b, \
+                                   default: a "%a" b)
+
+float cr_function_under_test (float, TYPE_ARG2);
+float ref_function_under_test (float, TYPE_ARG2);
 int ref_fesetround (int);
 void ref_init (void);
 
@@ -45,7 +54,7 @@ int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
 
 int rnd = 0;
 
-typedef float float2[2];
+typedef struct { float x; TYPE_ARG2 y; } float2;
 
 static void
 readstdin(float2 **result, int *count)
@@ -74,7 +83,7 @@ readstdin(float2 **result, int *count)
       *result = newresult;
     }
     float2 *item = *result + *count;
-    if (sscanf(buf, "%a,%a", &(*item)[0], &(*item)[1]) == 2) {
+    if (sscanf(buf, FORMAT_ARG2("%a,", ""), &item->x, &item->y) == 2) {
       (*count)++;
     }
   }
@@ -101,14 +110,15 @@ doloop(void)
 
 #pragma omp parallel for
   for (int i = 0; i < count; i++) {
-    float x = items[i][0], y = items[i][1];
+    float x = items[i].x;
+    TYPE_ARG2 y = items[i].y;
     ref_init();
     ref_fesetround(rnd);
     float z1 = ref_function_under_test(x, y);
     fesetround(rnd1[rnd]);
     float z2 = cr_function_under_test(x, y);
     if (asuint (z1) != asuint (z2)) {
-      printf("FAIL x=%a y=%a ref=%a z=%a\n", x, y, z1, z2);
+      printf(FORMAT_ARG2("FAIL x=%a y=", " ref=%a z=%a\n"), x, y, z1, z2);
       fflush(stdout);
       exit(1);
     }
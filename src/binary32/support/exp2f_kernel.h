@@ -0,0 +1,120 @@
+/* Shared kernel for the binary32 exponential family.
+
+Copyright (c) 2022 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* The fast paths of expf, exp2f, exp10f, expm1f, exp2m1f, exp10m1f, sinhf,
+   coshf and powf all evaluate 2^(t/16) as 2^(i/16) * 2^(h/16) with i an
+   integer and 0 <= h < 1 (up to the reduction error), using the table
+   2^(j/16) for 0 <= j < 16 and a degree-6 polynomial.
+
+   The table and the polynomial live in a single object, which is defined
+   as a weak symbol: when several of these functions are linked together, a
+   single copy is kept, which spans three cache lines.  Define
+   CORE_MATH_EXP2F_PRIVATE_TABLE to get a private copy per file instead;
+   src/binary32/exp/perf_family.c compares both settings. */
+
+#ifndef CORE_MATH_EXP2F_KERNEL_H
+#define CORE_MATH_EXP2F_KERNEL_H
+
+#include <stdint.h>
+
+typedef struct {
+  double tb[16]; /* 2^(j/16) for 0 <= j < 16 */
+  double c[6];   /* (2^(h/16)-1)/h ~ c[0] + ... + c[5]*h^5 for 0 <= h <= 1 */
+} cr_exp2f_data_t;
+
+#ifdef CORE_MATH_EXP2F_PRIVATE_TABLE
+static
+#else
+__attribute__((weak, visibility("hidden")))
+#endif
+const cr_exp2f_data_t __cr_exp2f_data __attribute__((aligned(64))) = {
+  .tb =
+  {0x1p+0, 0x1.0b5586cf9890fp+0, 0x1.172b83c7d517bp+0, 0x1.2387a6e756238p+0,
+   0x1.306fe0a31b715p+0, 0x1.3dea64c123422p+0, 0x1.4bfdad5362a27p+0, 0x1.5ab07dd485429p+0,
+   0x1.6a09e667f3bcdp+0, 0x1.7a11473eb0187p+0, 0x1.8ace5422aa0dbp+0, 0x1.9c49182a3f09p+0,
+   0x1.ae89f995ad3adp+0, 0x1.c199bdd85529cp+0, 0x1.d5818dcfba487p+0, 0x1.ea4afa2a490dap+0},
+  .c =
+  {0x1.62e42fefa398bp-5, 0x1.ebfbdff84555ap-11, 0x1.c6b08d4ad86d3p-17,
+   0x1.3b2ad1b1716a2p-23, 0x1.5d7472718ce9dp-30, 0x1.4a1d7f457ac56p-37}
+};
+
+/* Reduction for base b: given k16h + k16l ~ 16*log2(b), return ia = floor(a)
+   with a = k16h*z, and set *h to (a - ia) + k16l*z, so that
+   b^z ~ 2^((ia + h)/16).  For b = 2, use cr_exp2f_reduce2() instead. */
+static inline double cr_exp2f_reduce(double z, double k16h, double k16l, double *h){
+  double a = k16h*z, ia = __builtin_floor(a);
+  *h = (a - ia) + k16l*z;
+  return ia;
+}
+
+static inline double cr_exp2f_reduce2(double z, double *h){
+  double a = 16.0*z, ia = __builtin_floor(a);
+  *h = a - ia;
+  return ia;
+}
+
+/* Return 2^(i/16) * 2^(bias-0x3ff): bias is 0x3ff, except for sinhf and
+   coshf which need the halved value. */
+static inline double cr_exp2f_scale(long i, unsigned long bias){
+  long j = i&0xf, e = i - j;
+  e >>= 4;
+  union {double f; uint64_t u;} su = {.u = (e + bias)<<52};
+  return __cr_exp2f_data.tb[j]*su.f;
+}
+
+/* Return an approximation of (2^(h/16)-1)/h. */
+static inline double cr_exp2f_poly(double h){
+  const double *c = __cr_exp2f_data.c;
+  double h2 = h*h;
+  double c0 = c[0] + h*c[1];
+  double c2 = c[2] + h*c[3];
+  double c4 = c[4] + h*c[5];
+  c0 += h2*(c2 + h2*c4);
+  return c0;
+}
+
+/* Return 2^((i+h)/16) * 2^(bias-0x3ff). */
+static inline double cr_exp2f_kernel(long i, double h, unsigned long bias){
+  double s = cr_exp2f_scale(i, bias), w = s*h;
+  return s + w*cr_exp2f_poly(h);
+}
+
+/* Return 2^((i+h)/16) - 1, where the scale s = 2^(i/16) is decremented
+   before the correction term is added. */
+static inline double cr_exp2f_kernel_m1(long i, double h){
+  double s = cr_exp2f_scale(i, 0x3ff), w = s*h;
+  return (s - 1.0) + w*cr_exp2f_poly(h);
+}
+
+/* Hook of cr_math_prefetch() for all the functions using this kernel: read
+   the table and the polynomial.  It is weak like the data, thus with
+   CORE_MATH_EXP2F_PRIVATE_TABLE it only reads one of the private copies. */
+__attribute__((weak)) void cr_exp2f_kernel_prefetch(void){
+  for (unsigned i = 0; i < sizeof (__cr_exp2f_data); i += 64)
+    (void) *((volatile const char *) &__cr_exp2f_data + i);
+}
+
+#endif
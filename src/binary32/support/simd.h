@@ -0,0 +1,103 @@
+/* Vector variants of some binary32 functions.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* When CORE_MATH_SIMD is defined, the functions declared below with
+   CR_DECLARE_SIMD also come with vector variants, following the x86_64
+   vector function ABI (_ZGVbN4v_cr_expf, _ZGVcN8v_cr_expf, _ZGVdN8v_cr_expf
+   and _ZGVeN16v_cr_expf for cr_expf), and a compiler seeing these
+   declarations may call them from a vectorized loop:
+
+     #define CORE_MATH_SIMD
+     #include "simd.h"
+     ...
+     #pragma omp simd
+     for (int i = 0; i < n; i++)
+       y[i] = cr_expf (x[i]);
+
+   compiled with -O3 -fopenmp-simd (the pragma is needed, otherwise the
+   calls are assumed to have side effects preventing vectorization).
+
+   The vector variants and the array versions of a function f are defined
+   in f_simd.c, next to f.c (for example src/binary32/exp/expf_simd.c),
+   which must be compiled with
+   -DCORE_MATH_SIMD -fno-trapping-math -fno-rounding-math -fopenmp-simd, and
+   linked with f.c compiled as usual.  The vector variants come from
+   branch-free versions of the functions (see simd_impl.h), but GCC 12
+   vectorizes them neither when the conversions from float to double are
+   deemed to trap, nor when fma is deemed to read the rounding mode; and
+   with -fno-rounding-math, the scalar functions would not be correctly
+   rounded in the directed rounding modes (GCC evaluates their constant
+   expressions, like the sums giving the results of the exceptions, in
+   round-to-nearest), hence the separate files.  The results are those of
+   the scalar functions, bit for bit and in all rounding modes ("make
+   check_simd" in the directory of the function checks it); only the
+   exception flags may differ.
+
+   Only the variants without a mask ("notinbranch") exist: the calls must
+   not be conditional in the loop.  On other targets than x86_64 (ELF), the
+   functions have no vector variant, only the array versions below.
+
+   When CORE_MATH_LIBMVEC is also defined, the vector variants are also
+   exported under the names of the GNU libmvec (_ZGVdN8v_expf for
+   _ZGVdN8v_cr_expf, and so on), which GCC calls when it vectorizes a loop
+   calling expf with -Ofast (or -O3 -ffast-math -fopenmp-simd): an
+   existing program linked with these objects before -lmvec gets the
+   correctly rounded variants instead. */
+
+#ifndef CORE_MATH_SIMD_H
+#define CORE_MATH_SIMD_H
+
+#if defined(CORE_MATH_SIMD) && defined(__x86_64__) && defined(__ELF__)
+#if defined(__GNUC__) && !defined(__clang__)
+#define CR_DECLARE_SIMD __attribute__((simd("notinbranch")))
+#else
+#define CR_DECLARE_SIMD _Pragma("omp declare simd notinbranch")
+#endif
+#else
+#define CR_DECLARE_SIMD
+#endif
+
+CR_DECLARE_SIMD float cr_expf (float);
+CR_DECLARE_SIMD float cr_logf (float);
+CR_DECLARE_SIMD float cr_log2f (float);
+CR_DECLARE_SIMD float cr_log10f (float);
+
+/* Array versions, also defined in the f_simd.c files: y[i] = f(x[i]) for
+   0 <= i < n, where y may be x.  For the functions above, they are loops
+   calling the vector variants.  The others run a vector loop on the
+   generic path and the special cases, and call the scalar function on the
+   remaining elements (see cr_array_f() in simd_impl.h): for log1pf, those
+   with |x| < 2^-5, and for log2p1f and log10p1f, those with
+   |x| < 0x1.6f544cp-6, which have their own polynomials. */
+void cr_expf_array (float *y, const float *x, unsigned long n);
+void cr_logf_array (float *y, const float *x, unsigned long n);
+void cr_log2f_array (float *y, const float *x, unsigned long n);
+void cr_log10f_array (float *y, const float *x, unsigned long n);
+void cr_log1pf_array (float *y, const float *x, unsigned long n);
+void cr_log2p1f_array (float *y, const float *x, unsigned long n);
+void cr_log10p1f_array (float *y, const float *x, unsigned long n);
+
+#endif
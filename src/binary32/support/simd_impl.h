@@ -0,0 +1,125 @@
+/* Helpers for the vector variants and array versions of binary32 functions.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* This file is only included by the files f_simd.c defining the vector
+   variants and the array versions of the functions of simd.h (the user
+   header).
+
+   A function cr_f of simd.h keeps its scalar code in f.c, with its
+   branches, and f_simd.c has a branch-free version __cr_f_simd, where the
+   special cases are computed along the generic path and chosen with
+   cr_sel(): the compiler generates the vector variants of the latter
+   (CR_SIMD_VARIANT), which CR_SIMD_ALIASES_F(f) exports under the names of
+   the vector variants of cr_f, and also under the names of libmvec with
+   CORE_MATH_LIBMVEC.  Branch-free code would be much slower for scalar
+   calls, since it runs all the paths and the selects.
+
+   cr_array_f() helps writing the array versions of the functions which
+   have no branch-free version, see below. */
+
+#ifndef CORE_MATH_SIMD_IMPL_H
+#define CORE_MATH_SIMD_IMPL_H
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__GNUC__) && !defined(__clang__)
+#define CR_SIMD_VARIANT __attribute__((simd("notinbranch")))
+#else
+#define CR_SIMD_VARIANT _Pragma("omp declare simd notinbranch")
+#endif
+
+/* The aliases need the x86_64 vector function ABI and ELF; elsewhere
+   simd.h declares no vector variant. */
+#if defined(__x86_64__) && defined(__ELF__)
+#define CR_SIMD_ALIAS(isa, name, f)                           \
+  ".globl _ZGV" isa "v_" name "\n\t"                          \
+  ".set _ZGV" isa "v_" name ", _ZGV" isa "v___cr_" f "_simd\n\t"
+/* the four variants of a binary32 function, for the SSE4, AVX, AVX2 and
+   AVX-512 ISAs */
+#define CR_SIMD_ALIASES4(name, f)                             \
+  CR_SIMD_ALIAS ("bN4", name, f) CR_SIMD_ALIAS ("cN8", name, f) \
+  CR_SIMD_ALIAS ("dN8", name, f) CR_SIMD_ALIAS ("eN16", name, f)
+#ifdef CORE_MATH_LIBMVEC
+#define CR_SIMD_ALIASES_F(f)                                  \
+  __asm__ (CR_SIMD_ALIASES4 ("cr_" #f, #f) CR_SIMD_ALIASES4 (#f, #f));
+#else
+#define CR_SIMD_ALIASES_F(f) __asm__ (CR_SIMD_ALIASES4 ("cr_" #f, #f));
+#endif
+#else
+#define CR_SIMD_ALIASES_F(f)
+#endif
+
+/* c ? a : b, c being 0 or 1, without branch */
+static inline float
+cr_sel (uint32_t c, float a, float b)
+{
+  union {float f; uint32_t u;} ua = {.f = a}, ub = {.f = b};
+  uint32_t m = -c;
+  ua.u = (ua.u & m) | (ub.u & ~m);
+  return ua.f;
+}
+
+/* cr_array_f() computes y[i] = f(x[i]) for 0 <= i < n (y may be x) by
+   blocks: a first loop, meant to be vectorized, calls fast(x[i], &slow) on
+   all the elements of the block, which is a version of f without branches,
+   only correct when it sets slow to 0; then the (rare) indices with slow
+   set are gathered, and a second loop calls the scalar function f on them
+   only.  Thus the vector loop need not handle the ranges with their own
+   evaluation scheme, and the scalar code does not run for the elements of
+   a block which do not need it.
+
+   fast should be a constant, so that it is inlined; f is the function of
+   f.c, compiled without -fno-rounding-math. */
+
+#define CR_ARRAY_BLOCK 256
+
+static inline void
+cr_array_f (float *y, const float *x, unsigned long n,
+            float (*fast) (float, uint32_t *), float (*f) (float))
+{
+  float xb[CR_ARRAY_BLOCK];
+  uint32_t slow[CR_ARRAY_BLOCK];
+  unsigned short idx[CR_ARRAY_BLOCK];
+
+  for (unsigned long i0 = 0; i0 < n; i0 += CR_ARRAY_BLOCK)
+  {
+    unsigned k = n - i0 < CR_ARRAY_BLOCK ? n - i0 : CR_ARRAY_BLOCK, m = 0;
+    memcpy (xb, x + i0, k * sizeof (float)); // x may be y
+#pragma omp simd
+    for (unsigned i = 0; i < k; i++)
+      y[i0 + i] = fast (xb[i], slow + i);
+    for (unsigned i = 0; i < k; i++)
+    {
+      idx[m] = i;
+      m += slow[i];
+    }
+    for (unsigned i = 0; i < m; i++)
+      y[i0 + idx[i]] = f (xb[idx[i]]);
+  }
+}
+
+#endif
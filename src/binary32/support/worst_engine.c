@@ -0,0 +1,824 @@
+/* Search of worst cases of bivariate binary32 functions.
+
+Copyright (c) 2022 Paul Zimmermann, Inria.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* See worst_engine.h for the interface.  Define COUNT to only count the
+   number of (x,y) pairs to check, PRINT_EXACT to print also the exact cases
+   (otherwise we only count them), USE_MPFR to check all x with MPFR
+   (like -d 0), and CHECK_SIMD to compare worst_scan_quadratic() with the
+   scalar code. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <mpfr.h>
+#include <assert.h>
+#include <omp.h>
+#include <math.h>
+#include "worst_engine.h"
+#ifdef WORST_SCAN_LANES
+#include <immintrin.h>
+#endif
+
+/* precision of the derivatives in init_quadratic() */
+#define PREC_DERIV 128
+
+/* the approximation is recomputed when its error exceeds EA_MAX */
+#define EA_MAX ((uint64_t) 1 << 53)
+
+/* maximal number of values of x for a quadratic approximation */
+#ifndef WINDOW
+#define WINDOW 65536
+#endif
+
+int target_m;
+int d = -1; /* degree of approximating polynomial */
+float Xmin = 0x1p-149f;
+float Xmax = 0x1.fffffep127f;
+float Ymin, Ymax;
+int xmin_set = 0, xmax_set = 0, ymin_set = 0, ymax_set = 0;
+int xneg = 0;
+int verbose = 0;
+
+unsigned long nsols = 0, nexact = 0;
+unsigned long calls_eval = 0;
+unsigned long calls_print_sol = 0;
+unsigned long tot_checks = 0;
+
+const worst_function_t *worst_f;
+
+/* set x to m*2^e, or to -m*2^e with -neg */
+static void
+set_x (mpfr_t x, uint32_t m, int e)
+{
+  mpfr_set_ui_2exp (x, m, e, MPFR_RNDN);
+  if (xneg)
+    mpfr_neg (x, x, MPFR_RNDN);
+}
+
+static void
+print_xy (float x, float y)
+{
+  if (worst_f->print != NULL)
+    worst_f->print (x, y);
+  else
+    printf ("%a,%a", x, y);
+}
+
+/* return f(x,y) rounded according to rnd, with x = m*2^e (or -m*2^e) */
+static float
+ref_eval (uint32_t m, int e, float y, mpfr_rnd_t rnd)
+{
+  mpfr_t xx, zz;
+  mpfr_init2 (xx, 24);
+  mpfr_init2 (zz, 24);
+  set_x (xx, m, e);
+  int inex = worst_f->eval (zz, xx, y, rnd);
+#pragma omp atomic update
+  calls_eval ++;
+  mpfr_subnormalize (zz, inex, rnd);
+  float ret = mpfr_get_flt (zz, MPFR_RNDN);
+  mpfr_clear (xx);
+  mpfr_clear (zz);
+  return ret;
+}
+
+/* write x = m*2^e with 2^23 <= m < 2^24, and return m */
+static uint32_t
+get_m (float x, int *e)
+{
+  int k;
+  float f = frexpf (x, &k);
+  *e = k - 24;
+  return ldexpf (f, 24);
+}
+
+static int
+get_exp (float x)
+{
+  int e;
+  frexpf (x, &e);
+  return e;
+}
+
+/* check if f(x,y) has at least target_m identical bits after the round bit,
+   where x = xx is exact, and if so print (x,y);
+   return non-zero if a solution is found */
+static int
+check_sol (mpfr_t xx, float x, float y)
+{
+  mpfr_t zz, tt;
+  int k, found = 0;
+  mpfr_init2 (zz, 24 + target_m);
+  mpfr_init2 (tt, 24 + 1);
+
+  /* first check if f(x,y) is exact on 25 bits */
+  int ret = worst_f->eval (zz, xx, y, MPFR_RNDN);
+#pragma omp atomic update
+  calls_eval ++;
+  /* values less than 2^-150 round to 0 or 2^-149 whatever their bits */
+  if (mpfr_zero_p (zz) || mpfr_get_exp (zz) <= -150)
+    goto end;
+  ret = mpfr_set (tt, zz, MPFR_RNDN) || ret;
+  if (ret == 0)
+  {
+#ifdef PRINT_EXACT
+#pragma omp critical
+    {
+      print_xy (x, y);
+      printf (" # exact\n");
+      fflush (stdout);
+      found = 1;
+    }
+#endif
+#pragma omp atomic update
+    nexact ++;
+    goto end;
+  }
+
+  /* check if we have at least target_m identical bits after the round bit */
+  if (mpfr_cmp (tt, zz) != 0)
+    goto end;
+
+  /* if at least target_m identical bits, determine the number of identical
+     bits */
+  for (k = target_m + 1; ; k++)
+  {
+    mpfr_set_prec (zz, 24 + k);
+    worst_f->eval (zz, xx, y, MPFR_RNDN);
+#pragma omp atomic update
+    calls_eval ++;
+    mpfr_set (tt, zz, MPFR_RNDN);
+    if (mpfr_cmp (tt, zz) != 0)
+      break;
+  }
+#pragma	omp critical
+  {
+    print_xy (x, y);
+    printf (" # %d\n", k - 1);
+    fflush (stdout);
+    found = 1;
+  }
+#pragma omp atomic update
+  nsols ++;
+ end:
+  mpfr_clear (zz);
+  mpfr_clear (tt);
+  return found;
+}
+
+int
+worst_print_sol (float x, float y)
+{
+#pragma omp atomic update
+  calls_print_sol ++;
+
+  if (worst_f->skip != NULL && worst_f->skip (x, y))
+    return 0;
+  mpfr_t xx;
+  mpfr_init2 (xx, 24);
+  mpfr_set_flt (xx, x, MPFR_RNDN);
+  int found = check_sol (xx, x, y);
+  mpfr_clear (xx);
+  return found;
+}
+
+/* same as worst_print_sol, for x = m*2^e (or -m*2^e with -neg) */
+static int
+print_sol2 (uint32_t m, int e, float y)
+{
+#pragma omp atomic update
+  calls_print_sol ++;
+
+  assert (0x800000 <= m && m < 0x1000000);
+  mpfr_t xx;
+  int found = 0;
+  mpfr_init2 (xx, 24);
+  set_x (xx, m, e);
+
+  if (mpfr_get_exp (xx) - mpfr_min_prec (xx) < -149)
+    goto end; /* non representable subnormal */
+
+  float x = mpfr_get_flt (xx, MPFR_RNDN);
+  if (worst_f->skip != NULL && worst_f->skip (x, y))
+    goto end;
+
+  found = check_sol (xx, x, y);
+ end:
+  mpfr_clear (xx);
+  return found;
+}
+
+/* exhaustive search using MPFR from x0 = m0*2^e to x1 = m1*2^e */
+static unsigned long
+search_binade_mpfr (uint32_t m0, uint32_t m1, int e, float y)
+{
+  mpfr_t xx, zz, tt;
+  unsigned long calls = 0;
+  mpfr_init2 (xx, 24);
+  mpfr_init2 (zz, 24 + target_m);
+  mpfr_init2 (tt, 24 + 1);
+  for (uint32_t m = m0; m <= m1; m++)
+  {
+    set_x (xx, m, e);
+    worst_f->eval (zz, xx, y, MPFR_RNDN);
+    calls ++;
+    mpfr_set (tt, zz, MPFR_RNDN);
+    if (mpfr_cmp (tt, zz) == 0)
+      print_sol2 (m, e, y);
+  }
+  mpfr_clear (xx);
+  mpfr_clear (zz);
+  mpfr_clear (tt);
+#pragma omp atomic update
+  calls_eval += calls;
+  return m1 - m0 + 1;
+}
+
+#ifndef USE_MPFR
+/* assuming |x| < 2^64:
+   if x > 0, return mpfr_get_ui (x)
+   otherwise return 2^64 - mpfr_get_ui (x) */
+static unsigned long
+my_mpfr_get_ui (mpfr_t x, mpfr_rnd_t rnd)
+{
+  if (mpfr_cmp_ui (x, 0) >= 0)
+    return mpfr_get_ui (x, rnd);
+  else
+  {
+    mpfr_t t;
+    mpfr_init2 (t, mpfr_get_prec (x));
+    mpfr_neg (t, x, MPFR_RNDN);
+    unsigned long u = mpfr_get_ui (t, rnd);
+    mpfr_clear (t);
+    return -u;
+  }
+}
+
+/* v being scaled like a in init_quadratic, with a relative error less
+   than 16 ulps, put in *err a bound on the error of round(frac(v)*2^64),
+   and return 0, or return -1 if that error is too large */
+static int
+deriv_error (mpfr_t v, uint64_t *err)
+{
+  if (mpfr_zero_p (v))
+  {
+    *err = 1;
+    return 0;
+  }
+  /* the error on v*2^64 is less than |v|*2^64*16*2^-p < 2^k */
+  long k = mpfr_get_exp (v) + 68 - mpfr_get_prec (v);
+  if (k >= 40)
+    return -1;
+  *err = 1 + ((k <= 0) ? 1 : (uint64_t) 1 << k);
+  return 0;
+}
+
+/* let f(x) = f(x,y), x0 = m0*2^e, x1 = m1*2^e (x0 = -m0*2^e and
+   x1 = -m1*2^e with -neg).
+   Let a the bits of f(x0) after the round bit,
+   b the bits of f'(x0)*ulp(f(x0)) after the round bit,
+   and c the bits of f''(x0)*ulp(f(x0))^2 after the round bit.
+   Let ea (resp. eb and ec) the maximal error on a (resp. on b and c),
+   and ed the maximal error coming from the 3rd derivative,
+   where the error in ea includes the bound to have at least m
+   identical bits after the round bit.
+   A necessary condition to have at least m identical bits after the
+   round bit for x0+i*ulp(x0) is:
+   |a + i*b + i^2*c| cmod 2^64 < ea + i*eb + i^2*ec + i^3*ed,
+   where 'cmod' means a centered modulus.
+   The return values (a,b,c) are the initial values of the difference table,
+   so that by doing a += b and b += c (in that order) we get in a the next
+   value of a + i*b + i^2*c. More precisely we return (a,b+c,2c).
+   Idem for the return values of (ea,eb,ec,ed): we return
+   (ea,eb+ec+ed,2ec+6ed,6ed).
+   Return -1 if failure.
+  */
+static int
+init_quadratic (uint32_t m0, uint32_t m1, int e, float y,
+                uint64_t *a, uint64_t *b,
+                uint64_t *c, uint64_t *ea, uint64_t *eb, uint64_t *ec,
+                uint64_t *ed)
+{
+  int ret = -1; /* failure */
+  mpfr_t xx, x1, fx, aa, bb, cc, dd;
+  mpfr_init2 (xx, 24);
+  mpfr_init2 (x1, 24);
+  mpfr_init2 (fx, PREC_DERIV);
+  mpfr_init2 (aa, 24 + 1 + 64);
+  mpfr_init2 (bb, PREC_DERIV);
+  mpfr_init2 (cc, PREC_DERIV);
+  mpfr_init2 (dd, 64);
+  set_x (xx, m0, e);
+  mpfr_exp_t exp_x = mpfr_get_exp (xx);
+  worst_f->eval (fx, xx, y, MPFR_RNDN); /* err <= 1/2 ulp */
+#pragma omp atomic update
+  calls_eval ++;
+  if (!mpfr_regular_p (fx))
+    goto end;
+  /* err < 1/2 ulp + 2^-39 ulp */
+  mpfr_set (aa, fx, MPFR_RNDN);
+  mpfr_exp_t exp_a = mpfr_get_exp (aa);
+  *ea = 1;
+  if (exp_a < -125) /* subnormal number */
+  {
+    exp_a = -125; /* multiply aa below by 2^150 */
+    *ea = 2; /* aa has then less than 64 bits after the round bit */
+  }
+  mpfr_mul_2si (aa, aa, 25 - exp_a, MPFR_RNDN); /* exact */
+  /* now |aa| < 2^25 */
+  mpfr_frac (aa, aa, MPFR_RNDN); /* exact */
+  mpfr_mul_2ui (aa, aa, 64, MPFR_RNDN); /* exact */
+  *a = my_mpfr_get_ui (aa, MPFR_RNDN);
+  worst_f->deriv (bb, cc, xx, fx, y);
+  if (!mpfr_number_p (bb) || !mpfr_number_p (cc))
+    goto end;
+  if (xneg) /* x decreases when m increases */
+    mpfr_neg (bb, bb, MPFR_RNDN);
+  mpfr_exp_t ulp_x = exp_x - 24;
+  /* multiply by ulp(x), and scale like aa */
+  mpfr_mul_2si (bb, bb, ulp_x + 25 - exp_a, MPFR_RNDN); /* exact */
+  if (deriv_error (bb, eb))
+    goto end;
+  mpfr_frac (bb, bb, MPFR_RNDN); /* exact */
+  mpfr_mul_2ui (bb, bb, 64, MPFR_RNDN);
+  *b = my_mpfr_get_ui (bb, MPFR_RNDN);
+  /* multiply by ulp(x)^2, scale like aa, and divide by 2 since the Taylor
+     expansion is f''(x0)/2 */
+  mpfr_mul_2si (cc, cc, 2 * ulp_x + 25 - exp_a - 1, MPFR_RNDN); /* exact */
+  if (deriv_error (cc, ec))
+    goto end;
+  mpfr_frac (cc, cc, MPFR_RNDN);
+  mpfr_mul_2ui (cc, cc, 64, MPFR_RNDN);
+  *c = my_mpfr_get_ui (cc, MPFR_RNDN);
+  /* bound on the 3rd derivative on [x0,x1] */
+  set_x (x1, m1, e);
+  worst_f->deriv3 (dd, xx, x1, y);
+  if (!mpfr_number_p (dd))
+    goto end;
+  mpfr_abs (dd, dd, MPFR_RNDA);
+  /* multiply by ulp(x)^3, scale like aa */
+  mpfr_mul_2si (dd, dd, 3 * ulp_x + 25 - exp_a, MPFR_RNDA);
+  /* divide by 6 since 3rd term of explicit Taylor expansion is
+     f'''(x0)/3! */
+  mpfr_div_ui (dd, dd, 6, MPFR_RNDA);
+  /* ed is multiplied by 6 below, and added to ec in the main loop: with
+     dd < 2^-8 none of these operations can overflow (this happens for
+     instance for (1+x)^n near x = -1, where the derivatives are huge) */
+  if (mpfr_cmp_ui_2exp (dd, 1, -8) >= 0)
+    goto end;
+  mpfr_mul_2ui (dd, dd, 64, MPFR_RNDA);
+  *ed = mpfr_get_ui (dd, MPFR_RNDA);
+  /* add error bound to ea */
+  *ea += (uint64_t) 1 << (64 - target_m);
+  if (*eb >= (uint64_t) 1 << 56 || *ec >= (uint64_t) 1 << 56)
+    goto end;
+  ret = 1;
+  *b += *c;
+  *c += *c;
+  *eb = *eb + *ec + *ed;
+  *ec = 2 * *ec + 6 * *ed;
+  *ed = 6 * *ed;
+ end:
+  mpfr_clear (xx);
+  mpfr_clear (x1);
+  mpfr_clear (fx);
+  mpfr_clear (aa);
+  mpfr_clear (bb);
+  mpfr_clear (cc);
+  mpfr_clear (dd);
+  return ret;
+}
+
+/* Use a quadratic approximation a + b*i + c*i^2,
+   with error bounded by ea + eb*i + ec*i^2 + ed*i^3,
+   recomputed at most every WINDOW values, since the bound on the 3rd
+   derivative is computed for the next WINDOW values only.
+   Return the number m1-m0+1 of values checked. */
+static unsigned long
+search_binade_quadratic (uint32_t m0, uint32_t m1, int e, float y)
+{
+  worst_quad_t q;
+  uint32_t m = m0;
+  while (m <= m1)
+  {
+    uint32_t end = (m1 - m < WINDOW) ? m1 : m + WINDOW - 1;
+    if (init_quadratic (m, end, e, y, &q.a, &q.b, &q.c, &q.ea, &q.eb, &q.ec,
+                        &q.ed) == -1)
+    {
+      search_binade_mpfr (m, end, e, y);
+      m = end + 1;
+      continue;
+    }
+    uint64_t ea0 = q.ea;
+    while (1)
+    {
+#ifdef WORST_SCAN_LANES
+      m = worst_scan_quadratic (m, end, &q);
+      if (m > end)
+        break;
+#endif
+      /* check if a cmod 2^64 < ea */
+      if (q.a + q.ea <= q.ea + q.ea)
+      {
+        /* if the error bound has grown too much, recompute it from m rather
+           than checking with MPFR: this avoids false positives when f(x,y)
+           stays close to a breakpoint, for example atan2pi(y,x) near 1/2 */
+        if (q.ea / 2 > ea0)
+          break;
+        print_sol2 (m, e, y);
+      }
+      m ++;
+      if (m > end)
+        break;
+      q.a += q.b;
+      q.b += q.c;
+      /* recompute when the error is too large, or would overflow */
+      if (q.ea > EA_MAX || q.ea + q.eb < q.ea || q.eb + q.ec < q.eb
+          || q.ec + q.ed < q.ec)
+        break;
+      q.ea += q.eb;
+      if (q.ea > 0x8000000000000000ul) /* ensure ea + ea does not overflow */
+        break;
+      q.eb += q.ec;
+      q.ec += q.ed;
+    }
+  }
+  return m1 - m0 + 1;
+}
+#endif
+
+#ifdef WORST_SCAN_LANES
+/* The vectors hold the values of a and ea for L = WORST_SCAN_LANES
+   consecutive values of x.  Since a (resp. ea) is a polynomial of degree 2
+   (resp. 3) in x, the values for the next L values of x are obtained with
+   the difference table of step L:
+   a += da, da += L^2*c, and ea += d1, d1 += d2, d2 += L^3*ed.
+   No overflow can occur: we go to the next block only if ea <= 2^53 for
+   all the values of the current one, then eb, ec and ed are less than 2^53
+   at its first value, and all the values of ea up to 4L values ahead, which
+   are involved in the update, are less than 2^62. */
+#define L WORST_SCAN_LANES
+
+#if L == 8
+typedef __m512i vec_t;
+#define vec_load(p) _mm512_loadu_si512 (p)
+#define vec_store(p,v) _mm512_storeu_si512 (p, v)
+#define vec_add(u,v) _mm512_add_epi64 (u, v)
+#define vec_set1(x) _mm512_set1_epi64 (x)
+/* non-zero if for some lane, a cmod 2^64 < ea, or ea > lim */
+static inline int
+vec_stop (vec_t a, vec_t ea, vec_t lim)
+{
+  return _mm512_cmple_epu64_mask (vec_add (a, ea), vec_add (ea, ea))
+    | _mm512_cmpgt_epu64_mask (ea, lim);
+}
+#else
+typedef __m256i vec_t;
+#define vec_load(p) _mm256_loadu_si256 ((__m256i *) (p))
+#define vec_store(p,v) _mm256_storeu_si256 ((__m256i *) (p), v)
+#define vec_add(u,v) _mm256_add_epi64 (u, v)
+#define vec_set1(x) _mm256_set1_epi64x (x)
+/* non-zero if for some lane, a cmod 2^64 < ea, or ea > lim: AVX2 has no
+   unsigned comparison, thus we flip the sign bits (ea and lim are less
+   than 2^63) */
+static inline int
+vec_stop (vec_t a, vec_t ea, vec_t lim)
+{
+  const vec_t sign = vec_set1 (0x8000000000000000ul);
+  vec_t u = _mm256_xor_si256 (vec_add (a, ea), sign);
+  vec_t v = _mm256_xor_si256 (vec_add (ea, ea), sign);
+  vec_t ok = _mm256_andnot_si256 (_mm256_cmpgt_epi64 (ea, lim),
+                                  _mm256_cmpgt_epi64 (u, v));
+  return _mm256_movemask_pd (_mm256_castsi256_pd (ok)) != 0xf;
+}
+#endif
+
+uint32_t
+worst_scan_quadratic (uint32_t m, uint32_t end, worst_quad_t *q)
+{
+  uint64_t a[2 * L], ea[3 * L];
+  if (m + L - 1 > end)
+    return m;
+  /* the values of ea for the first block */
+  uint64_t eb = q->eb, ec = q->ec;
+  ea[0] = q->ea;
+  for (int j = 1; j < 3 * L; j++)
+  {
+    if (j == L && ea[L - 1] > EA_MAX)
+      return m;
+    ea[j] = ea[j - 1] + eb;
+    eb += ec;
+    ec += q->ed;
+  }
+  uint64_t b = q->b;
+  a[0] = q->a;
+  for (int j = 1; j < 2 * L; j++)
+  {
+    a[j] = a[j - 1] + b;
+    b += q->c;
+  }
+  uint64_t da[L], d1[L], d2[L];
+  for (int j = 0; j < L; j++)
+  {
+    da[j] = a[j + L] - a[j];
+    d1[j] = ea[j + L] - ea[j];
+    d2[j] = ea[j + 2 * L] - 2 * ea[j + L] + ea[j];
+  }
+  vec_t va = vec_load (a), vda = vec_load (da);
+  vec_t vea = vec_load (ea), vd1 = vec_load (d1), vd2 = vec_load (d2);
+  const vec_t vc = vec_set1 (L * L * q->c);
+  const vec_t ved = vec_set1 (L * L * L * q->ed);
+  const vec_t lim = vec_set1 (EA_MAX);
+#ifdef CHECK_SIMD
+  worst_quad_t q0 = *q;
+  uint32_t m0 = m;
+#endif
+  while (m + L - 1 <= end && vec_stop (va, vea, lim) == 0)
+  {
+    m += L;
+    va = vec_add (va, vda);
+    vda = vec_add (vda, vc);
+    vea = vec_add (vea, vd1);
+    vd1 = vec_add (vd1, vd2);
+    vd2 = vec_add (vd2, ved);
+  }
+  vec_store (a, va);
+  vec_store (ea, vea);
+  q->a = a[0];
+  q->b = a[1] - a[0];
+  q->ea = ea[0];
+  q->eb = ea[1] - ea[0];
+  q->ec = ea[2] - 2 * ea[1] + ea[0];
+#ifdef CHECK_SIMD
+  /* compare with the scalar code */
+  int stop = 0;
+  for (uint32_t k = m0; k < m + L && k <= end; k++)
+  {
+    int cand = q0.a + q0.ea <= q0.ea + q0.ea || q0.ea > EA_MAX;
+    if (k < m)
+      assert (!cand);
+    else
+      stop |= cand;
+    if (k == m)
+      assert (memcmp (&q0, q, sizeof (worst_quad_t)) == 0);
+    q0.a += q0.b;
+    q0.b += q0.c;
+    q0.ea += q0.eb;
+    q0.eb += q0.ec;
+    q0.ec += q0.ed;
+  }
+  assert (stop || m + L - 1 > end);
+#endif
+  return m;
+}
+#undef L
+#else
+uint32_t
+worst_scan_quadratic (uint32_t m, uint32_t end, worst_quad_t *q)
+{
+  (void) end;
+  (void) q;
+  return m;
+}
+#endif
+
+/* search m-worst cases of f(x,y) for x0 <= x <= x1, where x0 = m0*2^e,
+   and x1 = m1*2^e are in the same binade, and f(x0,y), f(x1,y) too */
+static void
+search_binade_x (uint32_t m0, uint32_t m1, int e, float y)
+{
+  unsigned long checks;
+#ifdef USE_MPFR
+  checks = search_binade_mpfr (m0, m1, e, y);
+#else
+  if (d == 0)
+    checks = search_binade_mpfr (m0, m1, e, y);
+  else
+  {
+    checks = search_binade_quadratic (m0, m1, e, y);
+  }
+#endif
+#pragma omp atomic update
+  tot_checks += checks;
+}
+
+/* search m-worst cases of f(x,y) for x0 <= x <= x1,
+   where x0 = m0*2^e, and x1 = m1*2^e are in the same binade */
+static void
+search_x (uint32_t m0, uint32_t m1, int e, float y)
+{
+  /* first split the input range so that f(x,y) is in the same binade */
+  float z0 = ref_eval (m0, e, y, MPFR_RNDZ);
+  float z1 = ref_eval (m1, e, y, MPFR_RNDZ);
+  int e0 = get_exp (z0);
+  int e1 = get_exp (z1);
+  if (e0 == e1)
+  {
+    search_binade_x (m0, m1, e, y);
+    return;
+  }
+  /* split by dichotomy to find the smallest x such that f(x,y) is not in
+     the binade of f(x0,y), since f(x,y) is monotonic */
+  uint32_t a = m0;
+  uint32_t b = m1;
+  while (a + 1 < b)
+  {
+    uint32_t c = (a + b) / 2;
+    float z = ref_eval (c, e, y, MPFR_RNDZ);
+    if (get_exp (z) == e0)
+      a = c;
+    else
+      b = c;
+  }
+  assert (a + 1 == b);
+  search_binade_x (m0, a, e, y);
+  search_x (b, m1, e, y);
+}
+
+void
+worst_doit_x (float y)
+{
+  float xmin, xmax;
+  if (worst_f->xrange (y, &xmin, &xmax) == 0)
+    return;
+  if (xmin < Xmin)
+    xmin = Xmin;
+  if (xmax > Xmax)
+    xmax = Xmax;
+  if (xmin > xmax)
+    return;
+  int emin, emax;
+  uint32_t mmin = get_m (xmin, &emin);
+  uint32_t mmax = get_m (xmax, &emax);
+  if (verbose)
+    printf ("y=%a xmin=%a xmax=%a\n", y, xmin, xmax);
+  assert (emin < emax || (emin == emax && mmin <= mmax));
+#ifdef COUNT
+  unsigned long count = 0;
+  while (emin < emax)
+  {
+    count += 0x1000000 - mmin;
+    emin ++;
+    mmin = 0x800000;
+  }
+  /* last binade */
+  count += mmax - mmin;
+#pragma omp atomic update
+  tot_checks += count;
+  return;
+#endif
+  while (emin < emax)
+  {
+    search_x (mmin, 0xffffff, emin, y);
+    emin ++;
+    mmin = 0x800000;
+  }
+  /* last binade is maybe incomplete */
+  search_x (mmin, mmax, emin, y);
+}
+
+void
+worst_for_each_y (float ymin, float ymax, void (*doit) (float))
+{
+  /* ymin and ymax should be of same sign */
+  assert ((ymin > 0 && ymax > 0) || (ymin < 0 && ymax < 0));
+  assert (ymin < ymax);
+  uint32_t nmin, nmax;
+  if (ymin > 0)
+  {
+    nmin = asuint (ymin);
+    nmax = asuint (ymax);
+  }
+  else
+  {
+    nmin = asuint (ymax) + 1;
+    nmax = asuint (ymin) + 1;
+  }
+  assert (nmin < nmax);
+#ifndef COUNT
+#pragma omp parallel for schedule(dynamic,1)
+#else
+#pragma omp parallel for
+#endif
+  for (uint32_t n = nmin; n < nmax; n++)
+    doit (asfloat (n));
+}
+
+void
+worst_print_args (int argc, char *argv[])
+{
+  printf ("#");
+  for (int i = 0; i < argc; i++)
+    printf (" %s", argv[i]);
+  printf ("\n");
+  fflush (stdout);
+}
+
+int
+worst_option (int argc, char *argv[])
+{
+  if (strcmp (argv[1], "-neg") == 0)
+    xneg = 1;
+  else if (strcmp (argv[1], "-v") == 0)
+    verbose ++;
+  else if (argc < 3)
+    return 0;
+  else if (strcmp (argv[1], "-m") == 0)
+    target_m = atoi (argv[2]);
+  else if (strcmp (argv[1], "-d") == 0)
+  {
+    d = atoi (argv[2]);
+    assert (d == 0 || d == 2);
+  }
+  else if (strcmp (argv[1], "-xmin") == 0)
+  {
+    Xmin = strtod (argv[2], NULL);
+    xmin_set = 1;
+  }
+  else if (strcmp (argv[1], "-xmax") == 0)
+  {
+    Xmax = strtod (argv[2], NULL);
+    xmax_set = 1;
+  }
+  else if (strcmp (argv[1], "-ymin") == 0)
+  {
+    Ymin = strtod (argv[2], NULL);
+    ymin_set = 1;
+  }
+  else if (strcmp (argv[1], "-ymax") == 0)
+  {
+    Ymax = strtod (argv[2], NULL);
+    ymax_set = 1;
+  }
+  else
+    return 0;
+  return (strcmp (argv[1], "-neg") == 0 || strcmp (argv[1], "-v") == 0)
+    ? 1 : 2;
+}
+
+void
+worst_check_options (void)
+{
+  if (d == -1)
+  {
+    fprintf (stderr, "Error, missing -d option\n");
+    exit (1);
+  }
+  assert (0 < target_m && target_m < 64);
+}
+
+void
+worst_print_stats (void)
+{
+  printf ("# tot_checks=%lu\n", tot_checks);
+  printf ("# worst=%lu exact=%lu calls_eval=%lu calls_print_sol=%lu\n",
+          nsols, nexact, calls_eval, calls_print_sol);
+}
+
+int
+worst_main (int argc, char *argv[], const worst_function_t *f,
+            float ymin, float ymax)
+{
+  worst_f = f;
+  worst_print_args (argc, argv);
+  while (argc >= 2 && argv[1][0] == '-')
+  {
+    int k = worst_option (argc, argv);
+    if (k == 0)
+    {
+      fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+      exit (1);
+    }
+    argv += k;
+    argc -= k;
+  }
+  worst_check_options ();
+  worst_for_each_y (ymin_set ? Ymin : ymin, ymax_set ? Ymax : ymax,
+                    worst_doit_x);
+  worst_print_stats ();
+  return 0;
+}
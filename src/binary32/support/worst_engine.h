@@ -0,0 +1,176 @@
+/* Search of worst cases of bivariate binary32 functions.
+
+Copyright (c) 2022 Paul Zimmermann, Inria.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* The search engine of worst.c, shared by the programs computing the worst
+   cases of bivariate functions (src/binary32/pow/worst.c,
+   src/binary32/atan2/worst.c, ...).
+
+   For each y, it finds the binary32 values x such that f(x,y) has at least
+   m identical bits after the round bit (with -m m), where f is given by a
+   plug-in, a worst_function_t, for x > 0, or x < 0 with -neg.  For each
+   binade of x, and each sub-range of x where f(x,y) stays in the same
+   binade, f is approximated by a degree-2 polynomial in x, whose values are
+   computed with a difference table on 64-bit integers, together with an
+   error bound: the values of x which might have m identical bits are checked
+   with MPFR (see worst_engine.c).
+
+   A plug-in provides f(x,y) and its derivatives with respect to x, and the
+   range of x to consider for a given y.  f(x,y) should be monotonic in x on
+   each binade of x, since the sub-ranges are found by dichotomy.  A program
+   using a plug-in is usually only:
+
+     int main (int argc, char *argv[])
+     {
+       return worst_main (argc, argv, &my_function, ymin, ymax);
+     }
+
+   where [ymin,ymax) is the default range of y; see pow/worst.c for a program
+   with its own options.
+
+   When compiled with AVX2 or AVX-512 (for example with -march=native), the
+   difference table is evaluated for 4 or 8 values of x at once (see
+   worst_scan_quadratic).  Compile with -DCHECK_SIMD to check it against the
+   scalar code. */
+
+#ifndef WORST_ENGINE_H
+#define WORST_ENGINE_H
+
+#include <stdint.h>
+#include <mpfr.h>
+
+typedef struct
+{
+  /* set z to f(x,y) rounded according to rnd, and return the ternary value,
+     like the MPFR functions; x is exact */
+  int (*eval) (mpfr_t z, mpfr_t x, float y, mpfr_rnd_t rnd);
+  /* set d1 and d2 to the first and second derivatives of f(x,y) with respect
+     to x, each with a relative error less than 16 ulps of their precision p
+     (the same for both), given fx, which is f(x,y) rounded to nearest on p
+     bits */
+  void (*deriv) (mpfr_t d1, mpfr_t d2, mpfr_t x, mpfr_t fx, float y);
+  /* set d3 to an upper bound of the absolute value of the third derivative
+     of f(x,y) with respect to x, for x between x0 and x1, which are in the
+     same binade */
+  void (*deriv3) (mpfr_t d3, mpfr_t x0, mpfr_t x1, float y);
+  /* set *xmin and *xmax to the range of |x| to consider for y, and return 0
+     if it is empty; the engine then restricts it to [Xmin,Xmax] (given by
+     -xmin and -xmax) */
+  int (*xrange) (float y, float *xmin, float *xmax);
+  /* if not NULL, return non-zero for the inputs which should not be
+     reported (e.g., x=1 for x^y) */
+  int (*skip) (float x, float y);
+  /* if not NULL, print the input (x,y) (without newline), in the order of
+     the arguments of the function, otherwise print "x,y" */
+  void (*print) (float x, float y);
+} worst_function_t;
+
+/* the options, set by worst_option() */
+extern int target_m;    /* number of identical bits after round bit */
+extern int d;           /* degree of approximating polynomial (0 or 2) */
+extern float Xmin, Xmax; /* range of |x| */
+extern float Ymin, Ymax; /* range of y */
+extern int xmin_set, xmax_set, ymin_set, ymax_set; /* non-zero if given */
+extern int xneg;        /* if non-zero, search x < 0 */
+extern int verbose;
+
+/* the statistics printed by worst_print_stats() */
+extern unsigned long nsols, nexact;
+extern unsigned long calls_eval;      /* number of calls to f->eval */
+extern unsigned long calls_print_sol; /* number of calls to print_sol[2] */
+extern unsigned long tot_checks;
+
+/* the function under consideration */
+extern const worst_function_t *worst_f;
+
+/* If argv[1] is an option of the engine (-m, -d, -xmin, -xmax, -ymin,
+   -ymax, -neg, -v), set it, and return the number of arguments used, else
+   return 0. */
+int worst_option (int argc, char *argv[]);
+
+/* Print the command line as a comment. */
+void worst_print_args (int argc, char *argv[]);
+
+/* Check the options (exit if some are missing). */
+void worst_check_options (void);
+
+/* Check if f(x,y) has at least target_m identical bits after the round bit,
+   and if so, print it; return non-zero if a solution is found. */
+int worst_print_sol (float x, float y);
+
+/* Search the worst cases for y, for |x| in the range given by the
+   plug-in. */
+void worst_doit_x (float y);
+
+/* Call doit(y) in parallel for all binary32 y with ymin <= y < ymax,
+   where ymin and ymax have the same sign. */
+void worst_for_each_y (float ymin, float ymax, void (*doit) (float));
+
+/* The state of the difference table of search_binade_quadratic(): for the
+   current value of x, a is the approximation of the bits after the round bit
+   (scaled by 2^64), and ea a bound on its error, that are updated for the
+   next value of x by a += b, b += c, and ea += eb, eb += ec, ec += ed. */
+typedef struct
+{
+  uint64_t a, b, c, ea, eb, ec, ed;
+} worst_quad_t;
+
+/* Skip the values m, m+1, ... (at most up to end) for which a cmod 2^64 is
+   larger than ea in absolute value, as long as ea <= 2^53, with SIMD
+   instructions if available (AVX2 or AVX-512).  Return the first value not
+   skipped, q being updated for it: the caller then goes on with the scalar
+   code.  Without SIMD instructions, return m. */
+uint32_t worst_scan_quadratic (uint32_t m, uint32_t end, worst_quad_t *q);
+
+/* number of values of x checked at once by worst_scan_quadratic() */
+#if defined(__AVX512F__)
+#define WORST_SCAN_LANES 8
+#elif defined(__AVX2__)
+#define WORST_SCAN_LANES 4
+#endif
+
+/* Print the statistics as comments. */
+void worst_print_stats (void);
+
+/* Generic main program: search the worst cases of f for Ymin <= y < Ymax,
+   by default ymin <= y < ymax. */
+int worst_main (int argc, char *argv[], const worst_function_t *f,
+                float ymin, float ymax);
+
+static inline uint32_t
+asuint (float x)
+{
+  union { uint32_t n; float x; } u = {.x = x};
+  return u.n;
+}
+
+static inline float
+asfloat (uint32_t n)
+{
+  union { uint32_t n; float x; } u = {.n = n};
+  return u.x;
+}
+
+#endif
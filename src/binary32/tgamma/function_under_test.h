@@ -0,0 +1,20 @@
+#define cr_function_under_test cr_tgammaf
+#define ref_function_under_test ref_tgamma
+
+void doit (uint32_t n);
+float asfloat (uint32_t n);
+static inline uint32_t asuint (float f);
+
+static inline int doloop (void)
+{
+  /* tgamma is not defined for negative integers, where the result is NaN */
+  uint32_t nmin = asuint (0x0p0f), nmax = asuint (0x1.fffffep127f);
+  FOR_EACH_INPUT (n, nmin, nmax)
+  {
+    doit (n);
+    float x = -asfloat (n);
+    if (x == 0 || x != __builtin_floorf (x))
+      doit (n | 0x80000000);
+  }
+  return report ();
+}
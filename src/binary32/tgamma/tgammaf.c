@@ -0,0 +1,291 @@
+/* Correctly-rounded true gamma function for binary32 value.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+#include <errno.h>
+#include <fenv.h>
+
+typedef union {float f; uint32_t u;} b32u32_u;
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* The gamma function is computed from the recurrence Gamma(x+1) = x*Gamma(x):
+   writing x = z + m with 1 <= z < 2 and m an integer, we have
+   Gamma(x) = z*(z+1)*...*(z+m-1)*Gamma(z) for m >= 0, and
+   Gamma(x) = Gamma(z)/((z-1)*(z-2)*...*(z+m)) for m < 0,
+   where all factors are exact in double precision. On [1,2] we approximate
+   1/Gamma, which is an entire function, thus much easier to approximate
+   than Gamma itself (degree 14 instead of 22 for the same accuracy). */
+
+/* Return f*(f+1)*...*(f+k-1), with 4 independent products to shorten the
+   dependency chain. All the additions are exact, and there are at most
+   k+3 rounding errors. */
+static inline double
+prod_fast (double f, int k)
+{
+  double q0 = 1.0, q1 = 1.0, q2 = 1.0, q3 = 1.0;
+  for (; k >= 4; k -= 4)
+  {
+    q0 *= f;
+    q1 *= f + 1.0;
+    q2 *= f + 2.0;
+    q3 *= f + 3.0;
+    f += 4.0;
+  }
+  for (; k > 0; k--)
+  {
+    q0 *= f;
+    f += 1.0;
+  }
+  return (q0 * q1) * (q2 * q3);
+}
+
+static inline double muldd(double xh, double xl, double ch, double cl, double *l){
+  double ahlh = ch*xl, alhh = cl*xh, ahhh = ch*xh, ahhl = __builtin_fma(ch, xh, -ahhh);
+  ahhl += alhh + ahlh;
+  ch = ahhh + ahhl;
+  *l = (ahhh - ch) + ahhl;
+  return ch;
+}
+
+static inline double mulddd(double xh, double xl, double ch, double *l){
+  double ahlh = ch*xl, ahhh = ch*xh, ahhl = __builtin_fma(ch, xh, -ahhh);
+  ahhl += ahlh;
+  ch = ahhh + ahhl;
+  *l = (ahhh - ch) + ahhl;
+  return ch;
+}
+
+/* Same as polydd() in powf.c, but with Knuth's 2Sum instead of Fast2Sum,
+   since here |x*(c[i+1] + ...)| can exceed |c[i]|. */
+static __attribute__((noinline)) double polydd(double xh, double xl, int n, const double c[][2], double *l){
+  int i = n-1;
+  double ch = c[i][0], cl = c[i][1];
+  while(--i>=0){
+    ch = muldd(xh,xl,ch,cl,&cl);
+    double th = ch + c[i][0], cp = th - ch, hp = th - cp;
+    double tl = (c[i][0] - cp) + (ch - hp);
+    ch = th;
+    cl += tl + c[i][1];
+  }
+  *l = cl;
+  return ch;
+}
+
+/* Return an approximation of (xh + xl)/(yh + yl), with relative error
+   about 2^-104. */
+static inline double
+divdd (double xh, double xl, double yh, double yl, double *l)
+{
+  double h = xh / yh;
+  double r = __builtin_fma (-h, yh, xh); /* exact */
+  r = __builtin_fma (-h, yl, r + xl);
+  *l = r / yh;
+  return h;
+}
+
+/* Round h + l to binary32, assuming |l| <= ulp(h)/2. We first round h + l
+   to odd on 53 bits, then convert to binary32: since 53 >= 24 + 2, this
+   double rounding is innocuous, for all rounding modes, including when the
+   result is subnormal. */
+static inline float
+dd_to_float (double h, double l)
+{
+  b64u64_u u = {.f = h};
+  if (l != 0 && !(u.u & 1))
+    u.u += ((l > 0) == (h > 0)) ? 1 : -1;
+  return u.f;
+}
+
+static float __attribute__((noinline))
+cr_tgammaf_accurate (float x)
+{
+  /* approximation of 1/Gamma(3/2+t) for |t| <= 1/2, with relative error
+     bounded by 2^-103.2 (the last coefficients only need double precision) */
+  static const double c[][2] = {
+    {0x1.20dd750429b6dp+0, 0x1.1ae3a914fed8p-56},
+    {-0x1.514d3d90584b3p-5, -0x1.f217f14a9604fp-59},
+    {-0x1.0da5a671c048ap-1, -0x1.c2fd1a6350eb5p-58},
+    {0x1.669be41a93895p-3, -0x1.8930f86196845p-57},
+    {0x1.a18540be32ca7p-5, 0x1.cd20ad68ab4bdp-59},
+    {-0x1.5955cc39724a3p-5, 0x1.c921520e93c98p-59},
+    {0x1.b16203e5e344dp-8, 0x1.a5e10d814d8e1p-62},
+    {0x1.15f7f060ff8c2p-9, 0x1.455edf4305d2cp-63},
+    {-0x1.232bd878ffabep-10, -0x1.cc94c1ee7f885p-64},
+    {0x1.3f845ff3a6edbp-13, -0x1.8c335d71c8ef3p-67},
+    {0x1.a963c6a36cac3p-16, 0x1.f356afb82c1f5p-72},
+    {-0x1.d24ca6f39ac58p-17, 0x1.06e551d751e3fp-71},
+    {0x1.216694b7d8eafp-19, 0x1.c321f6ddbdb3ap-73},
+    {0x1.f1b936cb20012p-25, 0x1.2d6ee7696e634p-79},
+    {-0x1.7ed587ef326ddp-24, -0x1.966e66494c9cfp-79},
+    {0x1.25d5da9efbe34p-26, -0x1.c96a3e285fc5ap-81},
+    {-0x1.00033deb57292p-30, 0x1.6651d774c7da9p-84},
+    {-0x1.26b8a316d08bep-32, 0x0p+0}, {0x1.480c1c3841a56p-34, 0x0p+0},
+    {-0x1.19ed23ba4140dp-37, 0x0p+0}, {-0x1.797ea4298a2f9p-44, 0x0p+0},
+    {0x1.7db76e15956fap-43, 0x0p+0}, {-0x1.f6490b9eec9acp-46, 0x0p+0},
+    {0x1.020cf43adf809p-49, 0x0p+0}, {0x1.428347c333581p-53, 0x0p+0}
+  };
+  /* (n-1)! for 1 <= n <= 14, all exact in binary32 */
+  static const float fact[] = {
+    0x1p+0f, 0x1p+0f, 0x1p+1f, 0x1.8p+2f, 0x1.8p+4f, 0x1.ep+6f, 0x1.68p+9f,
+    0x1.3bp+12f, 0x1.3bp+15f, 0x1.626p+18f, 0x1.baf8p+21f, 0x1.308a8p+25f,
+    0x1.c8cfcp+28f, 0x1.7328ccp+32f };
+  double d = x, h, l;
+  b32u32_u t = {.f = x};
+  uint32_t ax = t.u & 0x7fffffff;
+
+  if (ax < 0x31000000u) /* |x| < 2^-29 */
+  {
+    /* Gamma(x) = 1/x - gamma + c1*x + c2*x^2 + O(x^3) */
+    static const double ceul[] = {0x1.2788cfc6fb619p-1, -0x1.6cb90701fbfabp-58};
+    static const double gt[] = {    0x1.fa658c23b1578p-1, -0x1.d0a118f324b63p-1};
+    h = 1.0 / d;
+    l = __builtin_fma (-h, d, 1.0) / d;
+    double u = h - ceul[0], v = ((h - u) - ceul[0]) - ceul[1];
+    l += v + d * (gt[0] + d * gt[1]);
+    h = u + l;
+    l = (u - h) + l;
+    return dd_to_float (h, l);
+  }
+
+  double fl = __builtin_floor (d);
+  if (fl == d && 1.0 <= d && d <= 14.0) /* exact factorials */
+    return fact[(int) d - 1];
+
+  int m = (int) fl - 1; /* x = z + m with 1 <= z < 2 */
+  double z = d - m, ph, pl, qh = 1.0, ql = 0.0;
+  ph = polydd (z - 1.5, 0.0, 25, c, &pl);
+  double f = (m >= 0) ? z : d;
+  for (int k = (m >= 0) ? m : -m; k > 0; k--, f += 1.0)
+    qh = mulddd (qh, ql, f, &ql);
+  if (m >= 0)
+    h = divdd (qh, ql, ph, pl, &l);
+  else
+  {
+    qh = muldd (qh, ql, ph, pl, &ql);
+    h = divdd (1.0, 0.0, qh, ql, &l);
+  }
+  /* normalize h + l */
+  double s = h + l;
+  l = (h - s) + l;
+  return dd_to_float (s, l);
+}
+
+float
+cr_tgammaf (float x)
+{
+  /* approximation of 1/Gamma(3/2+t) for |t| <= 1/2, with relative error
+     bounded by 2^-54.5 */
+  static const double c[] = {
+    0x1.20dd750429b6dp+0, -0x1.514d3d9058425p-5, -0x1.0da5a671c0477p-1,
+    0x1.669be41a9240ap-3, 0x1.a18540be2fe56p-5, -0x1.5955cc389679ep-5,
+    0x1.b16203e759bfdp-8, 0x1.15f7ef5d34355p-9, -0x1.232bd8a32b7a3p-10,
+    0x1.3f84fdd5608c4p-13, 0x1.a963dd4f902ebp-16, -0x1.d2801f03b1bd2p-17,
+    0x1.216a1c993db8bp-19, 0x1.3d613392188cep-24, -0x1.817f741bdf988p-24
+  };
+  b32u32_u t = {.f = x};
+  uint32_t ax = t.u & 0x7fffffff;
+
+  if (__builtin_expect (ax >= 0x7f800000u, 0)) /* NaN or Inf */
+  {
+    if (ax > 0x7f800000u) /* NaN */
+      return x + x;
+    if (t.u >> 31) /* -Inf */
+    {
+      errno = EDOM;
+      feraiseexcept (FE_INVALID);
+      return __builtin_nanf ("-inf");
+    }
+    return x; /* +Inf */
+  }
+
+  /* Gamma(x) > 2^128 for x >= 0x1.18522p+5 */
+  if (__builtin_expect (x >= 0x1.18522p+5f, 0))
+    return 0x1p127f * 0x1p127f;
+
+  double d = x, y;
+  if (__builtin_expect (ax < 0x31000000u, 0)) /* |x| < 2^-29 */
+  {
+    if (ax == 0)
+    {
+      errno = ERANGE;
+      return 1.0f / x; /* pole error: +Inf or -Inf, depending on the sign */
+    }
+    /* Gamma(x) = 1/x - gamma + O(x), where the neglected terms are bounded
+       by 2^-58 relatively to 1/x */
+    y = 1.0 / d - 0x1.2788cfc6fb619p-1;
+    b64u64_u r = {.f = y};
+    if (__builtin_expect (((r.u + 8) & 0xfffffff) <= 16, 0))
+      return cr_tgammaf_accurate (x);
+    return y;
+  }
+
+  double fl = __builtin_floor (d);
+  if (__builtin_expect (d < 0, 0))
+  {
+    if (fl == d) /* negative integer */
+    {
+      errno = EDOM;
+      feraiseexcept (FE_INVALID);
+      return __builtin_nanf ("-");
+    }
+    /* for x < -42, |Gamma(x)| < 2^-151.9: the result underflows, with the
+       sign (-1)^(n+1) of Gamma on (-n-1,-n) */
+    if (x < -42.0f)
+    {
+      int n = -fl - 1.0;
+      float s = (n & 1) ? 0x1p-126f : -0x1p-126f;
+      return s * 0x1p-126f;
+    }
+  }
+
+  int m = (int) fl - 1; /* x = z + m with 1 <= z < 2 */
+  double z = d - m, t1 = z - 1.5, t2 = t1 * t1, t4 = t2 * t2, t8 = t4 * t4;
+  double c0 = c[0] + t1 * c[1], c2 = c[2] + t1 * c[3], c4 = c[4] + t1 * c[5];
+  double c6 = c[6] + t1 * c[7], c8 = c[8] + t1 * c[9], c10 = c[10] + t1 * c[11];
+  double c12 = c[12] + t1 * c[13];
+  c0 += t2 * c2;
+  c4 += t2 * c6;
+  c8 += t2 * c10;
+  c12 += t2 * c[14];
+  c0 += t4 * c4;
+  c8 += t4 * c12;
+  double p = c0 + t8 * c8; /* p approximates 1/Gamma(z) */
+  if (m >= 0)
+    y = prod_fast (z, m) / p;
+  else
+    y = 1.0 / (p * prod_fast (d, -m));
+
+  /* The polynomial approximation and evaluation have a relative error
+     bounded by 2^-51, prod_fast() adds at most 43 + 3 rounding errors, and
+     the division one more. The total relative error is thus less than
+     49*2^-52, i.e., 98 ulps of y. Subnormal results (for x < -35) are
+     always handled by the accurate path. */
+  b64u64_u r = {.f = y};
+  if (__builtin_expect (((r.u + 100) & 0xfffffff) <= 200
+                        || (r.u & 0x7ff0000000000000) < 0x3810000000000000, 0))
+    return cr_tgammaf_accurate (x);
+  return y;
+}
@@ -104,8 +104,10 @@ mul2_1 (double *h_out, double *l_out, double h_in, double l_in, double y)
    * T[i][4] is p[4]
    * T[i][5] is p[5]
    * T[i][6] is the evaluation point (xmid).
+   Each entry takes 64 bytes and the table is aligned on a cache line, thus
+   the fast path reads exactly one cache line of T per call.
 */
-static const double T[256][8] = {
+static const double T[256][8] __attribute__((aligned(64))) = {
   { 0x1.921fb54442d18p+0, /*0x4.6989e4b05fa3p-56,*/ -0x1p+0, -0xe.3605b41a5d07p-52, -0x2.aaaaaaaa26314p-4, -0x1.d02e84f046fbp-28, -0x1.3330337ffdfc1p-4, -0x2.5ca13405c66b6p-12, 0x0p+0 }, /* i=0 73.489 */
   { 0x1.909fb4b44253fp+0, -0x1.00012001e6037p+0, -0xc.00288071475c8p-12, -0x2.aac5ab293276cp-4, -0x9.005461cb2ecep-12, -0x1.3355447aa843dp-4, -0x7.809a8297c2bbcp-12, 0x1.7fffffffebc6fp-8 }, /* i=1 74.13 */
   { 0x1.8f9fb2a990bfbp+0, -0x1.0003200ea64c8p+0, -0x1.400bb85b9a23fp-8, -0x2.aaf5ae7b579bep-4, -0xf.0186b75746918p-12, -0x1.33914cbc551f1p-4, -0xc.8295e5760bb98p-12, 0x2.80000000140e4p-8 }, /* i=2 74.124 */
@@ -381,8 +383,15 @@ static const double pi_lo = 0x1.1a62633145c07p-53;
    The coefficients of degree < LARGE are stored as two double numbers (most
    significant first).
    Generated with:
-   Gen_P_aux(11,128,threshold=64,large=8,verbose=true,slow=1,prec=128). */
-static const double T2[128][DEGREE+LARGE+2] = {
+   Gen_P_aux(11,128,threshold=64,large=8,verbose=true,slow=1,prec=128).
+   This table is only read by the slow path: it is put in a separate section,
+   so that it does not share cache lines with T. */
+#ifdef __ELF__
+#define COLD_TABLE __attribute__((section(".rodata.cold"), aligned(64)))
+#else
+#define COLD_TABLE __attribute__((aligned(64)))
+#endif
+static const double T2[128][DEGREE+LARGE+2] COLD_TABLE = {
   { 0x7.3f7b5c6f3abcp-120, 0x6.aa86b9baf9cab614bp-176, -0x1p+0, -0x4.045deep-104, 0x5.e6990ab0c2dd8p-92, -0x7.40b83a2b1b71454c98p-148, -0x2.aaaaaaaaaaaaap-4, -0xa.aaaae0ef10118e456p-60, 0x1.0160b49131a62p-68, -0x7.963a9045d1a6daedf2p-124, -0x1.3333333333333p-4, -0x6.015892f570086cb23ep-60, 0x4.f0883d2b50248p-52, -0xc.e10e4b3894d2b935c8p-108, -0xb.6db6db6e11cd8p-8, 0x2.bcd79079f2c4abcc19p-60, 0x4.4f35e4ec4bd2p-36, -0x7.c71c9380dc4fcp-8, 0x9.eba442f49964p-24, -0x5.bb98b11f1845p-8, 0x0p+0 }, /* i=0 117.1 */
   { -0x3.0004801239fb4p-8, 0x1.c7305887fe50696224p-64, -0x1.0004801e60e3dp+0, -0x7.023ec56b5ce7e77d04p-56, -0x1.801440e3d9586p-8, -0x6.9ef9beeedeb98a93f8p-64, -0x2.ab16b2941ef82p-4, 0xb.58b641169bbd0d67e8p-60, -0x1.202a33a27b15fp-8, -0x2.6b29211b91f914266p-68, -0x1.33ba46964a456p-4, 0x4.828c4ec205b6156d5ap-60, -0xf.044f1d0a0794p-12, 0x3.3528852e9ea44128f5p-64, -0xb.779131c48b988p-8, 0x2.06e1efb066f0b5a5fdp-60, -0xd.263c033a0cbbp-12, -0x7.d2335f752895p-8, -0xb.d88311b4bd9ep-12, -0x5.c672cfed3749p-8, 0x3p-8 }, /* i=1 115.6 */
   { -0x5.0014d63fc2f6p-8, 0x9.a9afbebc108d40843p-64, -0x1.000c80ea73147p+0, -0x1.603503f2bf69be97eep-56, -0x2.805dcb72fdedep-8, -0x7.ac245975dcd852336p-64, -0x2.abd6e7bd684fcp-4, 0x7.88b3d8f7ca980ee054p-60, -0x1.e0c37ec3b2803p-8, -0x5.22092fe7b71318476cp-64, -0x1.34aac8e3e936fp-4, -0x1.77055e8d9b0c603406p-60, -0x1.913f80fa00244p-8, -0x6.0cc691b2f88cf6cdcap-64, -0xb.8920e8cb460dp-8, 0x2.12732af294d8d7d6fp-60, -0x1.5fce7e060e262p-8, -0x7.e5fdcce61d648p-8, -0x1.3d71c9158346fp-8, -0x5.dc43c52ba8a18p-8, 0x5p-8 }, /* i=2 114.8 */
@@ -777,3 +786,12 @@ cr_acos (double x)
     return u.x/v.x;
   }
 }
+
+/* Hook of cr_math_prefetch(): read the table of the fast path, so that the next calls
+   do not miss in the caches. */
+void
+cr_acos_prefetch (void)
+{
+  for (unsigned i = 0; i < sizeof (T); i += 64)
+    (void) *((volatile const char *) T + i);
+}
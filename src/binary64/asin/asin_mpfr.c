@@ -30,12 +30,10 @@ SOFTWARE. */
 double
 ref_asin (double x)
 {
-  mpfr_t y;
-  mpfr_init2 (y, 53);
+  mpfr_ptr y = ref_var (0, 53);
   mpfr_set_d (y, x, MPFR_RNDN);
   int inex = mpfr_asin (y, y, rnd2[rnd]);
   mpfr_subnormalize (y, inex, rnd2[rnd]);
   double ret = mpfr_get_d (y, MPFR_RNDN);
-  mpfr_clear (y);
   return ret;
 }
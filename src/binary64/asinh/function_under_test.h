@@ -0,0 +1,2 @@
+#define cr_function_under_test cr_asinh
+#define ref_function_under_test ref_asinh
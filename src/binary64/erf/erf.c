@@ -0,0 +1,584 @@
+/* Correctly rounded error function for binary64 values.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+#include "dint.h"
+
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* Add a + b, such that *hi + *lo approximates a + b.
+   Assumes |a| >= |b|.
+   For rounding to nearest, hi + lo = a + b exactly. For directed rounding,
+   |(a+b)-(hi+lo)| <= 2^-105 min(|a+b|,|hi|), see "Note on FastTwoSum with
+   Directed Roundings" by Paul Zimmermann, https://hal.inria.fr/hal-03798376. */
+static inline void
+fast_two_sum (double *hi, double *lo, double a, double b)
+{
+  double e;
+
+  *hi = a + b;
+  e = *hi - a; /* exact */
+  *lo = b - e; /* exact */
+}
+
+/* Add a + b, such that *hi + *lo approximates a + b, without any assumption
+   on a and b (Knuth's 2Sum, exact for rounding to nearest). */
+static inline void
+two_sum (double *hi, double *lo, double a, double b)
+{
+  *hi = a + b;
+  double bp = *hi - a, ap = *hi - bp;
+  *lo = (a - ap) + (b - bp);
+}
+
+// Multiply exactly a and b, such that *hi + *lo = a * b.
+static inline void
+a_mul (double *hi, double *lo, double a, double b)
+{
+  *hi = a * b;
+  *lo = __builtin_fma (a, b, -*hi);
+}
+
+/* Put in (h,l) an approximation of (ch,cl) + z*(h,l),
+   assuming |ch| >= |z*(h+l)|. */
+static inline void
+fma_dd (double *h, double *l, double z, double ch, double cl)
+{
+  double th, tl;
+  a_mul (&th, &tl, *h, z);
+  tl = __builtin_fma (*l, z, tl);
+  fast_two_sum (h, l, ch, th);
+  *l += tl + cl;
+}
+
+/* For 1 <= i <= 47, C[i-1] contains a degree-11 polynomial p(z) approximating
+   erf(x) on [i/8,(i+1)/8], where z = x - (2i+1)/16, thus |z| <= 1/16.
+   The coefficients of degree 0, 1 and 2 are double-double numbers, stored as
+   C[i-1][0]+C[i-1][1], C[i-1][2]+C[i-1][3] and C[i-1][4]+C[i-1][5],
+   the coefficients of degree 3 to 11 are in C[i-1][6] to C[i-1][14].
+   They were obtained with a weighted least-squares fit on Chebyshev nodes
+   (with 200-bit precision), rounding one coefficient at a time starting from
+   degree 0, and refitting the remaining ones.
+   The relative error of p(z) with respect to erf(x) is bounded by 2^-68.56
+   (estimated on 600 points per interval, largest error for i=1). */
+static const double C[47][15] = {
+    {0x1.ac45e37fe2526p-3, 0x1.48d08434caff7p-57, 0x1.16e2d7093cd8cp+0, 0x1.97b7b0580375dp-54, -0x1.a254428ddb452p-3, -0x1.40be4db97bcfbp-57, -0x1.59b3da8e1e178p-2, 0x1.988648fe87b6fp-4, 0x1.803427310fae8p-4, -0x1.09e7bce1c775dp-5, -0x1.516b2069741b5p-6, 0x1.038d2398d4971p-7, 0x1.e19df59478977p-9, -0x1.947dd752dd28ep-10, -0x1.2047760ef9b96p-11},
+    {0x1.5da9f415ff23fp-2, -0x1.a7427eb01de8ep-59, 0x1.05fd3ecbec298p+0, -0x1.f1681ea7a191p-54, -0x1.477c8e7ee733dp-2, -0x1.b84ff558211bep-57, -0x1.1917b60acab74p-2, 0x1.322a728d4e8ebp-3, 0x1.04c50a9cd4afep-4, -0x1.7ce764ea6e7aep-5, -0x1.68aac5a2e4f5ap-7, 0x1.62aa671edae3fp-7, 0x1.6c015110efe8dp-10, -0x1.071b16cf20c69p-9, -0x1.e008d569ef1cdp-14},
+    {0x1.db081ce6e2a48p-2, -0x1.7ff2bcc27f4abp-56, 0x1.dd167c4cf9d2ap-1, 0x1.450b9f885a51bp-55, -0x1.a173acc35a985p-2, 0x1.ebed5e06cde96p-58, -0x1.889a80f4ad958p-3, 0x1.6c2eea0d177c6p-3, 0x1.b0645438ed708p-6, -0x1.a3fd9fc808d9ap-5, 0x1.060b6f81f6f15p-13, 0x1.678b3542dd4abp-7, -0x1.1e027a33a00a1p-10, -0x1.e58937685722p-10, 0x1.53a318c2c244fp-12},
+    {0x1.25b8a88b6dd7fp-1, 0x1.9534249123c1ap-55, 0x1.a5074e215762p-1, 0x1.faedb700eefbdp-56, -0x1.d9a837e5824e4p-2, -0x1.ab24cd2990e2ap-57, -0x1.9c41d1d5fae57p-4, 0x1.75bebc1b18b7bp-3, -0x1.6410ad932ba4dp-7, -0x1.7df8890954fe5p-5, 0x1.4a54815affc0ap-7, 0x1.18f36147e7325p-7, -0x1.8d65be25dd25ap-9, -0x1.35c983a7b895p-10, 0x1.42ab7385ba47cp-11},
+    {0x1.569243d2b3a9bp-1, 0x1.8eefbeb61a1d8p-56, 0x1.681ff24b4ab04p-1, -0x1.dba0f34f3f29ep-58, -0x1.ef2bed2786b25p-2, -0x1.c45d7ce6c6378p-56, -0x1.a4254557d7231p-7, 0x1.532415c2679e3p-3, -0x1.558b4c55a7e8p-5, -0x1.1b7ad5b801406p-5, 0x1.1201d3ba76936p-6, 0x1.2995ebf1712f6p-8, -0x1.0294afcdd7c91p-8, -0x1.160c4f83fdc2bp-12, 0x1.634b4fc39efdcp-11},
+    {0x1.7fb9bfaed8078p-1, 0x1.66d06203a3a62p-56, 0x1.2a8dcede3673bp-1, -0x1.73812dc6b8d77p-56, -0x1.e5267029187cp-2, 0x1.5019859e532c3p-56, 0x1.fe0796bb9d05bp-5, 0x1.0fa23021ad2cfp-3, -0x1.fa21ebca76c9ap-5, -0x1.31546d60ddfadp-6, 0x1.37e5469fc3ea7p-6, 0x1.097dcc3db5106p-13, -0x1.e82aaaedd22fp-9, 0x1.30885675fe209p-11, 0x1.122b8719ec103p-11},
+    {0x1.a1551a16aaeafp-1, 0x1.a55c04d311964p-57, 0x1.dfca26f5bbf88p-2, -0x1.dde0a6f5ba7dbp-57, -0x1.c1cd84866038fp-2, -0x1.9991478a6eb3cp-56, 0x1.e4c9975da0987p-4, 0x1.747e31bf4807cp-4, -0x1.1d1f00109e656p-4, -0x1.476541a50d0fep-9, 0x1.1a817c5a63003p-6, -0x1.cb8a724910da6p-9, -0x1.57b73391cc51cp-9, 0x1.23a72d97740c4p-10, 0x1.f5735c78a8f3p-13},
+    {0x1.bbef0fbde6221p-1, -0x1.322b57b4f93ap-55, 0x1.75a91a7f4d2edp-2, 0x1.6e956405513c5p-58, -0x1.8d03ac274201cp-2, -0x1.38eac111d6569p-61, 0x1.3954778d6a0dfp-3, 0x1.88e0f7b184949p-5, -0x1.0f7c15f75f02fp-4, 0x1.5e22cf9785c9fp-7, 0x1.9ad28c5885b35p-7, -0x1.704e9eb13b0c2p-8, -0x1.23362b8b9725ap-10, 0x1.433f167f3a7f5p-10, -0x1.d8bf3d1d2d353p-15},
+    {0x1.d0580b2cfd249p-1, 0x1.4fcaca5177164p-55, 0x1.1a0dc51a9934dp-2, -0x1.ca9525636a1bep-57, -0x1.4ef05a0f95eebp-2, -0x1.d396cad04e9cbp-57, 0x1.5648b5dc47417p-3, 0x1.40fbaba446576p-7, -0x1.c0db89d0a4fadp-5, 0x1.388c3ebd843c7p-6, 0x1.aecb74775b44p-8, -0x1.8bca3d6e73ceap-8, 0x1.4adbafc1b588p-12, 0x1.0580e71ad922dp-10, -0x1.1741f0226abddp-12},
+    {0x1.df85ea8db188ep-1, -0x1.f71e78a6dc155p-55, 0x1.9cb5bd549b111p-3, -0x1.97557f6b6462bp-59, -0x1.0ed7443f85c33p-2, -0x1.8a83c90dfd0fdp-58, 0x1.5066cda84bba9p-3, -0x1.419fa10b6ec7fp-6, -0x1.3f41761d5a6a2p-5, 0x1.6d1d724b67164p-6, 0x1.e377f568d63cfp-11, -0x1.4cc914a478f2ep-8, 0x1.553edfdbeed76p-10, 0x1.26159ea3e3343p-11, -0x1.6b488b34c761ap-12},
+    {0x1.ea7730ed0bbb9p-1, 0x1.2c5b9b130e72ep-55, 0x1.24a7b84d38971p-3, 0x1.aa0ab3c74f9b9p-57, -0x1.a4b118ef01593p-3, 0x1.fdff87e6f0766p-61, 0x1.319c7a75f9187p-3, -0x1.3db5bed47fe13p-5, -0x1.7019bda6c2af5p-6, 0x1.59d3aa41d5788p-6, -0x1.b324eabcf010ep-9, -0x1.b47766da45335p-9, 0x1.c0137142df985p-10, 0x1.a8b4ddb321b8ap-14, -0x1.4098f517e050bp-12},
+    {0x1.f21c9f12f0677p-1, -0x1.7f011e65d86e5p-58, 0x1.92470a61b6965p-4, 0x1.c6aeb6d5b2c3bp-58, -0x1.3a47801c56a57p-3, -0x1.389dc6ce3400dp-58, 0x1.0453f90d3bd35p-3, -0x1.8a7c6a239262bp-5, -0x1.075c0880347efp-7, 0x1.16f9c9c3a7d47p-6, -0x1.74c2fc8ef27dfp-8, -0x1.760c9f58c8092p-10, 0x1.a3cd7ebbfa978p-10, -0x1.01b139ce180cp-12, -0x1.91cf84e72e16p-13},
+    {0x1.f74a6d9a38383p-1, 0x1.c339ddaaaaa4bp-55, 0x1.0bf97e95f2a64p-4, -0x1.445bc17d79da1p-58, -0x1.c435059d09788p-4, -0x1.d91b86f2ccab9p-62, 0x1.a3687c1eaf1adp-4, -0x1.9647a30b16c7fp-5, 0x1.6981061e00a69p-9, 0x1.7e8755deebfd3p-7, -0x1.9be7320447c2ap-8, 0x1.3a9370c2f2e5cp-13, 0x1.319f9828e31abp-10, -0x1.b78f00b67b13bp-12, -0x1.0496273af97acp-14},
+    {0x1.fab0dd89d1309p-1, -0x1.ae61f5297a2bbp-55, 0x1.5a08e85af27ep-5, 0x1.e50425fa109e9p-59, -0x1.399812926bc23p-4, -0x1.3a88fb31ef0e2p-58, 0x1.4140efb719cbp-4, -0x1.7535a61a41c16p-5, 0x1.374c88c7e6f12p-7, 0x1.a40709e624789p-8, -0x1.6dc0788acca4cp-8, 0x1.2ee6a3210c3bap-10, 0x1.44f198f7a623cp-11, -0x1.c2545cdc9c115p-12, 0x1.50349189879ebp-15},
+    {0x1.fcdacca0bfb73p-1, -0x1.2c33ed3aa7eddp-55, 0x1.b1160991ff737p-6, -0x1.d91e6d1bad855p-61, -0x1.a38d59456f77dp-5, 0x1.130925a9cbab7p-62, 0x1.d5bd91b6b0123p-5, -0x1.3b35dcbc80255p-5, 0x1.9d76b0a05388cp-7, 0x1.14c887acbfc4fp-9, -0x1.117f42ce26195p-8, 0x1.9b476a68df2e9p-10, 0x1.1d2216e4a213ap-13, -0x1.5b7795c4c1191p-12, 0x1.8bbe46d359edbp-14},
+    {0x1.fe307f2b503dp-1, -0x1.8a553514791ap-57, 0x1.06ae13b0d3255p-6, -0x1.88a15bbadd6f4p-60, -0x1.0ee3844e59be7p-5, -0x1.2959c6ec9ddc7p-59, 0x1.48b127f8ed8a5p-5, -0x1.f155b4e7d8b8ap-6, 0x1.aa2c0753d5d39p-7, -0x1.bbf7e27f3bc59p-11, -0x1.5478d78a04e39p-9, 0x1.8eae0e7d6293ap-10, -0x1.9293e72119217p-13, -0x1.911afe726e0c5p-13, 0x1.afbdfa5973304p-14},
+    {0x1.fefcce6813974p-1, -0x1.b27c4b27c67b3p-58, 0x1.34d7dbc76d7e5p-7, 0x1.378839979488bp-61, -0x1.51cc18621fc23p-6, 0x1.86483c7866c9ap-65, 0x1.b925a99886bb7p-6, -0x1.71e7d408c8a42p-6, 0x1.7ea58080a8502p-7, -0x1.46eb9d24e3696p-9, -0x1.4033336ccfdf4p-10, 0x1.3b37e7a9c6515p-10, -0x1.6be115e428d54p-12, -0x1.04d3c9bdf4849p-14, 0x1.553b1a337fc07p-14},
+    {0x1.ff733814af88cp-1, 0x1.0a8752fe10eap-56, 0x1.5ff2750fe782p-8, -0x1.5f1d57da477d5p-62, -0x1.96f0575a63ae5p-7, -0x1.509d4e5c4b15bp-65, 0x1.1c5a643f04363p-6, -0x1.04f5caaf217p-6, 0x1.382a146afb881p-7, -0x1.95cab93fd7966p-9, -0x1.d2fd90efa1344p-13, 0x1.9f5123a1c0766p-11, -0x1.7d7381b144745p-12, 0x1.c799361b20f05p-16, 0x1.92d2f59173327p-15},
+    {0x1.ffb5bdf67fe6fp-1, 0x1.4e8c5051b76abp-62, 0x1.84ba3004a50dp-9, -0x1.90f43060c88afp-64, -0x1.d9c2ea85a927ep-8, 0x1.5a0e9c6bc1411p-64, 0x1.60898536e104ap-7, -0x1.5eb1c899f079fp-7, 0x1.d854f73e74938p-8, -0x1.897719ade437fp-9, 0x1.88cdc8c3391b1p-12, 0x1.b325dfe746931p-12, -0x1.38155b6271697p-12, 0x1.2a4087655cb6p-14, 0x1.1fbc6f13733d8p-16},
+    {0x1.ffd9f78c7524ap-1, 0x1.04ed7abfa1607p-55, 0x1.a024365f771bdp-10, 0x1.3c502959c3856p-64, -0x1.0a9732d5284dep-8, 0x1.615adec32520ep-62, 0x1.a4bf47a43042bp-8, -0x1.c23802d8a574cp-8, 0x1.4f40070667d5cp-8, -0x1.4c9a2ca028026p-9, 0x1.4f7a50be85badp-11, 0x1.18b0976e0c529p-13, -0x1.a4c3bb322523ap-13, 0x1.4afa419ae8abp-14, -0x1.074ec1509658bp-18},
+    {0x1.ffed167b12ac2p-1, -0x1.ddc0ca7bb5e64p-55, 0x1.afc85e0f82e12p-11, 0x1.42d1921812671p-66, -0x1.221a9f326bef4p-9, -0x1.db8e000cb5307p-63, 0x1.e3c9aab90bcf5p-9, -0x1.14b1b98141d96p-8, 0x1.c1c19b9e635d6p-9, -0x1.feac3dc059defp-10, 0x1.63e8817e9da0cp-11, -0x1.444162fbc8bccp-15, -0x1.c8cf3323b49f4p-14, 0x1.122e64c40b049p-14, -0x1.d8dd752d7ca1p-17},
+    {0x1.fff6dee89352ep-1, 0x1.b96c0acfffa49p-55, 0x1.b23a5a23e421p-12, 0x1.71ac5c8300f25p-67, -0x1.315107613c673p-10, -0x1.0c83d7b25d92fp-64, 0x1.0c243329a9ca1p-9, -0x1.463011626213p-9, 0x1.1e84d1022e73cp-9, -0x1.6b418726ba878p-10, 0x1.36edde59d0d5cp-11, -0x1.f78719ccf0d4bp-14, -0x1.51ed31bb448d5p-15, 0x1.71313bcc1e95ap-15, -0x1.0a8ac34416207p-16},
+    {0x1.fffbb8f1049c6p-1, 0x1.d2c620aa86fcfp-56, 0x1.a740684026555p-13, -0x1.7f25dc36203e3p-69, -0x1.36d34c8f1c26ap-11, 0x1.d2ab756870e75p-65, 0x1.1eb6e14974a25p-10, -0x1.714eb8cc09937p-10, 0x1.5bec08c01aeccp-10, -0x1.e4621d805648ap-11, 0x1.e1b7b566fc72fp-12, -0x1.24565ed70194cp-13, 0x1.bf8ae96157cfcp-20, 0x1.8fdfe579e1114p-16, -0x1.b36daf7414aa8p-17},
+    {0x1.fffe0e0140857p-1, -0x1.6aa37c0b2390dp-57, 0x1.8fdc1b2dcf7b9p-14, 0x1.71b660104e1efp-71, -0x1.322484cf12da8p-12, 0x1.5d2016a7c6e06p-68, 0x1.27dc1bc6cfef5p-11, -0x1.9202f465ebe66p-11, 0x1.93b4c9746870fp-11, -0x1.30e9e61172c92p-11, 0x1.555b9d5e6cc0dp-12, -0x1.055998e5edcc4p-13, 0x1.68e6e1bcf0d19p-16, 0x1.2e76e59b6c3cbp-17, -0x1.1e00086e89e9ep-17},
+    {0x1.ffff2436a21dcp-1, -0x1.3607980ed2ca8p-55, 0x1.6e2367dc27f95p-15, 0x1.e794fe9942347p-73, -0x1.23c436c36fda8p-13, 0x1.5afc0fdac02ccp-73, 0x1.26bf00867a834p-12, -0x1.a51fb50b16f4p-12, 0x1.c0825378fdea8p-12, -0x1.6c3dbfdc7f97p-12, 0x1.c1dd14360b651p-13, -0x1.94c38bc5a81p-14, 0x1.bf0aca81e4c97p-16, 0x1.a6ce97bc89588p-23, -0x1.2b9e681415c3cp-18},
+    {0x1.ffffa1de8c582p-1, 0x1.83253e88a9807p-55, 0x1.44f21e49054f2p-16, 0x1.f6c615d61f2a5p-71, -0x1.0d18811478655p-14, -0x1.2b1721962fcfcp-69, 0x1.1b964d438f621p-13, -0x1.a8d7851f28021p-13, 0x1.ddd6df9b69098p-13, -0x1.9e52b7a55ee9fp-13, 0x1.165b20327a62fp-13, -0x1.1b75d7f80b974p-14, 0x1.91a27604c1bd8p-16, -0x1.00e3eb8ad782cp-18, -0x1.afa596ed59621p-20},
+    {0x1.ffffd8e1a2f22p-1, -0x1.c10ae02d3f9a2p-55, 0x1.1783ceac2891p-17, -0x1.7c7cc6917e938p-71, -0x1.e06a8b37e5b8cp-16, -0x1.0423ba80354c7p-73, 0x1.07978c7b84969p-14, -0x1.9d039884f9fccp-14, 0x1.e8d1145e95e09p-14, -0x1.c1f7250c23fd8p-14, 0x1.458b9e0431b4ep-14, -0x1.6eb069ea1dec5p-15, 0x1.330477fce696fp-16, -0x1.42372bb7ef1cep-18, 0x1.ce5bff729b99ap-28},
+    {0x1.fffff039f9e8fp-1, -0x1.9d1bcd9fa752ep-55, 0x1.d21397ead99cbp-19, -0x1.52450e5545525p-75, -0x1.9f19734d29cf4p-17, -0x1.61a01c2f91881p-71, 0x1.d982bd41d894fp-16, -0x1.8320fc48378a5p-15, 0x1.e0a1cb1d086eep-15, -0x1.d384222ce18cap-15, 0x1.696daf5f9d29fp-15, -0x1.bb6e3a4c171b5p-16, 0x1.a4fccf3a98eb8p-17, -0x1.1c657db9ef864p-18, 0x1.72e3bd7cb50ecp-21},
+    {0x1.fffff9d446cccp-1, -0x1.bb06ba9d88ce7p-57, 0x1.789fb715aae95p-20, 0x1.ebbc947a1391p-83, -0x1.5b333cc7f98f2p-18, -0x1.5d017a428f98bp-72, 0x1.9b12fdbf90f5ep-17, -0x1.5e06923144a8fp-16, 0x1.c6a0719257519p-16, -0x1.d178cb044d80dp-16, 0x1.7e29d336db225p-16, -0x1.f92031308a1efp-17, 0x1.094dbb46e5591p-17, -0x1.a77c6f9aced1ep-19, 0x1.b84fa2dfbe10bp-21},
+    {0x1.fffffda86faa9p-1, -0x1.d23024eb84745p-56, 0x1.26f9df8519bd7p-21, -0x1.e0698e33523fbp-75, -0x1.1926290adc892p-19, 0x1.0b3905e5c51d2p-73, 0x1.5900c02d97302p-18, -0x1.3166de6a8ab37p-17, 0x1.9dfcc328733d6p-17, -0x1.bcab1edd220c6p-17, 0x1.81cd74a35c9ecp-17, -0x1.106e87cdeb83dp-17, 0x1.37962cb615126p-18, -0x1.19a221d68e355p-19, 0x1.74491f6874fbp-21},
+    {0x1.ffffff233ee1dp-1, 0x1.db123ef4bb3dbp-55, 0x1.bfd7555a3bd68p-23, 0x1.fa26aabe0bd6p-78, -0x1.b8d7f804d2e9ap-21, -0x1.4794ece35d18ep-75, 0x1.17f93e514928bp-19, -0x1.013b0457ccf15p-18, 0x1.6b245d7e1d065p-18, -0x1.980775583725fp-18, 0x1.7492048c58c32p-18, -0x1.17504eb394993p-18, 0x1.57e944e08b879p-19, -0x1.577359685639p-20, 0x1.0a20c8fa92031p-21},
+    {0x1.ffffffb127525p-1, 0x1.504f3849bc6d9p-55, 0x1.4980cb3c80949p-24, 0x1.6dc12e7e2fb15p-78, -0x1.4ea6ce69729aep-22, 0x1.9e95922643992p-76, 0x1.b771d9b6f07c8p-21, -0x1.a26c653fa1dc1p-20, 0x1.3302bb89359d1p-19, -0x1.67f42e6aeba61p-19, 0x1.58b4adb68f00bp-19, -0x1.10f5472abd7a5p-19, 0x1.66ca2d7844ee2p-20, -0x1.859640d90b65bp-21, 0x1.53fe4e3a1b20ep-22},
+    {0x1.ffffffe4aed5ep-1, 0x1.389c10630b2a7p-59, 0x1.d5f3a8dea7357p-26, 0x1.b5f61c0c72949p-80, -0x1.ebfb14c91716bp-24, 0x1.99141c814b2c2p-79, 0x1.4d9228525f467p-22, -0x1.48b536adcb2b4p-21, 0x1.f48ccf239f1c9p-21, -0x1.3183b63496c6ep-20, 0x1.31efde2ed8f79p-20, -0x1.fd9e6aaa77df9p-21, 0x1.634119cdfafc5p-21, -0x1.9ebebe2793ccbp-22, 0x1.8e2fffcdfc8b7p-23},
+    {0x1.fffffff6d1e56p-1, -0x1.64d969a929cedp-55, 0x1.44d26de513197p-27, 0x1.129a878bb48c1p-81, -0x1.5e32de7af8a48p-25, 0x1.7df9ef8a49cb1p-79, 0x1.e9e05b3c8f3e2p-24, -0x1.f2f6fa7d8fb33p-23, 0x1.899dcace3d69ap-22, -0x1.f34b7f40498dp-22, 0x1.04be03153e3e9p-21, -0x1.c73b35d9384eep-22, 0x1.4edd69896bd26p-22, -0x1.a0de30b3a119dp-23, 0x1.b19f34703d5c4p-24},
+    {0x1.fffffffd01f89p-1, -0x1.35e8e38b92a66p-56, 0x1.b334fac4b9f99p-29, 0x1.8c565e0aa7ca1p-86, -0x1.e2cec6323e6ep-27, -0x1.f7fb5ef4e9fe2p-83, 0x1.5c027d5bba3dap-25, -0x1.6df4d024d581dp-24, 0x1.2aaf7c204d9a6p-23, -0x1.8902ee569b21dp-23, 0x1.ab2ab1e34986cp-23, -0x1.85ab3245bf9c1p-23, 0x1.2d32a7a286cfap-23, -0x1.8d4aa5b9064e2p-24, 0x1.bafadf2307aa6p-25},
+    {0x1.ffffffff0dd2bp-1, 0x1.0df73e808dd25p-55, 0x1.1a94ff571654fp-30, 0x1.a8350b81663e9p-85, -0x1.4251f33f55974p-28, 0x1.d1e25474b9148p-82, 0x1.de6bc1f75bc9ep-27, -0x1.036b5fd197e4bp-25, 0x1.b58f1385be9a6p-25, -0x1.2a23484df592cp-24, 0x1.508db89e7b6c6p-24, -0x1.3ffdf37157e5bp-24, 0x1.02ff2b3fc7405p-24, -0x1.6828533fa4f5dp-25, 0x1.ab11dfc9383acp-26},
+    {0x1.ffffffffb5be5p-1, -0x1.729d68167e57p-56, 0x1.63ac6b4edc88dp-32, 0x1.1a725f6c4cbbcp-86, -0x1.a0ce0dc06aab9p-30, -0x1.e86ec94bef63ap-88, 0x1.3e380dd7594b8p-28, -0x1.638bc4faac82ap-27, 0x1.35753ad4a31d2p-26, -0x1.b41f348309dc9p-26, 0x1.fe694ead09bdep-26, -0x1.f8ad9e40c36cp-26, 0x1.aa7662da340d7p-26, -0x1.37524e17c5e7ep-26, 0x1.8637fdd4117fp-27},
+    {0x1.ffffffffe9ebp-1, -0x1.ea527e05e02p-58, 0x1.b1e5acf351d86p-34, -0x1.94ad3f57237d6p-90, -0x1.05042a0a5f72cp-31, 0x1.648e6e9af6984p-85, 0x1.99ac8fd63c88cp-30, -0x1.d7234436ef0edp-29, 0x1.a6be9a11f02f9p-28, -0x1.33aacbf58c564p-27, 0x1.74b7335c69f9ep-27, -0x1.7e7d646ccda4p-27, 0x1.5094dcdbe290fp-27, -0x1.011923d056f91p-27, 0x1.52fec8b5d7ae7p-28},
+    {0x1.fffffffff9a1bp-1, -0x1.6a87270bd1b5ap-57, 0x1.0084ff125639cp-35, -0x1.4a6fe81afdb8bp-89, -0x1.3ca42adaa2ce9p-33, -0x1.46e6bf04b6dd3p-88, 0x1.fe73513c67fedp-32, -0x1.2dd9aa59a113cp-30, 0x1.16ef6b9355013p-29, -0x1.a2d58fc34d8c5p-29, 0x1.06389c03c001ep-28, -0x1.16ccbc6a20c9p-28, 0x1.fdd6f84697ceep-29, -0x1.9652c697af262p-29, 0x1.18b036408ab17p-29},
+    {0x1.fffffffffe38p-1, 0x1.7ce0711508214p-55, 0x1.25f9ee0b923dap-37, -0x1.07225fea7cd0ap-91, -0x1.74105146a5b44p-35, 0x1.e320b5d995af6p-90, 0x1.33cde4f35dcbap-33, -0x1.760fe7b57faf5p-32, 0x1.63a70fd5fe27cp-31, -0x1.1324f7f149a93p-30, 0x1.63a31af52d485p-30, -0x1.8722f08a6001fp-30, 0x1.72e153374dd95p-30, -0x1.33a10fb5cfc5p-30, 0x1.bbe4186b6e0e4p-31},
+    {0x1.ffffffffff845p-1, 0x1.b0edc5a8b6852p-56, 0x1.46897d4b69fc3p-39, 0x1.c32e6f85c521bp-95, -0x1.a77a4e7dce6d8p-37, 0x1.e0e5a31d9307ap-92, 0x1.67543695dd1dap-35, -0x1.c05c1e2e5a4fcp-34, 0x1.b639419f34feap-33, -0x1.5cfd803ebc71bp-32, 0x1.d11579d2a2e0fp-32, -0x1.082e27a9d209ep-31, 0x1.0353c6955533dp-31, -0x1.bec80f3118562p-32, 0x1.4fb835f2a88f2p-32},
+    {0x1.ffffffffffdf8p-1, -0x1.dcf8b10ff433ep-55, 0x1.5f8b87a31bd8p-41, -0x1.7a42bcf49aaffp-96, -0x1.d2e55024a2753p-39, -0x1.494bc24329331p-96, 0x1.9612cc225e871p-37, -0x1.03ee5f37a633bp-35, 0x1.04f2f71d9c356p-34, -0x1.ab709c453650cp-34, 0x1.2554b9f0ea266p-33, -0x1.57c63ec733625p-33, 0x1.5ccfe0d1fd5c3p-33, -0x1.3777b033d0989p-33, 0x1.e65ab687a5786p-34},
+    {0x1.fffffffffff7bp-1, 0x1.00fa07f7fd467p-55, 0x1.6ed2f2515e92bp-43, 0x1.0a2937c0f6137p-97, -0x1.f2a6c1669eb2p-41, 0x1.4d89bca197837p-98, 0x1.bc42ba38a21c5p-39, -0x1.2391e13421afep-37, 0x1.2c6c245432a28p-36, -0x1.f9a3c501ae84bp-36, 0x1.650255e50f6cfp-35, -0x1.af1eff4f9b8d1p-35, 0x1.c38666ba9a1b7p-35, -0x1.a13c6ef5274cap-35, 0x1.51c50fdf43fb6p-35},
+    {0x1.fffffffffffdfp-1, 0x1.5669e670fa645p-56, 0x1.72fd93e036cd1p-45, -0x1.c021f026e853p-100, -0x1.01f450d1e794ap-42, 0x1.bfddeec9836a2p-97, 0x1.d68fb81b30169p-41, -0x1.3c706aa2abd55p-39, 0x1.4e6479551a48p-38, -0x1.20e9edce798ffp-37, 0x1.a35b9f50b0285p-37, -0x1.049effb719b63p-36, 0x1.1963b4107da08p-36, -0x1.0cae8fce1c4f2p-36, 0x1.c23dcd9b6f8a4p-37},
+    {0x1.ffffffffffff8p-1, 0x1.0160ef15c5072p-56, 0x1.6ba91ac734776p-47, -0x1.0fbf997d18462p-102, -0x1.028a3909a1423p-44, -0x1.4e337fe194afap-101, 0x1.e292863e194bcp-43, -0x1.4c4e690ce4389p-41, 0x1.67e6e5aaab2e9p-40, -0x1.3f00db14a958ep-39, 0x1.db88f1523b7dep-39, -0x1.2fe29d5e10d9fp-38, 0x1.51d979e99f6ffp-38, -0x1.4ce3eefa9fb22p-38, 0x1.2036b19f3a467p-38},
+    {0x1.ffffffffffffep-1, 0x1.59ab24e589c66p-56, 0x1.5982008db12efp-49, 0x1.9cbd5a2894f3fp-105, -0x1.f610e8cdea73ep-47, 0x1.b8e583e5766c4p-106, 0x1.df2dac2f2f894p-45, -0x1.51b17f925c3dcp-43, 0x1.76996dda562a4p-42, -0x1.546159860d365p-41, 0x1.0456ef785cdd3p-40, -0x1.55d27265d237p-40, 0x1.86e7a1b06d75dp-40, -0x1.8cfad292a6dc3p-40, 0x1.62a45a781813fp-40},
+    {0x1p+0, -0x1.a6d7d18831831p-55, 0x1.3e296303b227dp-51, 0x1.2dbf4c6c85d5cp-105, -0x1.d8456ef9828bbp-49, 0x1.f9e6d614e5a02p-105, 0x1.ccb92e6c27a25p-47, -0x1.4c1aa8caa1b82p-45, 0x1.7918b6b562b1ap-44, -0x1.5f073b1696471p-43, 0x1.134d097c50a7ep-42, -0x1.7305953ede452p-42, 0x1.b404ff35def19p-42, -0x1.c7df196c45acdp-42, 0x1.a3ab40915542p-42},
+};
+
+/* E0 contains a degree-7 polynomial P(t) approximating erf(x)/x for |x| < 1/8,
+   with t = x^2. The coefficients of degree 0 and 1 are double-double numbers
+   (E0[0]+E0[1] and E0[2]+E0[3]), the coefficients of degree 2 to 7 are in
+   E0[4] to E0[9]. The relative error of P is bounded by 2^-77.36 on
+   [0,1/64] (estimated as for C[] above). */
+static const double E0[10] = {
+  0x1.20dd750429b6dp+0, 0x1.1ae3a8ddfa75cp-56, -0x1.812746b0379e7p-2, 0x1.ee20a3ecbeb4ep-57, 0x1.ce2f21a042be2p-4,
+  -0x1.b82ce31288e1ap-6, 0x1.565bcd0ef75eap-8, -0x1.c02db577f4aacp-11, 0x1.f9a4691015c92p-14, -0x1.f3c4df7280ffap-17};
+
+/* Put in h+l an approximation of erf(x) for 2^-61 <= |x| < 1/8.
+   We evaluate x*P(x^2), where x^2 is computed exactly as th+tl, with
+   |tl| <= ulp(th) <= 2^-58.
+   The relative error on h+l is bounded by 2^-73: the approximation error of
+   P is less than 2^-77.36, the rounding error on the degree 3 to 7 part is
+   less than 2^-58*t^3 < 2^-76, and the error made by approximating
+   P(th+tl)-P(th) by tl*(c1+2*c2*th) is less than 3*|c3|*t^2*2^-58 < 2^-73.7,
+   relatively to P(t) >= 1.12; the other rounding errors are less than
+   2^-100, in all rounding modes. */
+static void
+erf_small (double *h, double *l, double x)
+{
+  double th, tl;
+  a_mul (&th, &tl, x, x); /* exact since |x| >= 2^-61 */
+  double q = __builtin_fma (E0[9], th, E0[8]);
+  q = __builtin_fma (q, th, E0[7]);
+  q = __builtin_fma (q, th, E0[6]);
+  q = __builtin_fma (q, th, E0[5]);
+  *h = q;
+  *l = 0;
+  fma_dd (h, l, th, E0[4], 0);
+  fma_dd (h, l, th, E0[2], E0[3]);
+  /* account for the low part tl of x^2 */
+  double s = tl * __builtin_fma (2.0 * th, E0[4], E0[2]);
+  fma_dd (h, l, th, E0[0], E0[1]);
+  *l += s;
+  /* multiply by x */
+  a_mul (&th, &tl, *h, x);
+  *l = __builtin_fma (*l, x, tl);
+  *h = th;
+}
+
+/* Put in h+l an approximation of erf(x) for 1/8 <= x < 0x1.7afb48dc96627p+2.
+   Adding the rounding errors of the evaluation below, computed for each
+   interval with the same bound propagation as done by Gappa (with an error
+   of one ulp for each rounded operation, to cover all rounding modes),
+   to the approximation error of C[], the relative error on h+l is
+   bounded by 2^-66.988. */
+static void
+erf_fast (double *h, double *l, double x)
+{
+  int i = (int) (8.0 * x); /* 1 <= i <= 47 */
+  double z = x - (double) (2 * i + 1) * 0.0625; /* exact by Sterbenz lemma */
+  const double *c = C[i - 1];
+  double z2 = z * z, z4 = z2 * z2;
+  double c4 = __builtin_fma (c[8], z, c[7]);
+  double c6 = __builtin_fma (c[10], z, c[9]);
+  double c8 = __builtin_fma (c[12], z, c[11]);
+  double c10 = __builtin_fma (c[14], z, c[13]);
+  c4 = __builtin_fma (c6, z2, c4);
+  c8 = __builtin_fma (c10, z2, c8);
+  c4 = __builtin_fma (c8, z4, c4);
+  /* the coefficient of degree 3 vanishes near x = 1/sqrt(2), thus we cannot
+     use fma_dd() here */
+  a_mul (h, l, c4, z);
+  two_sum (h, &c4, c[6], *h);
+  *l += c4;
+  fma_dd (h, l, z, c[4], c[5]);
+  fma_dd (h, l, z, c[2], c[3]);
+  fma_dd (h, l, z, c[0], c[1]);
+}
+
+/* The accurate path computes erf(x) from a point x0 = k/8 close to x
+   (k = 0 for |x| < 1/8, otherwise x0 = ceil(8|x|)/8 >= |x|), with h = x-x0:
+   erf(x0+h) = erf(x0) + 2/sqrt(pi)*exp(-x0^2)*int(g(t), t=0..h)
+   where g(t) = exp(-2*x0*t-t^2) = sum(a[n]*t^n, n>=0) satisfies
+   g'(t) = (-2*x0-2*t)*g(t), thus a[0] = 1, a[1] = -2*x0 and
+   a[n+1] = (-2*x0*a[n] - 2*a[n-1])/(n+1).
+   All computations are done with the dint64_t type (128-bit significand). */
+
+/* ERF0[k] is erf(k/8) rounded to 128 bits, for 0 <= k <= 48 */
+static const dint64_t ERF0[49] = {
+    {.hi = 0x0000000000000000, .lo = 0x0000000000000000, .ex = 0, .sgn = 0x0},
+    {.hi = 0x8faf0d1ae1dc4ba1, .lo = 0x6dac927c1e7853e4, .ex = -3, .sgn = 0x0},
+    {.hi = 0x8d7aa71196b04482, .lo = 0x2dbc0b7d1a9816ae, .ex = -2, .sgn = 0x0},
+    {.hi = 0xcee8695b90f9c5d3, .lo = 0x1c7fbc5d6785e736, .ex = -2, .sgn = 0x0},
+    {.hi = 0x853f7ae0c76e915e, .lo = 0x809f1a31a27a94c2, .ex = -1, .sgn = 0x0},
+    {.hi = 0x9f8cb6e68789a60d, .lo = 0xa0b090208f527a5a, .ex = -1, .sgn = 0x0},
+    {.hi = 0xb60e4bace872fb62, .lo = 0x865e59788aa6cee3, .ex = -1, .sgn = 0x0},
+    {.hi = 0xc8b924a8dc7e2db0, .lo = 0xdda4595a0e9db4eb, .ex = -1, .sgn = 0x0},
+    {.hi = 0xd7bb3d3a08445636, .lo = 0x80887edd869379d3, .ex = -1, .sgn = 0x0},
+    {.hi = 0xe36d69414f630f2a, .lo = 0x44959a2e17db07fd, .ex = -1, .sgn = 0x0},
+    {.hi = 0xec432ecc55f00406, .lo = 0x276a08d164e2cd2b, .ex = -1, .sgn = 0x0},
+    {.hi = 0xf2bb461da51fe0c5, .lo = 0xb133a7c4c47cb0ce, .ex = -1, .sgn = 0x0},
+    {.hi = 0xf752aab89bd6fd8f, .lo = 0x437741a6d266cb5c, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfa7b49db3debb6c5, .lo = 0xe11ebf93ca9eabf1, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfc9683bfc6ab698b, .lo = 0x55ef493fce6ebd95, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfdf30f77a67b522b, .lo = 0xbdb10ccec300b0eb, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfecd70a13caf1997, .lo = 0x2801904b9a33eef4, .ex = -1, .sgn = 0x0},
+    {.hi = 0xff5210c6b2ca4f87, .lo = 0x33309c2099d1c410, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffa023b018cda1f1, .lo = 0x4207143202514f28, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffccb079f59936f7, .lo = 0x4e35916807fb642a, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffe5547a64df5361, .lo = 0x9dc2c022df2253e0, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfff28a5dee0cb78c, .lo = 0x9a732e928e4c5cca, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfff967d8229ecb35, .lo = 0x226d0c0854610b27, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffcdd210741a113, .lo = 0x79ec5aa630e3d7c6, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffe8d6209afcbdd, .lo = 0x5f43d9ad9deb2f5c, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffff59f5d933d8f2, .lo = 0x3fb4b823e5d03013, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffb7cfb3f2abc3, .lo = 0xc890774069646845, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffe18b6cf67ce9, .lo = 0x9a176172989e68ae, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffff3886ab2f393, .lo = 0xd4a5aedb807d014b, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffb0c61ed2fb9, .lo = 0xb3d8c77157062626, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffe178b8f1b0b, .lo = 0xdba072be8ea96d0c, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffff49676c945a, .lo = 0x49a2603d6a493fc4, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffffbdc88bb10b, .lo = 0x2865615db4031938, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffffe8b4e862e1, .lo = 0x457f60d1cdddbf8c, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffff80d45b012, .lo = 0x3370eca5ca6996d3, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffffd5e914759, .lo = 0x20db209e0870b05c, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffffff27d180e8, .lo = 0xb35e5b40e3db00aa, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffffffbcb132bf, .lo = 0x78a5aca1512f3d21, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffffffebacebef, .lo = 0x7dcfd646840401f6, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffffffa0c42f4, .lo = 0x5967a0add5825076, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffffffe4f3e58, .lo = 0xa6088c76ca15a215, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffffffff88cec1, .lo = 0x50334391748a050f, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffffffffe02a0f, .lo = 0x752d4d65c349c5e7, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffffffff7c114, .lo = 0xbe6226402c7623c2, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffffffffdedcf, .lo = 0xa99b29bae48ba16c, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffffffffff7edf, .lo = 0x10c9e70d2ac6d8dc, .ex = -1, .sgn = 0x0},
+    {.hi = 0xffffffffffffe181, .lo = 0x15fd1b1278609330, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffffffffff904, .lo = 0x39397b5f709b1808, .ex = -1, .sgn = 0x0},
+    {.hi = 0xfffffffffffffe73, .lo = 0x07eaa82df49e5800, .ex = -1, .sgn = 0x0},
+};
+
+/* EXP0[k] is 2/sqrt(pi)*exp(-(k/8)^2) rounded to 128 bits, for 0 <= k <= 48 */
+static const dint64_t EXP0[49] = {
+    {.hi = 0x906eba8214db688d, .lo = 0x71d48a7f6bfec344, .ex = 0, .sgn = 0x0},
+    {.hi = 0x8e317d0f434db1ce, .lo = 0x6909ad6a1e72ff4f, .ex = 0, .sgn = 0x0},
+    {.hi = 0x87ae8b017bf206c1, .lo = 0xbe8872b4e11bdf59, .ex = 0, .sgn = 0x0},
+    {.hi = 0xfaf866d78a98981d, .lo = 0xff29f5ad81173d64, .ex = -1, .sgn = 0x0},
+    {.hi = 0xe0f7e524d2808a98, .lo = 0x103afe929ffc3390, .ex = -1, .sgn = 0x0},
+    {.hi = 0xc374b4a09a5ced88, .lo = 0x4bd9d69c530b5722, .ex = -1, .sgn = 0x0},
+    {.hi = 0xa497216bc69624e8, .lo = 0x58f2b08b81404151, .ex = -1, .sgn = 0x0},
+    {.hi = 0x8655b0f8425c9909, .lo = 0x8a511a778e6a3fe7, .ex = -1, .sgn = 0x0},
+    {.hi = 0xd488f84b7de12def, .lo = 0x2bec119499ab1f4c, .ex = -2, .sgn = 0x0},
+    {.hi = 0xa2f4cde5dbc8aaf7, .lo = 0x9a024b502aabe0dc, .ex = -2, .sgn = 0x0},
+    {.hi = 0xf23297d6e5b58fc2, .lo = 0xd5ef92dfdfb8532f, .ex = -3, .sgn = 0x0},
+    {.hi = 0xae72cae22ad850e1, .lo = 0x8ba0ae163706478b, .ex = -3, .sgn = 0x0},
+    {.hi = 0xf391b935c12546dd, .lo = 0xfce6811589c32eb2, .ex = -4, .sgn = 0x0},
+    {.hi = 0xa4cea3c5e539a898, .lo = 0xe20e8b9bc7126cc8, .ex = -4, .sgn = 0x0},
+    {.hi = 0xd82a98191080ab97, .lo = 0x53d4c1da0323f926, .ex = -5, .sgn = 0x0},
+    {.hi = 0x896759bffcde1b47, .lo = 0x61613a68ec25f85f, .ex = -5, .sgn = 0x0},
+    {.hi = 0xa94dcf467cd0f1b4, .lo = 0x7becf12c4e3de30a, .ex = -6, .sgn = 0x0},
+    {.hi = 0xca31273c707d757c, .lo = 0xf3719070e01dddd3, .ex = -7, .sgn = 0x0},
+    {.hi = 0xea0a1d4eff4b2691, .lo = 0x13c3ca3812916bea, .ex = -8, .sgn = 0x0},
+    {.hi = 0x8348c5b1aab12243, .lo = 0x68c771c73ff82fdb, .ex = -8, .sgn = 0x0},
+    {.hi = 0x8ec18b87dfb7dbd4, .lo = 0x6ce3df76e942b809, .ex = -9, .sgn = 0x0},
+    {.hi = 0x96744c4049227212, .lo = 0x568a92753cf946a2, .ex = -10, .sgn = 0x0},
+    {.hi = 0x99b066691ed9d027, .lo = 0x3c2a889d3bbac3ea, .ex = -11, .sgn = 0x0},
+    {.hi = 0x9829c7ddbbf66863, .lo = 0x17a306cd4cbb6da0, .ex = -12, .sgn = 0x0},
+    {.hi = 0x920474dd1993f503, .lo = 0xc4fd4f1f7e750f6f, .ex = -13, .sgn = 0x0},
+    {.hi = 0x87cf0da6e9b6f7b0, .lo = 0x048dfc98e1499f8f, .ex = -14, .sgn = 0x0},
+    {.hi = 0xf4daf4680673b468, .lo = 0x83a265c60a8d477c, .ex = -16, .sgn = 0x0},
+    {.hi = 0xd5f04f48a25af261, .lo = 0x0601247fc9693f83, .ex = -17, .sgn = 0x0},
+    {.hi = 0xb52cb90cd49ecc68, .lo = 0x0e087a65465c8750, .ex = -18, .sgn = 0x0},
+    {.hi = 0x94b5387a0a029903, .lo = 0x6e65808a17d10ade, .ex = -19, .sgn = 0x0},
+    {.hi = 0xec9b8f17fbe1aa15, .lo = 0xda12a3c0f1a27bfd, .ex = -21, .sgn = 0x0},
+    {.hi = 0xb670d51febdee837, .lo = 0xe2b6178ad555941e, .ex = -22, .sgn = 0x0},
+    {.hi = 0x8858a4457591a7c6, .lo = 0x51496fae7e807ec0, .ex = -23, .sgn = 0x0},
+    {.hi = 0xc5867e702bcefc2e, .lo = 0x8a4cd3027a86d06d, .ex = -25, .sgn = 0x0},
+    {.hi = 0x8aad04832ea7b683, .lo = 0xa2938ebf08029fbe, .ex = -26, .sgn = 0x0},
+    {.hi = 0xbcba73a1ef51e493, .lo = 0xdfc444de84a0b6e5, .ex = -28, .sgn = 0x0},
+    {.hi = 0xf8f1a91da0ebe519, .lo = 0xf959275e992bb901, .ex = -30, .sgn = 0x0},
+    {.hi = 0x9f22722980dc9234, .lo = 0xb801a274be3943f7, .ex = -31, .sgn = 0x0},
+    {.hi = 0xc530ba2f63e8e99d, .lo = 0x509f787b50e1136e, .ex = -33, .sgn = 0x0},
+    {.hi = 0xecd44079835ebfe0, .lo = 0x413b97600e264eae, .ex = -35, .sgn = 0x0},
+    {.hi = 0x89d7a7827cccbdf5, .lo = 0x9a3370657d0aac4b, .ex = -36, .sgn = 0x0},
+    {.hi = 0x9b855c193d7aedc6, .lo = 0x41ef822f68892f96, .ex = -38, .sgn = 0x0},
+    {.hi = 0xaa1177aec4a4e8ff, .lo = 0xb112c42b9a7c6fdc, .ex = -40, .sgn = 0x0},
+    {.hi = 0xb4411f294b85f092, .lo = 0x01c5724f7de5c0dc, .ex = -42, .sgn = 0x0},
+    {.hi = 0xb92c30859d9197a7, .lo = 0xd0e2278d71ae4ec3, .ex = -44, .sgn = 0x0},
+    {.hi = 0xb85f57ce3ffdaf93, .lo = 0xcbe39c28c0b32f97, .ex = -46, .sgn = 0x0},
+    {.hi = 0xb1ed7c5a58f0607c, .lo = 0xe20029a7fa6127e0, .ex = -48, .sgn = 0x0},
+    {.hi = 0xa66ce020ac66baa6, .lo = 0x728eaf3ca9a468a9, .ex = -50, .sgn = 0x0},
+    {.hi = 0x96e08c84ab94f5d5, .lo = 0x325d803753740f49, .ex = -52, .sgn = 0x0},
+};
+
+/* INV[n] is 1/(n+1) rounded to 128 bits */
+#define NMAX 47
+static const dint64_t INV[NMAX+1] = {
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = 0, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -1, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -2, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -2, .sgn = 0x0},
+    {.hi = 0xcccccccccccccccc, .lo = 0xcccccccccccccccd, .ex = -3, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -3, .sgn = 0x0},
+    {.hi = 0x9249249249249249, .lo = 0x2492492492492492, .ex = -3, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -3, .sgn = 0x0},
+    {.hi = 0xe38e38e38e38e38e, .lo = 0x38e38e38e38e38e4, .ex = -4, .sgn = 0x0},
+    {.hi = 0xcccccccccccccccc, .lo = 0xcccccccccccccccd, .ex = -4, .sgn = 0x0},
+    {.hi = 0xba2e8ba2e8ba2e8b, .lo = 0xa2e8ba2e8ba2e8ba, .ex = -4, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -4, .sgn = 0x0},
+    {.hi = 0x9d89d89d89d89d89, .lo = 0xd89d89d89d89d89e, .ex = -4, .sgn = 0x0},
+    {.hi = 0x9249249249249249, .lo = 0x2492492492492492, .ex = -4, .sgn = 0x0},
+    {.hi = 0x8888888888888888, .lo = 0x8888888888888889, .ex = -4, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -4, .sgn = 0x0},
+    {.hi = 0xf0f0f0f0f0f0f0f0, .lo = 0xf0f0f0f0f0f0f0f1, .ex = -5, .sgn = 0x0},
+    {.hi = 0xe38e38e38e38e38e, .lo = 0x38e38e38e38e38e4, .ex = -5, .sgn = 0x0},
+    {.hi = 0xd79435e50d79435e, .lo = 0x50d79435e50d7943, .ex = -5, .sgn = 0x0},
+    {.hi = 0xcccccccccccccccc, .lo = 0xcccccccccccccccd, .ex = -5, .sgn = 0x0},
+    {.hi = 0xc30c30c30c30c30c, .lo = 0x30c30c30c30c30c3, .ex = -5, .sgn = 0x0},
+    {.hi = 0xba2e8ba2e8ba2e8b, .lo = 0xa2e8ba2e8ba2e8ba, .ex = -5, .sgn = 0x0},
+    {.hi = 0xb21642c8590b2164, .lo = 0x2c8590b21642c859, .ex = -5, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -5, .sgn = 0x0},
+    {.hi = 0xa3d70a3d70a3d70a, .lo = 0x3d70a3d70a3d70a4, .ex = -5, .sgn = 0x0},
+    {.hi = 0x9d89d89d89d89d89, .lo = 0xd89d89d89d89d89e, .ex = -5, .sgn = 0x0},
+    {.hi = 0x97b425ed097b425e, .lo = 0xd097b425ed097b42, .ex = -5, .sgn = 0x0},
+    {.hi = 0x9249249249249249, .lo = 0x2492492492492492, .ex = -5, .sgn = 0x0},
+    {.hi = 0x8d3dcb08d3dcb08d, .lo = 0x3dcb08d3dcb08d3e, .ex = -5, .sgn = 0x0},
+    {.hi = 0x8888888888888888, .lo = 0x8888888888888889, .ex = -5, .sgn = 0x0},
+    {.hi = 0x8421084210842108, .lo = 0x4210842108421084, .ex = -5, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -5, .sgn = 0x0},
+    {.hi = 0xf83e0f83e0f83e0f, .lo = 0x83e0f83e0f83e0f8, .ex = -6, .sgn = 0x0},
+    {.hi = 0xf0f0f0f0f0f0f0f0, .lo = 0xf0f0f0f0f0f0f0f1, .ex = -6, .sgn = 0x0},
+    {.hi = 0xea0ea0ea0ea0ea0e, .lo = 0xa0ea0ea0ea0ea0ea, .ex = -6, .sgn = 0x0},
+    {.hi = 0xe38e38e38e38e38e, .lo = 0x38e38e38e38e38e4, .ex = -6, .sgn = 0x0},
+    {.hi = 0xdd67c8a60dd67c8a, .lo = 0x60dd67c8a60dd67d, .ex = -6, .sgn = 0x0},
+    {.hi = 0xd79435e50d79435e, .lo = 0x50d79435e50d7943, .ex = -6, .sgn = 0x0},
+    {.hi = 0xd20d20d20d20d20d, .lo = 0x20d20d20d20d20d2, .ex = -6, .sgn = 0x0},
+    {.hi = 0xcccccccccccccccc, .lo = 0xcccccccccccccccd, .ex = -6, .sgn = 0x0},
+    {.hi = 0xc7ce0c7ce0c7ce0c, .lo = 0x7ce0c7ce0c7ce0c8, .ex = -6, .sgn = 0x0},
+    {.hi = 0xc30c30c30c30c30c, .lo = 0x30c30c30c30c30c3, .ex = -6, .sgn = 0x0},
+    {.hi = 0xbe82fa0be82fa0be, .lo = 0x82fa0be82fa0be83, .ex = -6, .sgn = 0x0},
+    {.hi = 0xba2e8ba2e8ba2e8b, .lo = 0xa2e8ba2e8ba2e8ba, .ex = -6, .sgn = 0x0},
+    {.hi = 0xb60b60b60b60b60b, .lo = 0x60b60b60b60b60b6, .ex = -6, .sgn = 0x0},
+    {.hi = 0xb21642c8590b2164, .lo = 0x2c8590b21642c859, .ex = -6, .sgn = 0x0},
+    {.hi = 0xae4c415c9882b931, .lo = 0x0572620ae4c415ca, .ex = -6, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -6, .sgn = 0x0},
+};
+
+/* Convert a dint64_t value to a double, rounding according to the current
+   rounding mode. Contrary to log.c, the result might be subnormal. */
+static inline double
+dint_tod (dint64_t *a)
+{
+  if (a->ex < -1022)
+  {
+    /* a = N*2^-1074 + ..., where N = hi >> s */
+    int64_t s = -1011 - a->ex;
+    uint64_t N, rb, st;
+    if (s < 64)
+    {
+      N = a->hi >> s;
+      rb = (a->hi >> (s - 1)) & 1;
+      st = (a->hi << (65 - s)) || a->lo;
+    }
+    else
+    {
+      N = 0;
+      rb = s == 64;
+      st = s > 64 || (a->hi << 1) || a->lo;
+    }
+    /* 2^52 + N has ulp 1, thus adding rd rounds to an integer
+       with the current rounding mode */
+    double rd = (rb ? 0.5 : 0.0) + (st ? 0.25 : 0.0);
+    double T = 0x1p52 + (double) N;
+    if (a->sgn)
+      T = (-T - rd) + 0x1p52;
+    else
+      T = (T + rd) - 0x1p52;
+    /* avoid a wrong sign when the result is zero */
+    T = __builtin_copysign (T, a->sgn ? -1.0 : 1.0);
+    return T * 0x1p-1074;
+  }
+
+  b64u64_u r = {.u = (a->hi >> 11) | (0x3ffl << 52)};
+  /* r contains the upper 53 bits of a->hi, 1 <= r < 2 */
+
+  double rd = 0.0;
+  /* if round bit is 1, add 2^-53 */
+  if ((a->hi >> 10) & 0x1)
+    rd += 0x1p-53;
+
+  /* if trailing bits after the rounding bit are non zero, add 2^-54 */
+  if (a->hi & 0x3ff || a->lo)
+    rd += 0x1p-54;
+
+  r.u = r.u | a->sgn << 63;
+  r.f += (a->sgn == 0) ? rd : -rd;
+
+  /* |erf(x)| < 1, thus we cannot have a->ex > 0 */
+  b64u64_u e = {.u = ((a->ex + 1023) & 0x7ff) << 52};
+
+  return r.f * e.f;
+}
+
+/* Extract the exponent and significand of a double */
+static inline void
+dint_fromd (dint64_t *a, double b)
+{
+  b64u64_u x = {.f = b};
+  a->ex = (x.u >> 52) & 0x7ff;
+  a->hi = (x.u & 0xfffffffffffff) + (a->ex ? (1ul << 52) : 0);
+  a->ex -= 0x3ff;
+  uint32_t t = __builtin_clzl (a->hi);
+  a->sgn = b < 0.0;
+  a->hi = a->hi << t;
+  a->ex = a->ex - (t > 11 ? t - 12 : 0);
+  a->lo = 0;
+}
+
+/* Put in r an approximation of int(g(t), t=0..h) = sum(a[n]*h^(n+1)/(n+1)),
+   where g(t) = exp(-2*x0*t-t^2) and x0 = k/8. We use b[n] = a[n]*h^n,
+   which satisfies b[n+1] = (u*b[n] + w*b[n-1])/(n+1) with u = -2*x0*h
+   and w = -2*h^2. */
+static void
+erf_int (dint64_t *r, int k, double h)
+{
+  dint64_t H, U, W, b0, b1, b2, t;
+
+  dint_fromd (&H, h);
+  /* u = -k*h/4 and w = -2*h^2 are computed exactly */
+  if (k)
+  {
+    mul_dint_2 (&U, -k, &H);
+    U.ex -= 2;
+  }
+  else
+    cp_dint (&U, &ZERO);
+  mul_dint (&W, &H, &H);
+  W.ex ++;
+  W.sgn = 1;
+  cp_dint (&b0, &ONE);
+  cp_dint (&b1, &U);
+  cp_dint (r, &ONE);
+  mul_dint (&t, &b1, &INV[1]);
+  add_dint (r, r, &t);
+  for (int n = 1; n < NMAX; n++)
+  {
+    mul_dint (&t, &U, &b1);
+    mul_dint (&b2, &W, &b0);
+    add_dint (&b2, &b2, &t);
+    mul_dint (&b2, &b2, &INV[n]);
+    mul_dint (&t, &b2, &INV[n + 1]);
+    /* the terms below 2^-127*r are neglected; since |u|+|w| < 1.6 here,
+       once two consecutive terms are that small, the next ones decrease
+       geometrically */
+    int tiny = t.hi == 0 || t.ex < r->ex - 126;
+    if (!tiny)
+      add_dint (r, r, &t);
+    else if (n >= 8 && (b1.hi == 0 || b1.ex < r->ex - 126))
+      break;
+    cp_dint (&b0, &b1);
+    cp_dint (&b1, &b2);
+  }
+  mul_dint (r, r, &H);
+}
+
+static double __attribute__((noinline))
+cr_erf_accurate (double x)
+{
+  double ax = __builtin_fabs (x);
+  /* for 1/8 <= |x|, 8|x| is exact and x0 = k/8 <= 2|x|, thus h = |x| - x0
+     is exact by Sterbenz lemma */
+  int k = (ax < 0.125) ? 0 : (int) __builtin_ceil (8.0 * ax);
+  double h = ax - (double) k * 0.125;
+  dint64_t r;
+  if (h == 0) /* x = k/8 */
+    cp_dint (&r, &ERF0[k]);
+  else
+  {
+    erf_int (&r, k, h);
+    mul_dint (&r, &r, &EXP0[k]);
+    add_dint (&r, &ERF0[k], &r);
+  }
+  r.sgn = x < 0;
+  return dint_tod (&r);
+}
+
+double
+cr_erf (double x)
+{
+  b64u64_u t = {.f = x};
+  uint64_t ux = t.u & 0x7fffffffffffffff;
+  double h, l, err;
+
+  if (__builtin_expect (ux >= 0x4017afb48dc96627, 0))
+  {
+    /* |x| >= 0x1.7afb48dc96627p+2 */
+    if (ux > 0x7ff0000000000000)
+      return x + x; /* NaN */
+    double os = __builtin_copysign (1.0, x);
+    if (ux == 0x7ff0000000000000)
+      return os; /* +/-Inf */
+    /* here 1 - |erf(x)| < 2^-54, thus erf(x) rounds to +/-1 for rounding to
+       nearest, and to +/-1 or +/-(1 - 2^-53) for directed rounding */
+    return os - 0x1p-54 * os;
+  }
+
+  if (ux < 0x3fc0000000000000) /* |x| < 1/8 */
+  {
+    if (__builtin_expect (ux < 0x3c20000000000000, 0)) /* |x| < 2^-61 */
+    {
+      if (x == 0)
+        return x;
+      /* erf(x) = 2/sqrt(pi)*x*(1 - x^2/3 + ...), where the relative
+         contribution of x^2/3 is less than 2^-123.5, thus we approximate
+         erf(x) by 2/sqrt(pi)*x, with relative error < 2^-104 */
+      static const double c0h = 0x1.20dd750429b6dp+0, c0l = 0x1.1ae3a914fed8p-56;
+      if (ux < 0x0370000000000000) /* |x| < 2^-968 */
+      {
+        /* the result might be subnormal: we scale x by 2^106, and use the
+           same trick as in exp.c to get a correct rounding */
+        double X = x * 0x1p106;
+        a_mul (&h, &l, X, c0h);
+        l = __builtin_fma (X, c0l, l);
+        err = __builtin_fabs (h) * 0x1p-104;
+        double vd = h * 0x1p-106, vdl = (h - vd * 0x1p106) + l;
+        double fp = __builtin_fma (0x1p-106, vdl + err, vd);
+        double fm = __builtin_fma (0x1p-106, vdl - err, vd);
+        if (fp == fm)
+          return fp;
+        return cr_erf_accurate (x);
+      }
+      a_mul (&h, &l, x, c0h);
+      l = __builtin_fma (x, c0l, l);
+      err = __builtin_fabs (h) * 0x1p-104;
+    }
+    else
+    {
+      erf_small (&h, &l, x);
+      err = __builtin_fabs (h) * 0x1p-73;
+    }
+  }
+  else
+  {
+    erf_fast (&h, &l, __builtin_fabs (x));
+    err = h * 0x1.1p-67; /* 2^-66.988 < 0x1.1p-67 */
+    if (x < 0)
+    {
+      h = -h;
+      l = -l;
+    }
+  }
+
+  double left = h + (l - err), right = h + (l + err);
+  if (left == right)
+    return left;
+  return cr_erf_accurate (x);
+}
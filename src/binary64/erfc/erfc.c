@@ -0,0 +1,1095 @@
+/* Correctly rounded complementary error function for binary64 values.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+#include "dint.h"
+
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* Add a + b, such that *hi + *lo approximates a + b.
+   Assumes |a| >= |b|.
+   For rounding to nearest, hi + lo = a + b exactly. For directed rounding,
+   |(a+b)-(hi+lo)| <= 2^-105 min(|a+b|,|hi|), see "Note on FastTwoSum with
+   Directed Roundings" by Paul Zimmermann, https://hal.inria.fr/hal-03798376. */
+static inline void
+fast_two_sum (double *hi, double *lo, double a, double b)
+{
+  double e;
+
+  *hi = a + b;
+  e = *hi - a; /* exact */
+  *lo = b - e; /* exact */
+}
+
+/* Add a + b, such that *hi + *lo approximates a + b, without any assumption
+   on a and b (Knuth's 2Sum, exact for rounding to nearest). */
+static inline void
+two_sum (double *hi, double *lo, double a, double b)
+{
+  *hi = a + b;
+  double bp = *hi - a, ap = *hi - bp;
+  *lo = (a - ap) + (b - bp);
+}
+
+// Multiply exactly a and b, such that *hi + *lo = a * b.
+static inline void
+a_mul (double *hi, double *lo, double a, double b)
+{
+  *hi = a * b;
+  *lo = __builtin_fma (a, b, -*hi);
+}
+
+/* Put in (h,l) an approximation of (ch,cl) + z*(h,l),
+   assuming |ch| >= |z*(h+l)|. */
+static inline void
+fma_dd (double *h, double *l, double z, double ch, double cl)
+{
+  double th, tl;
+  a_mul (&th, &tl, *h, z);
+  tl = __builtin_fma (*l, z, tl);
+  fast_two_sum (h, l, ch, th);
+  *l += tl + cl;
+}
+
+/* For 0 <= i < 92, C[i] contains a degree-11 polynomial p(z) approximating
+   erfcx(x) = erfc(x)*exp(x^2) on the i-th interval I[i], where z = x - c[i]:
+   * for 0 <= i < 16, I[i] = [i/16,(i+1)/16], with c[0] = 0 and
+     c[i] = (2i+1)/32 for i >= 1;
+   * for 16 <= i < 92, with i = 16+16e+m, 0 <= m < 16, I[i] is the interval
+     [2^e*(1+m/16),2^e*(1+(m+1)/16)] and c[i] its middle point.
+   The coefficients of degree 0, 1 and 2 are double-double numbers, stored as
+   C[i][0]+C[i][1], C[i][2]+C[i][3] and C[i][4]+C[i][5], the coefficients
+   of degree 3 to 11 are in C[i][6] to C[i][14].
+   They were obtained as in erf.c. Adding the approximation error and the
+   rounding errors of erfcx_fast() (bounded as in erf.c, covering all rounding
+   modes), the relative error on erfcx(x) is bounded by 2^-67.314 (largest
+   for i=0). */
+static const double C[92][15] = {
+    {0x1p+0, -0x1.449783ee33e62p-81, -0x1.20dd750429b6dp+0, -0x1.1ad84cf90ee88p-56, 0x1p+0, -0x1.0dcd870f0dfd1p-59, -0x1.812746b0379e2p-1, 0x1.ffffffffffa64p-2, -0x1.341f6bc00cdfap-2, 0x1.5555554711af7p-3, -0x1.6023e497ffecfp-4, 0x1.55547a92f66bdp-5, -0x1.38e66381bd328p-6, 0x1.0e99443339efep-7, -0x1.88d93eb3778f1p-9},
+    {0x1.ce0a0646e5113p-1, -0x1.a86da354ffe7p-55, -0x1.eb1908db087a7p-1, 0x1.62f99acff9b32p-55, 0x1.9fffad725c45bp-1, -0x1.372f2e0483829p-58, -0x1.2d660b103537fp-1, 0x1.83be1c68d7481p-2, -0x1.c52835f8766d6p-3, 0x1.e8aaf7d706d31p-4, -0x1.ebb7153f6348ep-5, 0x1.d19e5fc243859p-6, -0x1.a1a9707bfb972p-7, 0x1.6500772447144p-8, -0x1.3df37d17b53fdp-9},
+    {0x1.b0e65a0b9b0e2p-1, 0x1.02d2582637e4p-55, -0x1.ba72ede4b2f93p-1, -0x1.bc901a651d429p-55, 0x1.6bc464dfdf173p-1, 0x1.bb16819ba81a6p-56, -0x1.0112d4167abe6p-1, 0x1.439973bc5be93p-2, -0x1.72de24dfa158ap-3, 0x1.88d5767941587p-4, -0x1.84c63f3fe241ap-5, 0x1.6a75f75153518p-6, -0x1.406d2c0046359p-7, 0x1.0e10dc8639994p-8, -0x1.771fc2b6e0809p-10},
+    {0x1.969b7a95d08eep-1, -0x1.498dcaec62022p-58, -0x1.8fd6e466c82f2p-1, -0x1.f77969c6fc58p-59, 0x1.3f24789f54c49p-1, 0x1.00f33d49523a5p-59, -0x1.b80938053cdadp-2, 0x1.0f03767ec21c7p-2, -0x1.3099f81469c6dp-3, 0x1.3cee29d0c098fp-4, -0x1.347fe85aae4c7p-5, 0x1.1b302ac9d88b1p-6, -0x1.ed687e4057d8dp-8, 0x1.9a1c2a27c1426p-9, -0x1.1b227a2ecafdap-10},
+    {0x1.7ecff36408789p-1, 0x1.346330a3c8d83p-57, -0x1.6a65f1200ea9dp-1, -0x1.109f130662ba1p-58, 0x1.18e347930458dp-1, -0x1.718af790b58d9p-57, -0x1.79dd5bfe47412p-2, 0x1.c7804d4684a7p-3, -0x1.f61881cd6008ap-4, 0x1.00989203cc3dcp-4, -0x1.eb58aeb27e458p-6, 0x1.bc18a905e9b2cp-7, -0x1.7d3b2f4bf4b38p-8, 0x1.3886133f02125p-9, -0x1.031709d5090a3p-10},
+    {0x1.693716c1c115fp-1, -0x1.92382ae36315p-57, -0x1.49650a631eae9p-1, 0x1.b5b20e760c8fp-57, 0x1.eff8b65f5d13ep-2, -0x1.3dbaa637960f2p-56, -0x1.4588640e4e3eep-2, 0x1.8011d3fa722ep-3, -0x1.9f3bb8fecf00ep-4, 0x1.a0ef6ae8eeacep-5, -0x1.88a7834ccb3efp-6, 0x1.5d729e69223b9p-7, -0x1.279e5f73742dfp-8, 0x1.de06fb48b51a6p-10, -0x1.ad36a349ca6f1p-11},
+    {0x1.558ef312ebe87p-1, -0x1.cc776d17e19a7p-55, -0x1.2c36c488f3c0dp-1, 0x1.78da44fb34133p-56, 0x1.b731667691c43p-2, -0x1.3fb923a595f84p-56, -0x1.19564fa128314p-2, 0x1.44e6561d197p-3, -0x1.588c09d201003p-4, 0x1.53e2857df74b7p-5, -0x1.3addbe2083b15p-6, 0x1.13ed7984aa39dp-7, -0x1.cc2c01e788731p-9, 0x1.6edc6586865d7p-10, -0x1.99dade0bc1c4p-12},
+    {0x1.439ea3683d4ccp-1, -0x1.6fe8b5cd39058p-57, -0x1.125630d699f5bp-1, 0x1.c53a09e41c427p-59, 0x1.860c79074a433p-2, -0x1.dd50289b274f8p-56, -0x1.e7c8b697b6cfep-3, 0x1.13b96e3bbb6a5p-3, -0x1.1ed4a2562ad0ep-4, 0x1.15ff7594bfb12p-5, -0x1.faaf746b4bd35p-7, 0x1.b53dc9d896edap-8, -0x1.6745b83f6ed69p-9, 0x1.1a8a6ec2a4a81p-10, -0x1.ee95e05825828p-12},
+    {0x1.3334ea3613dep-1, -0x1.9d7751d98899ap-55, -0x1.f6a5625dbca39p-2, -0x1.13026eac54c1ep-57, 0x1.5b61f82a5b851p-2, -0x1.47d5bdce17362p-57, -0x1.a821c8b450068p-3, 0x1.d571fdb4ec867p-4, -0x1.df18cee6d07ffp-5, 0x1.c83f33aa35959p-6, -0x1.99092a374aee8p-7, 0x1.5b98c2b97af85p-8, -0x1.19888f80fb37ep-9, 0x1.b4b01a9ba07cp-11, -0x1.10a0550314fb9p-12},
+    {0x1.242708751d9a7p-1, -0x1.9d19a17ce5b16p-56, -0x1.cd991ffa808c8p-2, -0x1.0ae43226f59d4p-57, 0x1.363b25ed7ee17p-2, -0x1.d891f192549fcp-57, -0x1.71dd5747519e3p-3, 0x1.90dae008a54ccp-4, -0x1.9160946e044b5p-5, 0x1.7798454ab1499p-6, -0x1.4b486d0720165p-7, 0x1.153ec38699473p-8, -0x1.bab0dc4efa0c5p-10, 0x1.529a534f0ca68p-11, -0x1.27a2918fd5c0dp-13},
+    {0x1.164fc6284ab1ep-1, 0x1.e84dd1f5f6e24p-56, -0x1.a8e46be6e2c85p-2, 0x1.9809e953ff4ddp-58, 0x1.15c9a58110905p-2, 0x1.0b48da21e45b1p-56, -0x1.43757462ea8cdp-3, 0x1.574e36a137343p-4, -0x1.514c7723376eep-5, 0x1.362c2a0ce5693p-6, -0x1.0d2b668ac9decp-7, 0x1.bbb3d7adda43bp-9, -0x1.5d0dd452d783ep-10, 0x1.0768ad26791ffp-11, -0x1.13b6d6db9f379p-12},
+    {0x1.098ea367ecbccp-1, 0x1.4da7414c32594p-55, -0x1.87fbbe45de3c9p-2, 0x1.48ba6512cdfdep-57, 0x1.f2c0ac1b437c1p-3, -0x1.9d0eb2705a978p-57, -0x1.1ba8ab3ac2a55p-3, 0x1.26df710907952p-4, -0x1.1c4d642c0516ap-5, 0x1.00ef8161a3645p-6, -0x1.b6c7967aa7884p-8, 0x1.642f473b99bbdp-9, -0x1.1438c837f90f7p-10, 0x1.9b378e08fdb0fp-12, -0x1.6c75ae96092afp-13},
+    {0x1.fb8e558b14d9p-2, 0x1.012959f294eb2p-56, -0x1.6a676e6756483p-2, 0x1.dbb3cd87aebf3p-58, 0x1.c0db0e94b2e14p-3, -0x1.e811b376c185fp-64, -0x1.f2da4c8e0115ep-4, 0x1.fbfb915a74e95p-5, -0x1.e0acd93ddbb4fp-6, 0x1.aaf565fdbfe7bp-7, -0x1.66bc8fd4d47d8p-8, 0x1.1ed3bd0273029p-9, -0x1.b680967245c63p-11, 0x1.41fbaf5b3a7p-12, -0x1.46d30b3fac053p-13},
+    {0x1.e5c0be6e7d145p-2, -0x1.04cf50fedf45fp-56, -0x1.4fc092b633c9p-2, -0x1.130181d131e19p-56, 0x1.94ec854982c56p-3, 0x1.32b98238b633ep-60, -0x1.b7ccc69dd6fap-4, 0x1.b6c442fdd827cp-5, -0x1.97832a2acbeaep-6, 0x1.63cbe6efbcb05p-7, -0x1.262f058042379p-8, 0x1.cf60200637564p-10, -0x1.5d377d9029b12p-11, 0x1.f9d494cef8fafp-13, -0x1.80cceaf493cffp-14},
+    {0x1.d188819e7fef8p-2, -0x1.844979f21f9afp-57, -0x1.37ae69215ef93p-2, -0x1.eb18fe892635fp-58, 0x1.6e24e4b083bb5p-3, -0x1.165302b782212p-60, -0x1.84b9d95908c0ep-4, 0x1.7c015c685787cp-5, -0x1.5a752bf5ff462p-6, 0x1.295b05fbda583p-7, -0x1.e3ed8cc1ee6e1p-9, 0x1.776e670845531p-10, -0x1.16e4e69d86a8fp-11, 0x1.8e9b50677f13bp-13, -0x1.a48bbbeab52dbp-14},
+    {0x1.bebec8c623082p-2, -0x1.2b1d76be5f51ap-59, -0x1.21e42f10c2fb8p-2, -0x1.e354cbddfc5e7p-56, 0x1.4bd3765bcc48fp-3, -0x1.f336b5155e6dfp-57, -0x1.586f59f62015fp-4, 0x1.49fb0d91297c9p-5, -0x1.275c656c7c865p-6, 0x1.f270cbd6f7de4p-8, -0x1.8f302ee7a14c9p-9, 0x1.311575094ff53p-10, -0x1.bed21bc3eab1ep-12, 0x1.3b05ecb8939c7p-13, -0x1.a28d1a5b102acp-14},
+    {0x1.ad4135f27b3a3p-2, -0x1.39b88b9d0f7efp-57, -0x1.0e1f54cc88b34p-2, -0x1.9e69f913bf7b3p-56, 0x1.2d61ccff1c82ap-3, -0x1.906f497f41968p-57, -0x1.31ed12ed4fffdp-4, 0x1.1f471e797e855p-5, -0x1.f8f47d7bbee2ap-7, 0x1.a2eae5a99ef4cp-8, -0x1.4a3ab559b0b71p-9, 0x1.f1493dce68839p-11, -0x1.673520fd3fcfcp-12, 0x1.f38d2a8f120dap-14, -0x1.4e364cdf943b8p-16},
+    {0x1.9cf14ccab36fdp-2, 0x1.74459c4b291f3p-57, -0x1.f84bf82a7cad5p-3, 0x1.e243cecf3fb0ep-59, 0x1.124f8226ee822p-3, -0x1.e7d8e17043984p-57, -0x1.105c026a8a696p-4, 0x1.f574c352ab41ep-6, -0x1.b0c6a99fc6141p-7, 0x1.610ad369b8b18p-8, -0x1.11f3231f047bdp-9, 0x1.9673b86aec16ep-11, -0x1.2155be3cb16c1p-12, 0x1.8d2c997e79b79p-14, -0x1.22b7bd11ddbd6p-14},
+    {0x1.8db3f1deb4eb9p-2, 0x1.cd9f525a330ep-60, -0x1.d78b697b48f51p-3, 0x1.9f51773f198dep-58, 0x1.f45d638dbaf79p-4, 0x1.13a2a41c0cae2p-58, -0x1.e60e752397a52p-5, 0x1.b6ba0faa4e983p-6, -0x1.73de39bb68c3ep-7, 0x1.2a521db7f5b7ap-8, -0x1.c7c64ac2aa612p-10, 0x1.4d2597807150fp-11, -0x1.d3d1ae6822af8p-13, 0x1.3cbf271e7b398p-14, -0x1.141a8e835381p-15},
+    {0x1.7f70fc8513185p-2, -0x1.73bf890ab57f7p-58, -0x1.b9a4d91890a01p-3, 0x1.85273ecde1fecp-57, 0x1.c94220e86bdb2p-4, 0x1.01a7736dbe894p-59, -0x1.b2ac22c7d266bp-5, 0x1.80c2776d4f491p-6, -0x1.4055d001ef2e7p-7, 0x1.f97b21cb0b37dp-9, -0x1.7c29d1eb5ec8cp-10, 0x1.11d1a51c5631fp-11, -0x1.7b2bce4adcd8ep-13, 0x1.faabf2bcf7041p-15, -0x1.b84e90edbbad3p-16},
+    {0x1.7212d85c1b672p-2, -0x1.b1cb73883fb71p-57, -0x1.9e4b134941461p-3, -0x1.8d60aa392f231p-57, 0x1.a2ab0004b658ep-4, -0x1.9ddbca4428c7ap-58, -0x1.858ebe10a1387p-5, 0x1.52371c841e216p-6, -0x1.149f194664143p-7, 0x1.ad5880dd675cfp-9, -0x1.3def6d6652ccfp-10, 0x1.c3563cd25e25cp-12, -0x1.343f281b31657p-13, 0x1.964df6662e9b4p-15, -0x1.1779169e2a3e6p-17},
+    {0x1.65863400bfe56p-2, 0x1.6bead0bfd21e2p-57, -0x1.853a509d46459p-3, -0x1.63c04127d1816p-57, 0x1.800c175c52ba9p-4, -0x1.a43cd7f851584p-58, -0x1.5ddb2d1dfc80bp-5, 0x1.29f9aa185a282p-6, -0x1.dee495decab91p-8, 0x1.6d97a9feb368bp-9, -0x1.0a955b51616b9p-10, 0x1.74f6a093c8d76p-12, -0x1.f64b9d4c6060ap-14, 0x1.46d32cf81a867p-15, -0x1.3af9812f1456dp-16},
+    {0x1.59b9baf5fee95p-2, -0x1.aa7f0e4b252adp-56, -0x1.6e36ec7993d65p-3, 0x1.d65bfadcecf2cp-58, 0x1.60ec72c20bda7p-4, -0x1.52248d8a81a42p-60, -0x1.3ad71f6db401ep-5, 0x1.071a6151d2923p-6, -0x1.9f81d666f8f98p-8, 0x1.3811f52f03794p-9, -0x1.c030799fd1a4p-11, 0x1.3501d34e19f5cp-12, -0x1.9ac17500fc072p-14, 0x1.078b28576347dp-15, 0x1.75a301bd4648fp-17},
+    {0x1.4e9dd90ccbffcp-2, -0x1.41773f1d9c0c9p-57, -0x1.590c4cf61f381p-3, 0x1.9ea646e837971p-61, 0x1.44e34220344a5p-4, -0x1.f6cc981f845e2p-58, -0x1.1be3c111422ebp-5, 0x1.d1a0015e1ebffp-7, -0x1.69566835711cp-8, 0x1.0b06111e82cd5p-9, -0x1.79b22c6ff06e5p-11, 0x1.00ad48d2175d1p-12, -0x1.506930decb009p-14, 0x1.aa4225158aac1p-16, -0x1.663198e4b8dd1p-19},
+    {0x1.442485e2d5deep-2, 0x1.254500bc10debp-58, -0x1.458bf413efc16p-3, -0x1.74b5a90a4dabep-57, 0x1.2b957c0e493b4p-4, -0x1.a04c7e65c02e2p-59, -0x1.00795842a9d57p-5, 0x1.9ce251ecfccf4p-7, -0x1.3aef0faca0172p-8, 0x1.ca08c522379c4p-10, -0x1.3f119af373861p-11, 0x1.ab7e933346ccdp-13, -0x1.146c1311c8c02p-14, 0x1.59967bbca9492p-16, 0x1.3cc70f5e94533p-18},
+    {0x1.3a411748a07dep-2, 0x1.bbd1268e76c0dp-56, -0x1.338cb3b24e93fp-3, 0x1.d78e03a214c4ep-57, 0x1.14b3e05a27802p-4, 0x1.8e5a2222c4347p-58, -0x1.d04744e27b343p-6, 0x1.6eddeb9fa9a56p-7, -0x1.131714fecf9b1p-8, 0x1.89bebd0c5265dp-10, -0x1.0e3030aeb2bbcp-11, 0x1.64e0aabfb620ap-13, -0x1.c74faff843056p-15, 0x1.18f0d272cf6b6p-16, 0x1.4000649f7e702p-18},
+    {0x1.30e8198f8ac16p-2, 0x1.38fb22b739a7bp-57, -0x1.22e9feca56756p-3, 0x1.adf121a9d0c57p-58, 0x1.fff2947fd9419p-5, -0x1.17c6ae47370dfp-60, -0x1.a4fd9c4778013p-6, 0x1.46a11e2953c13p-7, -0x1.e19a30f729c03p-9, 0x1.533e0fb29a45fp-10, -0x1.caaaf85926799p-12, 0x1.2aa68b1db21aep-13, -0x1.778740e0ca3b3p-15, 0x1.c9e34a6ab21abp-17, -0x1.b57d3d5e7e7a9p-17},
+    {0x1.280f2ce84da49p-2, 0x1.e2102395f609p-57, -0x1.1383536437eb1p-3, -0x1.e57ebeb3c45efp-60, 0x1.da5289f16cb49p-5, -0x1.98f7460a3cd2bp-59, -0x1.7e69eb4d3bc7fp-6, 0x1.235f07761aa96p-7, -0x1.a67402d8c6a98p-9, 0x1.24edd0a296799p-10, -0x1.863606ece5ae7p-12, 0x1.f50a6302b8dcbp-14, -0x1.371f357b8a78dp-15, 0x1.76372c40cf97ep-17, 0x1.e03aacf15343bp-19},
+    {0x1.1face71bc774ap-2, -0x1.d917d9148a6fp-57, -0x1.053bb97b6097bp-3, 0x1.a69dc3e733261p-60, 0x1.b81daf4f2b6c2p-5, 0x1.280bfb3f91533p-60, -0x1.5bf8078b515d8p-6, 0x1.0469912e2de9bp-7, -0x1.73533a609a9dfp-9, 0x1.faf80650e43d9p-11, -0x1.4cb8a3baf016ap-12, 0x1.a5472744d4502p-14, -0x1.01f91865448a1p-15, 0x1.328d5a6856f06p-17, -0x1.d7e715712646cp-19},
+    {0x1.17b8b903a94f1p-2, 0x1.afad123a52064p-56, -0x1.eff2a74c9a1e8p-4, -0x1.18abaeef28221p-59, 0x1.98f6ff32d2283p-5, 0x1.77ecba698879ep-59, -0x1.3d27e01a0103dp-6, 0x1.d258f26b64e2bp-8, -0x1.4709345b3ad58p-9, 0x1.b7a13b1380362p-11, -0x1.1c544e72fa80bp-12, 0x1.6307020448438p-14, -0x1.ad91de4612196p-16, 0x1.f73ccc5da2fe7p-18, 0x1.1a4d61faa0b49p-17},
+    {0x1.102ad73fd73f1p-2, 0x1.91a3da5f087cfp-56, -0x1.d749fdb508ebp-4, 0x1.02e83baaf1307p-59, 0x1.7c8ca2bc87f8dp-5, -0x1.8555eb593f234p-59, -0x1.218a86ee3e2fap-6, 0x1.a2526885d2cd8p-8, -0x1.209736c7e9232p-9, 0x1.7e061628ce17dp-11, -0x1.e7016c80e976fp-13, 0x1.2bdece17d3a64p-14, -0x1.65f563d7953adp-16, 0x1.9e4188b879ff9p-18, 0x1.369e5f63ff90bp-18},
+    {0x1.08fc25b8c5c0dp-2, 0x1.f59e3cc67c9ffp-56, -0x1.c053fe2470cfdp-4, 0x1.70ed98e26339bp-58, 0x1.62967516b1d49p-5, 0x1.3333c845da392p-60, -0x1.08bfb25aef5c2p-6, 0x1.77e70614b8d7ap-8, -0x1.fe4cbbeb1326cp-10, 0x1.4ca35992ad059p-11, -0x1.a1f6b9011e617p-13, 0x1.fbafaf63b05cbp-15, -0x1.2a789b6e9fcb7p-16, 0x1.55b1fd3feb5fcp-18, -0x1.36582a6a52d7dp-17},
+    {0x1.fdb50ebdc92cep-3, 0x1.7daf91811a6d9p-59, -0x1.a0c196a4dfbadp-4, 0x1.4f56f5b7f5f2p-59, 0x1.3fb5ad8f09d0fp-5, 0x1.b2a40148a1cd4p-59, -0x1.d04be8dc9de7p-7, 0x1.413a25f521959p-8, -0x1.a9b3057f6f85cp-10, 0x1.0f44e8540a0bep-11, -0x1.4d9b56c0d5b2cp-13, 0x1.8d0336bdb1a46p-15, -0x1.ca4b5baa7f81dp-17, 0x1.0157380d4ee6ap-18, -0x1.1dfbcfb79e1a5p-20},
+    {0x1.e4dac2d95830ep-3, 0x1.bd31760d9e89ep-58, -0x1.7b5d2754d7c15p-4, 0x1.3029c2cfb044p-58, 0x1.17b37f5230d5ep-5, 0x1.2df7862b3b41ep-59, -0x1.87af15ba61d1ep-7, 0x1.05fefdc10d5b4p-8, -0x1.5067009722ca3p-10, 0x1.a02387a274e34p-12, -0x1.f17e0b35786a5p-14, 0x1.20252dfd77cf8p-15, -0x1.44249b0538256p-17, 0x1.63181e2c447cap-19, -0x1.82aa7682cefbdp-21},
+    {0x1.ce30e45ab6494p-3, 0x1.c4556fc70b9e8p-57, -0x1.5a930ffb85474p-4, -0x1.378583803f9c1p-62, 0x1.ebb6ceff21772p-6, 0x1.6fb92637a54e6p-60, -0x1.4c4757001fa1fp-7, 0x1.ae11499bf38ddp-9, -0x1.0baab49fe4679p-10, 0x1.418a6cb31d1a3p-12, -0x1.75d5634f2013cp-14, 0x1.a5ac35a12fb4p-16, -0x1.ce6e6fc4a5fep-18, 0x1.ee452208710d2p-20, -0x1.e8d25b1228c98p-22},
+    {0x1.b9739404354ecp-3, 0x1.6bdaf66e8fb65p-57, -0x1.3db06d1993ad1p-4, 0x1.70084018ce386p-58, 0x1.b22478684a9f1p-6, -0x1.9c12383ee208dp-60, -0x1.1b6113e02116p-7, 0x1.6318a0bc892fcp-9, -0x1.acc072bb241f8p-11, 0x1.f46739b84a5ccp-13, -0x1.1b03880e69c21p-14, 0x1.36f5d30a601d1p-16, -0x1.4c8763a94c765p-18, 0x1.5ae82ddf75281p-20, -0x1.5988503527263p-22},
+    {0x1.a66919f10d593p-3, -0x1.e71d907e92465p-57, -0x1.2422065bd29b3p-4, -0x1.d8fb582154827p-59, 0x1.80ec0e5b3c127p-6, 0x1.3e43e4cac6a31p-62, -0x1.e5c88c64014edp-8, 0x1.26de51acacef1p-9, -0x1.598bd8c8d7ebcp-11, 0x1.8803e44040debp-13, -0x1.af98798d4cacfp-15, 0x1.ce18d36e5891fp-17, -0x1.e1ffe186b3636p-19, 0x1.eaf26fab12771p-21, -0x1.f45e792f8ff22p-23},
+    {0x1.94e01f8c78672p-3, -0x1.c4378eaad047bp-57, -0x1.0d6dfd1c8d18cp-4, -0x1.68e3e0fabf64fp-58, 0x1.56a29b70d66e8p-6, -0x1.48f30c2721a4ep-60, -0x1.a25d31dd359b2p-8, 0x1.ec5fef81b351p-10, -0x1.1828c3069d6d3p-11, 0x1.35186e824db8p-13, -0x1.4b5d03859b308p-15, 0x1.59d7bc41f865dp-17, -0x1.6000c1ad3eaa8p-19, 0x1.5e2188024b359p-21, -0x1.50f775a696781p-23},
+    {0x1.84ae4301fe0b3p-3, -0x1.00d13fa603dc9p-60, -0x1.f25dbcd862de7p-5, -0x1.a969ca1c3bf8fp-59, 0x1.3222d1cec4362p-6, 0x1.33d2787cebaa5p-63, -0x1.69eec99dfa61ep-8, 0x1.9d37605d8149ep-10, -0x1.c8e5724e469adp-12, 0x1.ea75954d507fp-14, -0x1.00189eae9e085p-15, 0x1.04a5e9ea42ea5p-17, -0x1.02ee0a08c3dbdp-19, 0x1.f73b2516e61b2p-22, -0x1.03fe87f115068p-23},
+    {0x1.75aef0b5da0b6p-3, -0x1.fb5c37a6aed66p-57, -0x1.ce1f87d3b2cf9p-5, 0x1.2bd7397368936p-60, 0x1.127e47b315d76p-6, 0x1.611ddb8876a3cp-64, -0x1.3a75a2c38e913p-8, 0x1.5c7f215bc925ap-10, -0x1.769b5b4dc36cap-12, 0x1.877036f90e8d1p-14, -0x1.8e5fc4933b8ap-16, 0x1.8b87872d42374p-18, -0x1.7fa669beb4d7cp-20, 0x1.6c4c98bf728a5p-22, -0x1.7023a14075514p-24},
+    {0x1.67c273e9aeab4p-3, 0x1.1aa99b630f274p-57, -0x1.ad9288a7ff761p-5, -0x1.c9e1e8c78c06p-59, 0x1.ede43490f14dbp-7, -0x1.3e391be0cbeddp-61, -0x1.1254578579235p-8, 0x1.274c3a323f3dep-10, -0x1.34bfdfc66dde9p-12, 0x1.3a31b9f7348a5p-14, -0x1.37bf183937049p-16, 0x1.2e0da96fd6dp-18, -0x1.1e34227d53ab9p-20, 0x1.0999abd62a4b6p-22, -0x1.8ddd3f4f64c68p-25},
+    {0x1.5acd331e82254p-3, 0x1.cc6b42c2f21c5p-57, -0x1.903e08fb40239p-5, 0x1.0591de710ab81p-59, 0x1.bdbc3f64b08f4p-7, -0x1.321d67ec83fa8p-61, -0x1.e08044f57a0fp-9, 0x1.f6b043889a599p-11, -0x1.ff7ec750ca39bp-13, 0x1.fb269916b51c7p-15, -0x1.eac93c60f819ap-17, 0x1.d038ee4fee947p-19, -0x1.adc10bd0d054p-21, 0x1.85f1c124ef30fp-23, -0x1.27f4758a5a57bp-25},
+    {0x1.4eb70f58ed3eap-3, 0x1.3ea979873665dp-58, -0x1.75bb89d0a7de5p-5, -0x1.635ef792196fcp-61, 0x1.937c138223a87p-7, 0x1.70fd8b52f2bebp-63, -0x1.a65dbc5ec39e2p-9, 0x1.adb39c1d4d4b8p-11, -0x1.a9b993c332cc1p-13, 0x1.9b74f3fe475c6p-15, -0x1.8483509de718bp-17, 0x1.66e0d106ded99p-19, -0x1.44b4006d87621p-21, 0x1.2028bcd01c4bap-23, -0x1.b737e47328062p-26},
+    {0x1.436adf606b637p-3, -0x1.5045bcf33881p-58, -0x1.5db3a1a9adabep-5, -0x1.cdb85ca82b81ep-60, 0x1.6e480729a23b6p-7, -0x1.d0d7c1fa53f6p-62, -0x1.74927abeed5ebp-9, 0x1.70d12d6c71efcp-11, -0x1.63f7caf17b3a1p-13, 0x1.4f813ac4f5311p-15, -0x1.353a390f28facp-17, 0x1.170cc5a46a9a7p-19, -0x1.ed9ec901ebf5ep-22, 0x1.ac9da019c2939p-24, -0x1.9328c860c833p-26},
+    {0x1.38d60190223f4p-3, -0x1.defdc837be22p-60, -0x1.47db73f966cfap-5, 0x1.f9ea7976c4cd1p-61, 0x1.4d68e4602ae56p-7, 0x1.4c67329afb975p-61, -0x1.49c05b7d5bcep-9, 0x1.3dcc9724290f4p-11, -0x1.2af41f3a9439ep-13, 0x1.12e63c6aa5c9ap-15, -0x1.eed2e8903458fp-18, 0x1.b4628441b3d43p-20, -0x1.797a92ceb50ecp-22, 0x1.40c1a07bb4895p-24, -0x1.19d5187a9b69ep-26},
+    {0x1.2ee7fff434fbap-3, -0x1.5a4f378169e6fp-59, -0x1.33f2a1e11bdb6p-5, 0x1.2eda7e37c96c6p-59, 0x1.30452b8af4d67p-7, -0x1.f61aeeb47069ap-61, -0x1.24c93d356c3cdp-9, 0x1.12dd38eda872bp-11, -0x1.f843d61dd695cp-14, 0x1.c494d7d459937p-16, -0x1.8de76a2fd1f61p-18, 0x1.570e06b383e71p-20, -0x1.2249f4f7193bfp-22, 0x1.e2f5484b69a9ep-25, -0x1.d080c7f27a41ap-27},
+    {0x1.25924350c7fadp-3, -0x1.f1fa3f7547c85p-57, -0x1.21c19b6563795p-5, 0x1.d492280b80e2ep-59, 0x1.165bb34252b2fp-7, -0x1.af37b45e2f058p-64, -0x1.04c2306c86f28p-9, 0x1.dd29d1ae213c3p-12, -0x1.ab03532d61ed3p-14, 0x1.7638cccf83a33p-16, -0x1.41856c800b223p-18, 0x1.0f168018bf159p-20, -0x1.c122c388b38e9p-23, 0x1.6dadb77fd1eb8p-25, -0x1.5f810d0c3179ep-29},
+    {0x1.1cc7d25f7330ap-3, 0x1.333b37a9590cfp-57, -0x1.11183dc68a5dep-5, 0x1.ed5821a155621p-60, 0x1.fe7eb2005f88p-8, 0x1.833dcf9ed3b6cp-63, -0x1.d1d2d8dcf2139p-10, 0x1.9f99243709e5fp-12, -0x1.6b00a15e813eap-14, 0x1.36c2c74abf7d7p-16, -0x1.050417ddf10a8p-18, 0x1.ae95fce2022bdp-21, -0x1.5d0baa66086b1p-23, 0x1.1675b6c029782p-25, -0x1.e9239423c1b4ep-28},
+    {0x1.10845e1dcb19ap-3, 0x1.34c6637d624cap-58, -0x1.f53cfd5c11186p-6, -0x1.e0a4d9a65bcf6p-60, 0x1.c21d6f4a4921ap-8, 0x1.bf9b392871a0ep-64, -0x1.8b46c64f91e7bp-10, 0x1.53e39641d53f7p-12, -0x1.1e807be459c4ap-14, 0x1.d9f64546a84cbp-17, -0x1.810db86c7f358p-19, 0x1.33806583a1bf6p-21, -0x1.e32585068a7aep-24, 0x1.76429b1bfd8adp-26, -0x1.1c4ea31fff994p-28},
+    {0x1.01afcc22e71b8p-3, 0x1.fef1b553322ap-60, -0x1.c14b6f7f3c2fp-6, -0x1.bbaf0cd6842b9p-63, 0x1.7f51652a46399p-8, 0x1.07a41627da54p-64, -0x1.406f090aa4007p-10, 0x1.06bf9a3516bc9p-12, -0x1.a712d1a0f442cp-15, 0x1.4eb8a60d0012ap-17, -0x1.0471a4a74578p-19, 0x1.8ee2b6b23b079p-22, -0x1.2cd27c046e1e3p-24, 0x1.bfcea99deee7dp-27, -0x1.4807f1b50c218p-29},
+    {0x1.e8b725e90fb8dp-4, 0x1.6a2cbae6f018p-58, -0x1.94e4c65b27fd6p-6, -0x1.55c27ea201fa4p-60, 0x1.48ea08fa97bd8p-8, 0x1.f9afeb8f93e56p-62, -0x1.0641d50f05c2bp-10, 0x1.9adeaa1391392p-13, -0x1.3c748962aff6bp-15, 0x1.dfa9cd1164523p-18, -0x1.65f119f1d0e99p-20, 0x1.072c0e3d5a4aap-22, -0x1.7d80709ee28cep-25, 0x1.1122ac34fa208p-27, -0x1.81e94863573afp-30},
+    {0x1.d0a2236d493eap-4, -0x1.a31a9e857287cp-59, -0x1.6ea9db64452a6p-6, -0x1.9ac0fccbd7aa4p-60, 0x1.1c3200b14f2fp-8, -0x1.744f449d6e968p-64, -0x1.b1138bae636d6p-11, 0x1.44a17930a97dcp-13, -0x1.df2332f43cb86p-16, 0x1.5c5596d48d2b7p-18, -0x1.f33ef82b02083p-21, 0x1.60d9ace18ad0fp-23, -0x1.ec2720ddda2e3p-26, 0x1.534a3f9e9ec08p-28, -0x1.cf2c44772bc6dp-31},
+    {0x1.bac6ca42e1bfbp-4, 0x1.409ab52cd78dcp-59, -0x1.4d86dc544600bp-6, -0x1.d6a626575dc8bp-68, 0x1.ee3ffedd01da2p-9, -0x1.da4ff212514bbp-66, -0x1.687d168ebc146p-11, 0x1.02fdcfb106fbbp-13, -0x1.6ecb6c32264a3p-16, 0x1.0025440a30b5p-18, -0x1.60fd09786ba23p-21, 0x1.e0328d66aaac6p-24, -0x1.429187bb27522p-26, 0x1.acb546028e287p-29, -0x1.1bf230514d53cp-31},
+    {0x1.a6dab49575b6dp-4, 0x1.c84c757f02c63p-62, -0x1.30a0ebefa7ff4p-6, -0x1.c7d9a59f88033p-61, 0x1.b04ef16d7ef9bp-9, 0x1.4ba9cb5585ee3p-63, -0x1.2e52cf81e3f52p-11, 0x1.a0faa96f4a7eep-14, -0x1.1bb8488e4d26fp-16, 0x1.7d2054ac4ba63p-19, -0x1.f99c8bf368781p-22, 0x1.4b59282f3121fp-24, -0x1.ad3fe617e5987p-27, 0x1.1336772994989p-29, -0x1.562663aaf3331p-32},
+    {0x1.949fbeb63d761p-4, 0x1.e8e2b5fe9ddbcp-59, -0x1.1748bb019ff2dp-6, 0x1.49b2988059b11p-60, 0x1.7c2ef77e9114dp-9, 0x1.09cf73f8350a6p-64, -0x1.fe9e2a1afd5bep-12, 0x1.527c1e396f005p-14, -0x1.bb2e614fa8b54p-17, 0x1.1ea5688f9c16p-19, -0x1.6e7df04a772edp-22, 0x1.cf4dac739c8cdp-25, -0x1.21a50b8b00737p-27, 0x1.66b5d48a3f5ffp-30, -0x1.ba2bf57afdea9p-33},
+    {0x1.83e1a154593d6p-4, -0x1.938ac83a4beefp-58, -0x1.00f0a28e0b70dp-6, 0x1.da563fae225e6p-63, 0x1.500652770df53p-9, 0x1.cb52dcc52a0f3p-65, -0x1.b1ffaa6f881fcp-12, 0x1.14e914d25fdbep-14, -0x1.5d443153c44aap-17, 0x1.b3956212e3e34p-20, -0x1.0ca90beca33ffp-22, 0x1.47e8bb8ad7fc8p-25, -0x1.8c1e388320922p-28, 0x1.da3899337e795p-31, -0x1.1804223f991c1p-33},
+    {0x1.747414effdaep-4, -0x1.9c4908d8bef46p-59, -0x1.da4a7e35becddp-7, 0x1.b99050c9e97afp-61, 0x1.2a6189daf30dep-9, -0x1.8157bc29c554ep-63, -0x1.7318428a380c4p-12, 0x1.c85edd24048bcp-15, -0x1.1594dc883bfaap-17, 0x1.4e1f24cf7d427p-20, -0x1.8e129870fc2a8p-23, 0x1.d58e738971234p-26, -0x1.124591a3a4877p-28, 0x1.3dae28b0e83cbp-31, -0x1.6042c170e2892p-34},
+    {0x1.66315c5706f0bp-4, 0x1.e933370d319d5p-59, -0x1.b70fb7681780ep-7, -0x1.e74112602176cp-61, 0x1.0a1ac60286bf7p-9, -0x1.f5335e9f4eebep-63, -0x1.3f1651ac0ffcdp-12, 0x1.7a9f9dad403cfp-15, -0x1.bcb6670012f2fp-18, 0x1.02982662398ffp-20, -0x1.29daa3196fa43p-23, 0x1.53dec10dc03a5p-26, -0x1.8046f02d00019p-29, 0x1.af0746da40d4cp-32, -0x1.e8b33c5159476p-35},
+    {0x1.58f91d4c57ccap-4, -0x1.3663134010a4cp-58, -0x1.9794607880b05p-7, 0x1.e84f575df8577p-65, 0x1.dc8f5a234ea65p-10, 0x1.7303acf7d8fcap-65, -0x1.13ce26f04be19p-12, 0x1.3c1e9a550f8a6p-15, -0x1.66e18362b4a8dp-18, 0x1.93a775f1e058bp-21, -0x1.c1eab16cf4adbp-24, 0x1.f111a49918539p-27, -0x1.103ad5e955597p-29, 0x1.27ebd56fe001ep-32, -0x1.357d35d5f493bp-35},
+    {0x1.4caf750fa3231p-4, -0x1.4f0cdf5352cep-61, -0x1.7b56355cc257fp-7, -0x1.5b66160567c6ap-61, 0x1.ac57ccfb07de2p-10, -0x1.1ad83babc2f65p-64, -0x1.df2033814383ap-13, 0x1.09820b7f1d8f3p-15, -0x1.23a26323a2725p-18, 0x1.3d8a866003689p-21, -0x1.56cf678bf6dc6p-24, 0x1.6f0490984c664p-27, -0x1.85bf03b3692e8p-30, 0x1.9aeeaa9d10a39p-33, -0x1.affa411d9aa7p-36},
+    {0x1.413c3b2dcd435p-4, -0x1.5144f6235529ep-59, -0x1.61e827af73702p-7, 0x1.8b30175056aa4p-61, 0x1.825df5629cdd9p-10, 0x1.d5697f0f4ca14p-64, -0x1.a214309a9f1fdp-13, 0x1.c07f431ce4a68p-16, -0x1.dd15aee38f899p-19, 0x1.f75447853a615p-22, -0x1.07611ceeb1d41p-24, 0x1.117a586cee0d8p-27, -0x1.19cd277c1587cp-30, 0x1.206169502cd3ep-33, -0x1.0c9868c419c54p-36},
+    {0x1.368a68664ffeep-4, -0x1.97fb2b13afa3bp-59, -0x1.4aee62ebfbeecp-7, -0x1.63580abb14c4ep-61, 0x1.5da94d30efafbp-10, -0x1.c8f072908a7c4p-65, -0x1.6e62a07a7ecdcp-13, 0x1.7ccc2800593edp-16, -0x1.88a45c37a8f3ap-19, 0x1.91b83fc11a51dp-22, -0x1.97e4ac6b825d8p-25, 0x1.9b17037990822p-28, -0x1.9b51f2b3f5ac5p-31, 0x1.98e0597a5124dp-34, -0x1.785b9a82be2e7p-37},
+    {0x1.2c8799eb812b4p-4, 0x1.f58251c42b72bp-58, -0x1.361b27d94cc85p-7, -0x1.71689d4af7f5cp-63, 0x1.3d6dfc18ff169p-10, -0x1.418285b6ab337p-65, -0x1.426342e99bcdcp-13, 0x1.44ec0a4ad2cd7p-16, -0x1.45074f6de50c1p-19, 0x1.42c18c81f4377p-22, -0x1.3e33d22dc20fp-25, 0x1.37827b7697a0bp-28, -0x1.2edfe28c4ff89p-31, 0x1.24a6f25336d61p-34, -0x1.ff73e56193a2ap-38},
+    {0x1.2323ab16589c9p-4, 0x1.f2945db0274ebp-59, -0x1.232c4d153e57cp-7, -0x1.53e423247e24cp-62, 0x1.2103cd5bcf8c1p-10, 0x1.00264fd7e4defp-65, -0x1.1cc27d2501a58p-13, 0x1.168b456c3da51p-16, -0x1.0e8a14a54aae1p-19, 0x1.04f21775fc017p-22, -0x1.f3f7a6d3d491bp-26, 0x1.dbc66c7612a08p-29, -0x1.c1c57d3437dep-32, 0x1.a6c3d39a8b36cp-35, -0x1.addb7bd242c9p-38},
+    {0x1.1618fbc75f8ap-4, 0x1.8e8f40e613c5bp-60, -0x1.09d8af47983fcp-7, 0x1.071ec333bbebap-67, 0x1.f8c382c54421dp-11, 0x1.a02a4b0ff08bap-67, -0x1.dbf548a05f704p-14, 0x1.bdd1fbfc366a7p-17, -0x1.9edfad3a4c725p-20, 0x1.7f9c1cb27795fp-23, -0x1.607a42de5e0d4p-26, 0x1.41e04ed568b2ap-29, -0x1.242740fce0973p-32, 0x1.08373b2f5307dp-35, -0x1.d9b23538617cp-39},
+    {0x1.0669c59166c17p-4, 0x1.a97807af3fbaep-59, -0x1.d9c4ed21533bp-8, 0x1.f4d5a0575974fp-62, 0x1.a909f1969e99dp-11, -0x1.d1b9db7e801afp-67, -0x1.7b022618f5caap-14, 0x1.4ff2fd6a385b5p-17, -0x1.2809b14731e92p-20, 0x1.035da05fa5d3cp-23, -0x1.c3e5fbb7bc2bfp-27, 0x1.877b2b2aac803p-30, -0x1.5147fafc81e83p-33, 0x1.21a13420b69b4p-36, -0x1.ee0706eca0958p-40},
+    {0x1.f0c9d48847e15p-5, 0x1.5f45532faf7d6p-59, -0x1.a8c62560288bbp-8, 0x1.6ce37a3fed6bp-64, 0x1.692e54463ff4fp-11, -0x1.b1f0d1baa497dp-65, -0x1.316dfd27c4159p-14, 0x1.00e4f208a768dp-17, -0x1.addaa926e2e96p-21, 0x1.65c15fb50c129p-24, -0x1.28382dc1fed74p-27, 0x1.e80d2b35e3afcp-31, -0x1.900d4f45b3ecp-34, 0x1.46eea127f30a4p-37, -0x1.08fabb8955049p-40},
+    {0x1.d7947dc6e8dafp-5, -0x1.248d18a8ff3dap-60, -0x1.7ef85ef3d1684p-8, 0x1.2104f1296d37fp-65, 0x1.3572837068f82p-11, -0x1.7fb42321a4c83p-65, -0x1.f19a40f07df56p-15, 0x1.8e20f7770d8eap-18, -0x1.3d01ef23bab99p-21, 0x1.f66f55edf282cp-25, -0x1.8c4c65de48553p-28, 0x1.372385a45856dp-31, -0x1.e6547ca939bf4p-35, 0x1.7b0a0c4396bdfp-38, -0x1.26435761ab0edp-41},
+    {0x1.c0cb9b2935b92p-5, -0x1.d3d9c8742c622p-59, -0x1.5b059dc34c3d5p-8, 0x1.8f961fc5e2a47p-62, 0x1.0b1a41bf02a49p-11, -0x1.df5781770b5c8p-66, -0x1.99532cdaf37ccp-15, 0x1.383e40afaa1cp-18, -0x1.da48652d17ae2p-22, 0x1.66a54fcd759c7p-25, -0x1.0e0ac80525d5fp-28, 0x1.94efd79348157p-32, -0x1.2e570e3b562c7p-35, 0x1.c2559479deefdp-39, -0x1.4dd994450ca9ep-42},
+    {0x1.ac1a2600f9687p-5, -0x1.19356d39010cdp-59, -0x1.3be37b8224a8dp-8, 0x1.5ccca80faaa3fp-64, 0x1.d03c050c12cbp-12, -0x1.faa6a818c6d48p-66, -0x1.53b80a02ad7abp-15, 0x1.ef2de61e6b78fp-19, -0x1.6770ae0c3f142p-22, 0x1.03dfafd57cf65p-25, -0x1.764cd33e99e78p-29, 0x1.0c822e984f6e5p-32, -0x1.7fc1c7586531cp-36, 0x1.1198d86de4ad4p-39, -0x1.843b0b8e1f6e7p-43},
+    {0x1.9939e4f6ef547p-5, 0x1.94082d2cacc5ep-64, -0x1.20c006896f723p-8, -0x1.d83a972dc7b6cp-62, 0x1.95ede2d54de93p-12, -0x1.b389d127c1492p-66, -0x1.1c4103d18e178p-15, 0x1.8c9d5da786001p-19, -0x1.13ac64c0c4a8dp-22, 0x1.7dd2a969319e8p-26, -0x1.0777a9b0d99acp-29, 0x1.6a4c4a458596ep-33, -0x1.f06fb692b34e8p-37, 0x1.5363a5e521aa4p-40, -0x1.cf9a8b3b28a3cp-44},
+    {0x1.87f0587e0b6b4p-5, -0x1.f02069f152ba1p-62, -0x1.08f40799540edp-8, -0x1.0f8bdc73040f4p-64, 0x1.64f6aa6bfabep-12, -0x1.b2f362153210bp-67, -0x1.df41a15a9cdd1p-16, 0x1.409dfb5be2e49p-19, -0x1.ab84d587eadcap-23, 0x1.1c126cae5af6p-26, -0x1.7840d81c73569p-30, 0x1.f0b36b3a395d2p-34, -0x1.46c7db76eef69p-37, 0x1.ad1ee050de5d5p-41, -0x1.1888c208a5e7fp-44},
+    {0x1.780c6345b4de9p-5, -0x1.3cfb86299ba87p-59, -0x1.e7f2059678dd5p-9, 0x1.2d074dfb09f03p-63, 0x1.3b8b7f402a8ebp-12, 0x1.81ea4b7ada978p-67, -0x1.96ce3ebd3b987p-16, 0x1.0565cdd23b7dfp-19, -0x1.4edf1d767d66dp-23, 0x1.aba916817c4e3p-27, -0x1.103c9af992876p-30, 0x1.5989211ba5c62p-34, -0x1.b53b5d5fcec35p-38, 0x1.1420e20af1e2cp-41, -0x1.6164643ea8db6p-45},
+    {0x1.69647c7510299p-5, -0x1.ee743a4894497p-59, -0x1.c2c3adc1ab71p-9, -0x1.7b109e77ac4d1p-63, 0x1.1846ff5dc5bbcp-12, 0x1.be6eba09eeebap-66, -0x1.5b82416819eafp-16, 0x1.ad999f688a43bp-20, -0x1.08c479c258df2p-23, 0x1.456a39cd56a7bp-27, -0x1.8ecec5637c38fp-31, 0x1.e75d0f30906bbp-35, -0x1.28f44b935fdd6p-38, 0x1.693e9b2ec1311p-42, -0x1.b2a647cfe64fcp-46},
+    {0x1.5bd54832ed9c3p-5, -0x1.08c2c9ae18d3fp-59, -0x1.a1aa73f9e2f99p-9, 0x1.71be577ba377p-68, 0x1.f42027fda580cp-13, 0x1.a06a005532f0fp-68, -0x1.2a9b9e9ca3a4bp-16, 0x1.639a528d9dfafp-20, -0x1.a654195855f21p-24, 0x1.f439dad3affc3p-28, -0x1.277496d56cb1bp-31, 0x1.5c180b03ae979p-35, -0x1.990c774a0391bp-39, 0x1.dfde9b9e5392cp-43, -0x1.0d0e8d7509ebp-46},
+    {0x1.4f407d0aad072p-5, 0x1.4c9bcd6cb5da7p-59, -0x1.84131dfa095a4p-9, -0x1.c60b20713decfp-63, 0x1.c00f47ccfd902p-13, -0x1.94da1faf6e644p-67, -0x1.01fec1f52625bp-16, 0x1.285a9be8ffd43p-20, -0x1.538e6390e9ba1p-24, 0x1.8414c827cbefdp-28, -0x1.ba6fdfd5f01d4p-32, 0x1.f728ee6349ab1p-36, -0x1.1d6734681485dp-39, 0x1.434b987685b79p-43, -0x1.727db86a50f16p-47},
+    {0x1.438c03b54316dp-5, 0x1.d85426abda7dcp-60, -0x1.69836d73ecf92p-9, -0x1.8dc3bf652ac9p-64, 0x1.92f63a0408f07p-13, -0x1.ed07306fe3bf1p-68, -0x1.c016858e0201ep-17, 0x1.f11588c7935fep-21, -0x1.13118c0d58c46p-24, 0x1.2fb68d4ceae65p-28, -0x1.4e8f7cf77ac27p-32, 0x1.6fb07e9cfe52fp-36, -0x1.932a61cbd388dp-40, 0x1.b974af75cf6ebp-44, -0x1.eb0f19d56981p-48},
+    {0x1.38a143b28d6d4p-5, -0x1.5c1e5e9b8b11p-60, -0x1.5195371eac394p-9, 0x1.a22c64da2aaf5p-63, 0x1.6bb4e246a87c5p-13, -0x1.1bc490955635cp-68, -0x1.86f9ae5b446bdp-17, 0x1.a35ac542b4704p-21, -0x1.c0cd00b5a4da1p-25, 0x1.df42de6c3377dp-29, -0x1.feac79384cd23p-33, 0x1.0f7bc10c578aep-36, -0x1.200c20c93cce7p-40, 0x1.312ececc4135bp-44, -0x1.286733484b379p-48},
+    {0x1.2e6c929b52165p-5, -0x1.65b83901bca64p-62, -0x1.3bf2903ef31b1p-9, 0x1.5145fa67e30cbp-63, 0x1.49611f5260891p-13, 0x1.7fd53526760d1p-68, -0x1.56a9984a10431p-17, 0x1.63bd15e484909p-21, -0x1.708c91b3f90fcp-25, 0x1.7d0901aa04e9p-29, -0x1.892375f1642f9p-33, 0x1.94cd3373af569p-37, -0x1.9ffdfcf3e1a9cp-41, 0x1.aae969ab00669p-45, -0x1.91359ea133e6p-49},
+    {0x1.24dcbe974e1ebp-5, 0x1.d90fcdd1de7abp-60, -0x1.2852ce71a1307p-9, 0x1.cdd11170e361ep-66, 0x1.2b3b5f7373065p-13, 0x1.5b4a7eb124404p-67, -0x1.2d92fd52a422p-17, 0x1.2f570b0cba6d8p-21, -0x1.3085c73ea62d4p-25, 0x1.311e4e5aa0c79p-29, -0x1.31209aa09bf34p-33, 0x1.308d7ec17d7d8p-37, -0x1.2f686349c0d1cp-41, 0x1.2de5e20ce3d2bp-45, -0x1.21a699961121dp-49},
+    {0x1.17999659ab8b6p-5, -0x1.30529f840ece5p-59, -0x1.0e23ef619e36p-9, -0x1.1b94f4115c5e3p-63, 0x1.04877d0063a6bp-13, -0x1.96a89cdb5011ap-69, -0x1.f59df6f4982d7p-18, 0x1.e209aa452eba8p-22, -0x1.ce66254c92fe6p-26, 0x1.bac69a1b483c3p-30, -0x1.a73d42d4b6cdfp-34, 0x1.93db0752b78bdp-38, -0x1.80b0767d0e878p-42, 0x1.6ec3c2c1ade15p-46, -0x1.5c3cfd4b644b2p-50},
+    {0x1.07ad15536656dp-5, -0x1.f5938b8e23e41p-61, -0x1.e096c3c71f7fp-10, 0x1.073f9743d344dp-65, 0x1.b54485023ab65p-14, 0x1.86908cc84215ap-68, -0x1.8d36ddca2fb63p-18, 0x1.6841368b43492p-22, -0x1.463740bf22e9dp-26, 0x1.26ed3e15ed069p-30, -0x1.0a383ed3d72cbp-34, 0x1.dfdc6ded799a6p-39, -0x1.afcd5ba2449b7p-43, 0x1.84deaeb31412dp-47, -0x1.5ce7a4d87221cp-51},
+    {0x1.f2ee84766fae7p-6, 0x1.7250969cffc03p-60, -0x1.ae41bec497d41p-10, 0x1.770b986f4d2ccp-64, 0x1.727fe320214a1p-14, 0x1.1109bcd486165p-71, -0x1.3e956fa0e4453p-18, 0x1.118d070cace64p-22, -0x1.d5192e9692cc1p-27, 0x1.91a56919f2b35p-31, -0x1.57684f3de4febp-35, 0x1.25333b515b6f8p-39, -0x1.f3f7b98a18ea8p-44, 0x1.aa94915a91cf8p-48, -0x1.6a3c23850d6c8p-52},
+    {0x1.d96a02b92c7d2p-6, 0x1.6fe9a1fc2cba5p-65, -0x1.836d6d4a6a46p-10, 0x1.22d2609f0198ep-64, 0x1.3ca5867af7d5cp-14, -0x1.f9c21ba9aabep-68, -0x1.027643082657bp-18, 0x1.a564c9091abddp-23, -0x1.57139ee1928c8p-27, 0x1.16f52211db2d7p-31, -0x1.c510c853646ffp-36, 0x1.6f73e35d49e7ap-40, -0x1.29a3cb1e1f063p-44, 0x1.e27fa804d4677p-49, -0x1.869f3cdecb9b1p-53},
+    {0x1.c260728555995p-6, 0x1.a142a307b8337p-60, -0x1.5eae9afb8256bp-10, -0x1.a8cce29592699p-64, 0x1.10bbf3169a3c8p-14, 0x1.0805d4662890ap-68, -0x1.a7ba08bba1922p-19, 0x1.48c57e66bad84p-23, -0x1.fd98a001ab862p-28, 0x1.8a7a991d5351bp-32, -0x1.31036207c64d1p-36, 0x1.d721a266bac39p-41, -0x1.6b714a370b059p-45, 0x1.1888ebc80291ap-49, -0x1.b0614e726aabcp-54},
+    {0x1.ad79a3c2ddabfp-6, -0x1.d4d80320811eap-61, -0x1.3eebf4f31d394p-10, -0x1.cbbc6b9d06184p-65, 0x1.d925385ccdf3p-15, 0x1.6fba135464667p-69, -0x1.5e997103cd4fdp-19, 0x1.03843fd907d8ap-23, -0x1.7fc8f9bbc7002p-28, 0x1.1b7ab4958240ap-32, -0x1.a25654d99dd5ap-37, 0x1.3459b3fa303eep-41, -0x1.c61622a7ce922p-46, 0x1.4e87586d54305p-50, -0x1.eade33704b6c5p-55},
+    {0x1.9a6cfe4b0d001p-6, -0x1.e39a5966b2549p-64, -0x1.2348dd924b18cp-10, 0x1.a3e03a7bdc22cp-68, 0x1.9d0d6aa6ca843p-15, 0x1.625701acc6861p-69, -0x1.2493715b9a62bp-19, 0x1.9e133df9695f3p-24, -0x1.24bb06969de82p-28, 0x1.9d7dce6995f05p-33, -0x1.23c0d54949bd4p-37, 0x1.9b511e3a0d457p-42, -0x1.21a9ccf94cc75p-46, 0x1.982d06973d6adp-51, -0x1.1d9658ce13a7bp-55},
+    {0x1.88fe35af1512bp-6, 0x1.0c653ada5ffabp-61, -0x1.0b165e58f4594p-10, -0x1.5deabeeaf9e4ap-65, 0x1.6ab638dc5f303p-15, -0x1.876c0da2a7fa9p-69, -0x1.ec2192fbda601p-20, 0x1.4d90eb6ad1991p-24, -0x1.c3c75f2b982a5p-29, 0x1.31abaf348fd27p-33, -0x1.9d4356a020204p-38, 0x1.171dc135c2245p-42, -0x1.78b1fb70396e7p-47, 0x1.fc9e38b952857p-52, -0x1.5718a274fca9ap-56},
+    {0x1.78faca60fd196p-6, -0x1.3f981a9f87e4dp-60, -0x1.eb908f3f7b3b7p-11, 0x1.6a2267cda3387p-66, 0x1.403968c57fb6ep-15, -0x1.eb72afc164c3dp-69, -0x1.a0de6c14e498p-20, 0x1.0f1e0580b2788p-24, -0x1.605c8642a0a12p-29, 0x1.c9939ce9d358fp-34, -0x1.28dca4d67fbdbp-38, 0x1.80e0426b8e6fap-43, -0x1.f292ff016e15ep-48, 0x1.43124b46ba7cdp-52, -0x1.a5c67c260734bp-57},
+    {0x1.6a382043f7ebdp-6, -0x1.bcabc6697c6b1p-65, -0x1.c5da7001373c4p-11, 0x1.a2795020223fdp-65, 0x1.1c1e05ffcfa4p-15, -0x1.afe532ebc8ed3p-70, -0x1.63734205be7e8p-20, 0x1.bc5ac677ae597p-25, -0x1.15897eb2d643ap-29, 0x1.5a6db1c6696c1p-34, -0x1.b0180a7dd26e8p-39, 0x1.0d44ad5426cb8p-43, -0x1.4f590c8dbee21p-48, 0x1.a1ce217b32ba8p-53, -0x1.03f8b3b728582p-57},
+    {0x1.5c92036f02bcep-6, 0x1.5d03ad1a0d0b9p-66, -0x1.a45161db933c4p-11, -0x1.a66e3543ad637p-65, 0x1.fa7994b33bd68p-16, -0x1.7b127242f5f6bp-70, -0x1.30ee4987938cbp-20, 0x1.6eeaeaaf756d2p-25, -0x1.b931e3a3af09dp-30, 0x1.0911729c57e82p-34, -0x1.3e47e52aebf73p-39, 0x1.7de8ac3b636c3p-44, -0x1.c9f25d4816949p-49, 0x1.12a5ecd22549ap-53, -0x1.42033c03b3ca9p-58},
+    {0x1.4fe97f404ff9ap-6, -0x1.6a3b212fec53p-61, -0x1.865d4727e2705p-11, 0x1.0d6d63af2392ap-65, 0x1.c558682584702p-16, 0x1.b2dc492d9009dp-70, -0x1.071234db7fe35p-20, 0x1.311d4c40a17edp-25, -0x1.61a55321bea0dp-30, 0x1.99a114d4b26cap-35, -0x1.da2a8d6534f49p-40, 0x1.1241d2d8e445ep-44, -0x1.3d0a4bf61206dp-49, 0x1.6ea70a07a0258p-54, -0x1.bc8b2b29d9572p-59},
+};
+
+/* T0[i] = 2^(i/64) and T1[i] = 2^(i/4096) as double-double numbers */
+static const double T0[64][2] = {
+    {0x1p+0, 0x0p+0}, {0x1.02c9a3e778061p+0, -0x1.19083535b085dp-56},
+    {0x1.059b0d3158574p+0, 0x1.d73e2a475b465p-55}, {0x1.0874518759bc8p+0, 0x1.186be4bb284ffp-57},
+    {0x1.0b5586cf9890fp+0, 0x1.8a62e4adc610bp-54}, {0x1.0e3ec32d3d1a2p+0, 0x1.03a1727c57b53p-59},
+    {0x1.11301d0125b51p+0, -0x1.6c51039449b3ap-54}, {0x1.1429aaea92dep+0, -0x1.32fbf9af1369ep-54},
+    {0x1.172b83c7d517bp+0, -0x1.19041b9d78a76p-55}, {0x1.1a35beb6fcb75p+0, 0x1.e5b4c7b4968e4p-55},
+    {0x1.1d4873168b9aap+0, 0x1.e016e00a2643cp-54}, {0x1.2063b88628cd6p+0, 0x1.dc775814a8495p-55},
+    {0x1.2387a6e756238p+0, 0x1.9b07eb6c70573p-54}, {0x1.26b4565e27cddp+0, 0x1.2bd339940e9d9p-55},
+    {0x1.29e9df51fdee1p+0, 0x1.612e8afad1255p-55}, {0x1.2d285a6e4030bp+0, 0x1.0024754db41d5p-54},
+    {0x1.306fe0a31b715p+0, 0x1.6f46ad23182e4p-55}, {0x1.33c08b26416ffp+0, 0x1.32721843659a6p-54},
+    {0x1.371a7373aa9cbp+0, -0x1.63aeabf42eae2p-54}, {0x1.3a7db34e59ff7p+0, -0x1.5e436d661f5e3p-56},
+    {0x1.3dea64c123422p+0, 0x1.ada0911f09ebcp-55}, {0x1.4160a21f72e2ap+0, -0x1.ef3691c309278p-58},
+    {0x1.44e086061892dp+0, 0x1.89b7a04ef80dp-59}, {0x1.486a2b5c13cdp+0, 0x1.3c1a3b69062fp-56},
+    {0x1.4bfdad5362a27p+0, 0x1.d4397afec42e2p-56}, {0x1.4f9b2769d2ca7p+0, -0x1.4b309d25957e3p-54},
+    {0x1.5342b569d4f82p+0, -0x1.07abe1db13cadp-55}, {0x1.56f4736b527dap+0, 0x1.9bb2c011d93adp-54},
+    {0x1.5ab07dd485429p+0, 0x1.6324c054647adp-54}, {0x1.5e76f15ad2148p+0, 0x1.ba6f93080e65ep-54},
+    {0x1.6247eb03a5585p+0, -0x1.383c17e40b497p-54}, {0x1.6623882552225p+0, -0x1.bb60987591c34p-54},
+    {0x1.6a09e667f3bcdp+0, -0x1.bdd3413b26456p-54}, {0x1.6dfb23c651a2fp+0, -0x1.bbe3a683c88abp-57},
+    {0x1.71f75e8ec5f74p+0, -0x1.16e4786887a99p-55}, {0x1.75feb564267c9p+0, -0x1.0245957316dd3p-54},
+    {0x1.7a11473eb0187p+0, -0x1.41577ee04992fp-55}, {0x1.7e2f336cf4e62p+0, 0x1.05d02ba15797ep-56},
+    {0x1.82589994cce13p+0, -0x1.d4c1dd41532d8p-54}, {0x1.868d99b4492edp+0, -0x1.fc6f89bd4f6bap-54},
+    {0x1.8ace5422aa0dbp+0, 0x1.6e9f156864b27p-54}, {0x1.8f1ae99157736p+0, 0x1.5cc13a2e3976cp-55},
+    {0x1.93737b0cdc5e5p+0, -0x1.75fc781b57ebcp-57}, {0x1.97d829fde4e5p+0, -0x1.d185b7c1b85d1p-54},
+    {0x1.9c49182a3f09p+0, 0x1.c7c46b071f2bep-56}, {0x1.a0c667b5de565p+0, -0x1.359495d1cd533p-54},
+    {0x1.a5503b23e255dp+0, -0x1.d2f6edb8d41e1p-54}, {0x1.a9e6b5579fdbfp+0, 0x1.0fac90ef7fd31p-54},
+    {0x1.ae89f995ad3adp+0, 0x1.7a1cd345dcc81p-54}, {0x1.b33a2b84f15fbp+0, -0x1.2805e3084d708p-57},
+    {0x1.b7f76f2fb5e47p+0, -0x1.5584f7e54ac3bp-56}, {0x1.bcc1e904bc1d2p+0, 0x1.23dd07a2d9e84p-55},
+    {0x1.c199bdd85529cp+0, 0x1.11065895048ddp-55}, {0x1.c67f12e57d14bp+0, 0x1.2884dff483cadp-54},
+    {0x1.cb720dcef9069p+0, 0x1.503cbd1e949dbp-56}, {0x1.d072d4a07897cp+0, -0x1.cbc3743797a9cp-54},
+    {0x1.d5818dcfba487p+0, 0x1.2ed02d75b3707p-55}, {0x1.da9e603db3285p+0, 0x1.c2300696db532p-54},
+    {0x1.dfc97337b9b5fp+0, -0x1.1a5cd4f184b5cp-54}, {0x1.e502ee78b3ff6p+0, 0x1.39e8980a9cc8fp-55},
+    {0x1.ea4afa2a490dap+0, -0x1.e9c23179c2893p-54}, {0x1.efa1bee615a27p+0, 0x1.dc7f486a4b6bp-54},
+    {0x1.f50765b6e454p+0, 0x1.9d3e12dd8a18bp-54}, {0x1.fa7c1819e90d8p+0, 0x1.74853f3a5931ep-55},
+};
+
+static const double T1[64][2] = {
+    {0x1p+0, 0x0p+0}, {0x1.000b175effdc7p+0, 0x1.ae8e38c59c72ap-54},
+    {0x1.00162f3904052p+0, -0x1.7b5d0d58ea8f4p-58}, {0x1.0021478e11ce6p+0, 0x1.4115cb6b16a8ep-54},
+    {0x1.002c605e2e8cfp+0, -0x1.d7c96f201bb2fp-55}, {0x1.003779a95f959p+0, 0x1.84711d4c35e9fp-54},
+    {0x1.0042936faa3d8p+0, -0x1.0484245243777p-55}, {0x1.004dadb113dap+0, -0x1.4b237da2025f9p-54},
+    {0x1.0058c86da1c0ap+0, -0x1.5e00e62d6b30dp-56}, {0x1.0063e3a559473p+0, 0x1.a1d6cedbb9481p-54},
+    {0x1.006eff583fc3dp+0, -0x1.4acf197a00142p-54}, {0x1.007a1b865a8cap+0, -0x1.eaf2ea42391a5p-57},
+    {0x1.0085382faef83p+0, 0x1.da93f90835f75p-56}, {0x1.00905554425d4p+0, -0x1.6a79084ab093cp-55},
+    {0x1.009b72f41a12bp+0, 0x1.86364f8fbe8f8p-54}, {0x1.00a6910f3b6fdp+0, -0x1.82e8e14e3110ep-55},
+    {0x1.00b1afa5abcbfp+0, -0x1.4f6b2a7609f71p-55}, {0x1.00bcceb7707ecp+0, -0x1.e1a258ea8f71bp-56},
+    {0x1.00c7ee448ee02p+0, 0x1.4362ca5bc26f1p-56}, {0x1.00d30e4d0c483p+0, 0x1.095a56c919d02p-54},
+    {0x1.00de2ed0ee0f5p+0, -0x1.406ac4e81a645p-57}, {0x1.00e94fd0398ep+0, 0x1.b5a6902767e09p-54},
+    {0x1.00f4714af41d3p+0, -0x1.91b2060859321p-54}, {0x1.00ff93412315cp+0, 0x1.427068ab22306p-55},
+    {0x1.010ab5b2cbd11p+0, 0x1.c1d0660524e08p-54}, {0x1.0115d89ff3a8bp+0, -0x1.e7bdfb3204be8p-54},
+    {0x1.0120fc089ff63p+0, 0x1.843aa8b9cbbc6p-55}, {0x1.012c1fecd613bp+0, -0x1.34104ee7edae9p-56},
+    {0x1.0137444c9b5b5p+0, -0x1.2b6aeb6176892p-56}, {0x1.01426927f5278p+0, 0x1.a8cd33b8a1bb3p-56},
+    {0x1.014d8e7ee8d2fp+0, 0x1.2edc08e5da99ap-56}, {0x1.0158b4517bb88p+0, 0x1.57ba2dc7e0c73p-55},
+    {0x1.0163da9fb3335p+0, 0x1.b61299ab8cdb7p-54}, {0x1.016f0169949edp+0, -0x1.90565902c5f44p-54},
+    {0x1.017a28af25567p+0, 0x1.70fc41c5c2d53p-55}, {0x1.018550706ab62p+0, 0x1.4b9a6e145d76cp-54},
+    {0x1.019078ad6a19fp+0, -0x1.008eff5142bf9p-56}, {0x1.019ba16628de2p+0, -0x1.77669f033c7dep-54},
+    {0x1.01a6ca9aac5f3p+0, -0x1.09bb78eeead0ap-54}, {0x1.01b1f44af9f9ep+0, 0x1.371231477ece5p-54},
+    {0x1.01bd1e77170b4p+0, 0x1.5e7626621eb5bp-56}, {0x1.01c8491f08f08p+0, -0x1.bc72b100828a5p-54},
+    {0x1.01d37442d507p+0, -0x1.ce39cbbab8bbep-57}, {0x1.01de9fe280ac8p+0, 0x1.16996709da2e2p-55},
+    {0x1.01e9cbfe113efp+0, -0x1.c11f5239bf535p-55}, {0x1.01f4f8958c1c6p+0, 0x1.e1d4eb5edc6b3p-55},
+    {0x1.020025a8f6a35p+0, -0x1.afb99946ee3fp-54}, {0x1.020b533856324p+0, -0x1.8f06d8a148a32p-54},
+    {0x1.02168143b0281p+0, -0x1.2bf310fc54eb6p-55}, {0x1.0221afcb09e3ep+0, -0x1.c95a035eb4175p-54},
+    {0x1.022cdece68c4fp+0, -0x1.491793e46834dp-54}, {0x1.02380e4dd22adp+0, -0x1.3e8d0d9c49091p-56},
+    {0x1.02433e494b755p+0, -0x1.314aa16278aa3p-54}, {0x1.024e6ec0da046p+0, 0x1.48daf888e9651p-55},
+    {0x1.02599fb483385p+0, 0x1.56dc8046821f4p-55}, {0x1.0264d1244c719p+0, 0x1.45b42356b9d47p-54},
+    {0x1.027003103b10ep+0, -0x1.082ef51b61d7ep-56}, {0x1.027b357854772p+0, 0x1.2106ed0920a34p-56},
+    {0x1.0286685c9e059p+0, -0x1.fd4cf26ea5d0fp-54}, {0x1.02919bbd1d1d8p+0, -0x1.09f8775e78084p-54},
+    {0x1.029ccf99d720ap+0, 0x1.64cbba902ca27p-58}, {0x1.02a803f2d170dp+0, 0x1.4383ef231d207p-54},
+    {0x1.02b338c811703p+0, 0x1.4a47a505b3a47p-54}, {0x1.02be6e199c811p+0, 0x1.e47120223467fp-54},
+};
+
+/* Put in h+l an approximation of erfcx(x) for 2^-56 <= x < 28 */
+static void
+erfcx_fast (double *h, double *l, double x)
+{
+  b64u64_u t = {.f = x};
+  int i;
+  double c;
+  if (x < 1.0)
+  {
+    i = (int) (16.0 * x);
+    c = i ? (double) (2 * i + 1) * 0x1p-5 : 0.0;
+  }
+  else
+  {
+    int e = (t.u >> 52) - 0x3ff, m = (t.u >> 48) & 0xf;
+    i = 16 + 16 * e + m;
+    c = (double) (33 + 2 * m) * 0x1p-5 * (double) (1 << e);
+  }
+  double z = x - c; /* exact by Sterbenz lemma (or c = 0) */
+  const double *p = C[i];
+  double z2 = z * z, z4 = z2 * z2;
+  double c4 = __builtin_fma (p[8], z, p[7]);
+  double c6 = __builtin_fma (p[10], z, p[9]);
+  double c8 = __builtin_fma (p[12], z, p[11]);
+  double c10 = __builtin_fma (p[14], z, p[13]);
+  c4 = __builtin_fma (c6, z2, c4);
+  c8 = __builtin_fma (c10, z2, c8);
+  c4 = __builtin_fma (c8, z4, c4);
+  a_mul (h, l, c4, z);
+  two_sum (h, &c4, p[6], *h);
+  *l += c4;
+  fma_dd (h, l, z, p[4], p[5]);
+  fma_dd (h, l, z, p[2], p[3]);
+  fma_dd (h, l, z, p[0], p[1]);
+}
+
+/* Put in h+l an approximation of exp(-(sh+sl))/2^e, where e is returned,
+   for 0 <= sh+sl < 800. We write sh+sl = k*log(2)/4096 - dx, with k integer,
+   -k = 4096*e + 64*i0 + i1, and use exp(-(sh+sl)) = 2^e*T0[i0]*T1[i1]*exp(dx).
+   The relative error on h+l is bounded by 2^-76, in all rounding modes. */
+static int
+exp_dd (double *h, double *l, double sh, double sl)
+{
+  const double l2h = 0x1.62e42ffp-13, l2l = 0x1.718432a1b0e26p-47,
+    l2ll = 0x1.9ff0342542fc3p-102;
+  /* the conversion truncates, thus k does not depend on the rounding mode,
+     and |sh - k*log(2)/4096| <= log(2)/8192 up to a tiny error */
+  int64_t k = (int64_t) (sh * 0x1.71547652b82fep+12 + 0.5);
+  double kd = (double) k;
+  /* k < 2^23, thus kd*l2h is exact, and so is the subtraction by
+     Sterbenz lemma */
+  double dx = __builtin_fma (kd, l2h, -sh);
+  /* log(2)/4096 = l2h - l2l - l2ll (see exp.c) */
+  double dxl = __builtin_fma (-kd, l2l, -sl) - kd * l2ll;
+  double dxh;
+  two_sum (&dxh, &dxl, dx, dxl); /* |dxh| < 2^-13.4 */
+  int i1 = (-k) & 0x3f, i0 = ((-k) >> 6) & 0x3f, e = (-k) >> 12;
+  double th, tl;
+  a_mul (&th, &tl, T0[i0][0], T1[i1][0]);
+  tl += T0[i0][0] * T1[i1][1] + T0[i0][1] * T1[i1][0];
+  /* exp(dx) = 1 + dx + q, the relative error of the Taylor polynomial
+     being less than 2^-90 */
+  double q = dxh * dxh * (0.5 + dxh * (0x1.5555555555555p-3 + dxh *
+             (0x1.5555555555555p-5 + dxh * 0x1.1111111111111p-7)));
+  q += dxl;
+  double ph, pl;
+  a_mul (&ph, &pl, th, dxh);
+  pl += th * q + tl * dxh;
+  fast_two_sum (h, l, th, ph);
+  *l += tl + pl;
+  return e;
+}
+
+/* The accurate path uses the same method as in erf.c, with
+   erfc(x) = erfc(x0) - 2/sqrt(pi)*exp(-x0^2)*int(g(t), t=0..h)
+   for x >= 0, and erfc(x) = 2 - erfc(-x) for x < 0. */
+
+/* ERFC0[k] is erfc(k/8) rounded to 128 bits, for 0 <= k <= 218 */
+static const dint64_t ERFC0[219] = {
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = 0, .sgn = 0x0},
+    {.hi = 0xdc143cb94788ed17, .lo = 0xa494db60f861eb07, .ex = -1, .sgn = 0x0},
+    {.hi = 0xb942ac7734a7ddbe, .lo = 0xe921fa4172b3f4a9, .ex = -1, .sgn = 0x0},
+    {.hi = 0x988bcb5237831d16, .lo = 0x71c021d14c3d0c65, .ex = -1, .sgn = 0x0},
+    {.hi = 0xf5810a3e7122dd42, .lo = 0xfec1cb9cbb0ad67c, .ex = -2, .sgn = 0x0},
+    {.hi = 0xc0e69232f0ecb3e4, .lo = 0xbe9edfbee15b0b4b, .ex = -2, .sgn = 0x0},
+    {.hi = 0x93e368a62f1a093a, .lo = 0xf3434d0eeab2623b, .ex = -2, .sgn = 0x0},
+    {.hi = 0xdd1b6d5c8e07493c, .lo = 0x896e9a97c5892c54, .ex = -3, .sgn = 0x0},
+    {.hi = 0xa1130b17deeea725, .lo = 0xfdde0489e5b218b3, .ex = -3, .sgn = 0x0},
+    {.hi = 0xe494b5f584e786ad, .lo = 0xdb532e8f4127c019, .ex = -4, .sgn = 0x0},
+    {.hi = 0x9de6899d507fdfce, .lo = 0xc4afb974d8e996a8, .ex = -4, .sgn = 0x0},
+    {.hi = 0xd44b9e25ae01f3a4, .lo = 0xecc583b3b834f322, .ex = -5, .sgn = 0x0},
+    {.hi = 0x8ad554764290270b, .lo = 0xc88be592d9934a3f, .ex = -5, .sgn = 0x0},
+    {.hi = 0xb096c49842892743, .lo = 0xdc280d86ac2a81e2, .ex = -6, .sgn = 0x0},
+    {.hi = 0xda5f100e55259d2a, .lo = 0x842db00c64509ada, .ex = -7, .sgn = 0x0},
+    {.hi = 0x833c2216612b7510, .lo = 0x93bccc4f3fd3c522, .ex = -7, .sgn = 0x0},
+    {.hi = 0x9947af61a873346b, .lo = 0xff37da32e60885fa, .ex = -8, .sgn = 0x0},
+    {.hi = 0xadef394d35b078cc, .lo = 0xcf63df662e3bf076, .ex = -9, .sgn = 0x0},
+    {.hi = 0xbfb89fce64bc1d7b, .lo = 0xf1d79bfb5d61b0b1, .ex = -10, .sgn = 0x0},
+    {.hi = 0xcd3e18299b2422c7, .lo = 0x29ba5fe0126f56d2, .ex = -11, .sgn = 0x0},
+    {.hi = 0xd55c2cd90564f311, .lo = 0xe9fee906ed60ffc0, .ex = -12, .sgn = 0x0},
+    {.hi = 0xd75a211f34873658, .lo = 0xcd16d71b3a335d4c, .ex = -13, .sgn = 0x0},
+    {.hi = 0xd304fbac26995bb2, .lo = 0x5e7ef573de9b1be9, .ex = -14, .sgn = 0x0},
+    {.hi = 0xc8b7be2f97bb2184, .lo = 0xe95673c70a0e7318, .ex = -15, .sgn = 0x0},
+    {.hi = 0xb94efb281a11505e, .lo = 0x1329310a68522365, .ex = -16, .sgn = 0x0},
+    {.hi = 0xa60a26cc270dc04b, .lo = 0x47dc1a2fcfed67a7, .ex = -17, .sgn = 0x0},
+    {.hi = 0x9060981aa8786edf, .lo = 0x117f2d372f75742f, .ex = -18, .sgn = 0x0},
+    {.hi = 0xf3a4984c18b32f44, .lo = 0xf46b3b0cba93ad17, .ex = -20, .sgn = 0x0},
+    {.hi = 0xc77954d0c6c2b5a5, .lo = 0x1247f82feb55984b, .ex = -21, .sgn = 0x0},
+    {.hi = 0x9e73c25a08c984e7, .lo = 0x11d51f3b3b32598d, .ex = -22, .sgn = 0x0},
+    {.hi = 0xf43a38727a122fc6, .lo = 0xa0b8ab4979d87813, .ex = -24, .sgn = 0x0},
+    {.hi = 0xb698936ba5b65d9f, .lo = 0xc295b6c03c5819ca, .ex = -25, .sgn = 0x0},
+    {.hi = 0x846ee89de9af353d, .lo = 0x4497f9cd8fd146a5, .ex = -26, .sgn = 0x0},
+    {.hi = 0xba58bce8f5d404f9, .lo = 0x71911203a080fce8, .ex = -28, .sgn = 0x0},
+    {.hi = 0xfe5749fdb991e26b, .lo = 0x46b2cd2593705cfc, .ex = -30, .sgn = 0x0},
+    {.hi = 0xa85bae29b7c937d8, .lo = 0x7de3d3e919045044, .ex = -31, .sgn = 0x0},
+    {.hi = 0xd82e7f174ca1a4bf, .lo = 0x1c24ff55a74ec18f, .ex = -33, .sgn = 0x0},
+    {.hi = 0x869d9a810eb4a6bd, .lo = 0x5da185bd76bc8dce, .ex = -34, .sgn = 0x0},
+    {.hi = 0xa298a08411814dcb, .lo = 0xdfdff04f17c3206b, .ex = -36, .sgn = 0x0},
+    {.hi = 0xbe77a174d30bea45, .lo = 0x4fb5f147c5e93198, .ex = -38, .sgn = 0x0},
+    {.hi = 0xd860d3acfbb9c49a, .lo = 0xf52ef5470bd5200d, .ex = -40, .sgn = 0x0},
+    {.hi = 0xee627d5f9978dd16, .lo = 0xebf5e18ca619c751, .ex = -42, .sgn = 0x0},
+    {.hi = 0xfeaf84569594d1e5, .lo = 0xb1d0c5bf933caddc, .ex = -44, .sgn = 0x0},
+    {.hi = 0x83eeb419dd9bfd38, .lo = 0x9dc3e7705ab0cc12, .ex = -45, .sgn = 0x0},
+    {.hi = 0x848c1599359146dd, .lo = 0x17a4ec571e34418f, .ex = -47, .sgn = 0x0},
+    {.hi = 0x8120ef3618f2d539, .lo = 0x272458dd2a09bfd3, .ex = -49, .sgn = 0x0},
+    {.hi = 0xf3f75017276c3cfb, .lo = 0x667c3b98cbbc3b74, .ex = -52, .sgn = 0x0},
+    {.hi = 0xdf78d8d09411ec9c, .lo = 0xff07899505932aaf, .ex = -54, .sgn = 0x0},
+    {.hi = 0xc67c0aabe905b0d3, .lo = 0xfff8663995fcd978, .ex = -56, .sgn = 0x0},
+    {.hi = 0xaaef8bc8797b09ec, .lo = 0x3d39d9bc1d5efdbd, .ex = -58, .sgn = 0x0},
+    {.hi = 0x8ebc8dd899250a98, .lo = 0x3a22eda1a4bfc1d1, .ex = -60, .sgn = 0x0},
+    {.hi = 0xe7216ec727d11b17, .lo = 0x5a5a2f2b7014fd84, .ex = -63, .sgn = 0x0},
+    {.hi = 0xb570b920a675cfac, .lo = 0xc7fa9a7d386d4506, .ex = -65, .sgn = 0x0},
+    {.hi = 0x8a19324e43626513, .lo = 0x2fc4999b8317ad2b, .ex = -67, .sgn = 0x0},
+    {.hi = 0xcbd1ee3108ce41bb, .lo = 0x8349c77f884028d4, .ex = -70, .sgn = 0x0},
+    {.hi = 0x91d42c48ee3959fe, .lo = 0x4810babd7759126e, .ex = -72, .sgn = 0x0},
+    {.hi = 0xca51409b7d398a92, .lo = 0x3f3ce0b073f21e00, .ex = -75, .sgn = 0x0},
+    {.hi = 0x8811189d889c0bca, .lo = 0x4397f39e21b6dc4c, .ex = -77, .sgn = 0x0},
+    {.hi = 0xb17112f5e50c8049, .lo = 0x2af09147c236bc13, .ex = -80, .sgn = 0x0},
+    {.hi = 0xe057736b58a03080, .lo = 0xe15c26180cbd74a7, .ex = -83, .sgn = 0x0},
+    {.hi = 0x897e366d7e886b5b, .lo = 0xadfe52bed74a8c09, .ex = -85, .sgn = 0x0},
+    {.hi = 0xa363bcf5d8a570b0, .lo = 0xe05cfc42823ba31a, .ex = -88, .sgn = 0x0},
+    {.hi = 0xbc3cf5a91c0769e4, .lo = 0x289f32a4be07b747, .ex = -91, .sgn = 0x0},
+    {.hi = 0xd23edac458ae7ac4, .lo = 0xd02acc86105e2320, .ex = -94, .sgn = 0x0},
+    {.hi = 0xe3a7e2090befdbb5, .lo = 0xc007d16c48e8476e, .ex = -97, .sgn = 0x0},
+    {.hi = 0xeefab489d2a0f213, .lo = 0x370512346b947668, .ex = -100, .sgn = 0x0},
+    {.hi = 0xf333ecd45e6cf1ab, .lo = 0x4626748c58ca7bed, .ex = -103, .sgn = 0x0},
+    {.hi = 0xeff060dc578f992e, .lo = 0x9765a21e903674d4, .ex = -106, .sgn = 0x0},
+    {.hi = 0xe57c22c569508d69, .lo = 0x0374dcc629ffb8cf, .ex = -109, .sgn = 0x0},
+    {.hi = 0xd4c7134926363c96, .lo = 0x0a8f3319d56d9e24, .ex = -112, .sgn = 0x0},
+    {.hi = 0xbf4166f4914195e4, .lo = 0x477df9217a5c5860, .ex = -115, .sgn = 0x0},
+    {.hi = 0xa6a764754773353c, .lo = 0x5186e1821147573e, .ex = -118, .sgn = 0x0},
+    {.hi = 0x8cc6a115f1fc6136, .lo = 0xba610a005ff1ff6c, .ex = -121, .sgn = 0x0},
+    {.hi = 0xe68edcb53637765c, .lo = 0xad641ec7007d8001, .ex = -125, .sgn = 0x0},
+    {.hi = 0xb70647d6dd827fd4, .lo = 0x1a26ab8ce20e656c, .ex = -128, .sgn = 0x0},
+    {.hi = 0x8cd8791920dc3e49, .lo = 0x4b5bc2a1e4195e8d, .ex = -131, .sgn = 0x0},
+    {.hi = 0xd22406db07f0bb92, .lo = 0xdff3b8c5c12762ca, .ex = -135, .sgn = 0x0},
+    {.hi = 0x97f776a185c3d8a3, .lo = 0xdffd1c83192df382, .ex = -138, .sgn = 0x0},
+    {.hi = 0xd511154c5d4a9a27, .lo = 0x51d7b422ed28a649, .ex = -142, .sgn = 0x0},
+    {.hi = 0x90cb42811f0ded18, .lo = 0xe297a94a1e2ba342, .ex = -145, .sgn = 0x0},
+    {.hi = 0xbec53f9545167ce9, .lo = 0xb9c460ae3b266f5f, .ex = -149, .sgn = 0x0},
+    {.hi = 0xf3a65bf5ef504e92, .lo = 0x7a3f58acd71fd147, .ex = -153, .sgn = 0x0},
+    {.hi = 0x96d41eac9c97a6df, .lo = 0x32dd9486a3e282cb, .ex = -156, .sgn = 0x0},
+    {.hi = 0xb504ab6be8db164b, .lo = 0x9629dd3295c0c854, .ex = -160, .sgn = 0x0},
+    {.hi = 0xd298a461fe24100c, .lo = 0xbfc06228faa5101d, .ex = -164, .sgn = 0x0},
+    {.hi = 0xed8080779c2e94d3, .lo = 0xfb857358ce0c825b, .ex = -168, .sgn = 0x0},
+    {.hi = 0x81d1d83e7c2581f1, .lo = 0x65816dc59df91a73, .ex = -171, .sgn = 0x0},
+    {.hi = 0x899264fcb9b03592, .lo = 0xd52f4641a9c0f609, .ex = -175, .sgn = 0x0},
+    {.hi = 0x8d51da7479e54d38, .lo = 0x4b268594d9e86ed6, .ex = -179, .sgn = 0x0},
+    {.hi = 0x8cb89791e571e96a, .lo = 0xf168ea3cec968b17, .ex = -183, .sgn = 0x0},
+    {.hi = 0x87d49a2aaf5ad132, .lo = 0xb527d4e2a9824e24, .ex = -187, .sgn = 0x0},
+    {.hi = 0xfe2ec7028cd7978e, .lo = 0xa80c385d87643b1a, .ex = -192, .sgn = 0x0},
+    {.hi = 0xe689fbdbe1a0a312, .lo = 0xe5b408e2f0698f2c, .ex = -196, .sgn = 0x0},
+    {.hi = 0xcaaf5179c9110a1d, .lo = 0xd38c743098d3019a, .ex = -200, .sgn = 0x0},
+    {.hi = 0xacbbabf0a7274340, .lo = 0x8c9fb632e4cdbaea, .ex = -204, .sgn = 0x0},
+    {.hi = 0x8eb1b58ed15a2d50, .lo = 0x8e7a9e3505aaa12b, .ex = -208, .sgn = 0x0},
+    {.hi = 0xe48790e96a3afa1a, .lo = 0xee7763ac1cdaeca0, .ex = -213, .sgn = 0x0},
+    {.hi = 0xb1633217aea5c439, .lo = 0x647b07bf9f3b250d, .ex = -217, .sgn = 0x0},
+    {.hi = 0x8577cdffd38469b5, .lo = 0x7bd6441011a3704a, .ex = -221, .sgn = 0x0},
+    {.hi = 0xc2af851a2c15329e, .lo = 0x7d8366664551c4c8, .ex = -226, .sgn = 0x0},
+    {.hi = 0x89a2d8ef252a0630, .lo = 0xf397fb398e8e2f96, .ex = -230, .sgn = 0x0},
+    {.hi = 0xbca3a0ea69463272, .lo = 0xb06196bea5d78cc3, .ex = -235, .sgn = 0x0},
+    {.hi = 0xfa9c9be1311b73ed, .lo = 0x685a784182a77d92, .ex = -240, .sgn = 0x0},
+    {.hi = 0xa15d8776e9fd9284, .lo = 0xb98a497f1d2546b2, .ex = -244, .sgn = 0x0},
+    {.hi = 0xc96d4e4b003b4ccd, .lo = 0x27aabd7f3a082145, .ex = -249, .sgn = 0x0},
+    {.hi = 0xf3b88bc08d3e8eda, .lo = 0xa47ca4eaa8ebf4c9, .ex = -254, .sgn = 0x0},
+    {.hi = 0x8eec851a9163ab83, .lo = 0xb6cdf14d8653500a, .ex = -258, .sgn = 0x0},
+    {.hi = 0xa27c29e51e95042e, .lo = 0xd74ffb1d7e6e2cd3, .ex = -263, .sgn = 0x0},
+    {.hi = 0xb30e2cf8bfd701e1, .lo = 0x65747489e87337a2, .ex = -268, .sgn = 0x0},
+    {.hi = 0xbf42ce81132c12a3, .lo = 0xca8ed1b66388f017, .ex = -273, .sgn = 0x0},
+    {.hi = 0xc607846ffa733cf2, .lo = 0x633623dd365c6d63, .ex = -278, .sgn = 0x0},
+    {.hi = 0xc6bec070a5c87ff7, .lo = 0xcdbde689ee62ab72, .ex = -283, .sgn = 0x0},
+    {.hi = 0xc157925df40eeab0, .lo = 0x769a73a8e2ccf24b, .ex = -288, .sgn = 0x0},
+    {.hi = 0xb6503d6d9655ef52, .lo = 0xa3019fc881865afd, .ex = -293, .sgn = 0x0},
+    {.hi = 0xa6a3345e1e31c376, .lo = 0xfb3dd12f5508ac26, .ex = -298, .sgn = 0x0},
+    {.hi = 0x93a274a2cbef8230, .lo = 0xf92ffa52576d258b, .ex = -303, .sgn = 0x0},
+    {.hi = 0xfd915c9a5cc97f9d, .lo = 0x7999aae448249e0c, .ex = -309, .sgn = 0x0},
+    {.hi = 0xd312633d54bef986, .lo = 0x2015f51b70a1a5ad, .ex = -314, .sgn = 0x0},
+    {.hi = 0xaa4df0470ac93baf, .lo = 0xba592cc2c1140da9, .ex = -319, .sgn = 0x0},
+    {.hi = 0x85315bec9784a866, .lo = 0x91af577043324b60, .ex = -324, .sgn = 0x0},
+    {.hi = 0xc9f0d9b8a90506c4, .lo = 0xc2e7d5827714d323, .ex = -330, .sgn = 0x0},
+    {.hi = 0x94630b276091ab48, .lo = 0x77b2b204d550a1fb, .ex = -335, .sgn = 0x0},
+    {.hi = 0xd3601c7efad7689d, .lo = 0x14b2eb35849ff4f1, .ex = -341, .sgn = 0x0},
+    {.hi = 0x91edbd000d49a98e, .lo = 0x8c798dd5ec508aef, .ex = -346, .sgn = 0x0},
+    {.hi = 0xc34e14125a5b59b2, .lo = 0xf9de39f0371f124a, .ex = -352, .sgn = 0x0},
+    {.hi = 0xfd5ccac48e0a987a, .lo = 0x05d06f7a62ea463a, .ex = -358, .sgn = 0x0},
+    {.hi = 0x9f4b08f410bfffa7, .lo = 0x73e12a55ac67b205, .ex = -363, .sgn = 0x0},
+    {.hi = 0xc2265acd080d490f, .lo = 0x0f97e87cb0591735, .ex = -369, .sgn = 0x0},
+    {.hi = 0xe55e161ecc6bdd0e, .lo = 0xd28ff1aa7a421f7b, .ex = -375, .sgn = 0x0},
+    {.hi = 0x83538186db8fd4e6, .lo = 0x55c83f1093b54d0d, .ex = -380, .sgn = 0x0},
+    {.hi = 0x91c3fafa5b896e67, .lo = 0x6d758e9476919d63, .ex = -386, .sgn = 0x0},
+    {.hi = 0x9cd2e83b00f38598, .lo = 0x3bcaa9e11a9b233e, .ex = -392, .sgn = 0x0},
+    {.hi = 0xa38a1d53c5aff0b6, .lo = 0x70ddbcb3d8b34f85, .ex = -398, .sgn = 0x0},
+    {.hi = 0xa54e19f02c04cddf, .lo = 0xe6a975d9b6dd452f, .ex = -404, .sgn = 0x0},
+    {.hi = 0xa1f53d39eae7821e, .lo = 0xa3dc7362208bd731, .ex = -410, .sgn = 0x0},
+    {.hi = 0x99ce18f06a8dbbd5, .lo = 0xfe16a567e6711cc7, .ex = -416, .sgn = 0x0},
+    {.hi = 0x8d938ed8a8cb433a, .lo = 0x7c8b5bf093424157, .ex = -422, .sgn = 0x0},
+    {.hi = 0xfca26cae40cc1a29, .lo = 0xcc004806fc62f78e, .ex = -429, .sgn = 0x0},
+    {.hi = 0xda7b61143aa0a867, .lo = 0xa46a9c5e6440cfc0, .ex = -435, .sgn = 0x0},
+    {.hi = 0xb72481facacbb2d7, .lo = 0xa04c004b96f825d1, .ex = -441, .sgn = 0x0},
+    {.hi = 0x94cdc07535dbf47e, .lo = 0x1a23a2ba6aec7d12, .ex = -447, .sgn = 0x0},
+    {.hi = 0xea60fbe33ee8c111, .lo = 0xfffdb08a8a21b7e7, .ex = -454, .sgn = 0x0},
+    {.hi = 0xb2e9d7525b04ef81, .lo = 0x489b6697134fa190, .ex = -460, .sgn = 0x0},
+    {.hi = 0x8460df9e4c2fcfa1, .lo = 0x7c94ea2217502e4f, .ex = -466, .sgn = 0x0},
+    {.hi = 0xbde05372bfde28ff, .lo = 0x294792e3ba5cd58b, .ex = -473, .sgn = 0x0},
+    {.hi = 0x83fd9d97f8b013eb, .lo = 0x05fe206d4da95a45, .ex = -479, .sgn = 0x0},
+    {.hi = 0xb1dddfbc328e5d18, .lo = 0x6665aff8174be38f, .ex = -486, .sgn = 0x0},
+    {.hi = 0xe852ffb05c967464, .lo = 0x8407e65dc04a3d6b, .ex = -493, .sgn = 0x0},
+    {.hi = 0x9310eb28a9533acd, .lo = 0xa9215f55e057395c, .ex = -499, .sgn = 0x0},
+    {.hi = 0xb478b237a2866011, .lo = 0x9ed4052a41707fba, .ex = -506, .sgn = 0x0},
+    {.hi = 0xd6a91a896c057125, .lo = 0x7c519e7f5befa116, .ex = -513, .sgn = 0x0},
+    {.hi = 0xf77b5c5fd491272d, .lo = 0x78d690971e5ee1fd, .ex = -520, .sgn = 0x0},
+    {.hi = 0x8a470ecb614cf2c4, .lo = 0xb74a86a61b61f716, .ex = -526, .sgn = 0x0},
+    {.hi = 0x95c631f3a3460b06, .lo = 0x19a066ef346d0910, .ex = -533, .sgn = 0x0},
+    {.hi = 0x9d3dfda5f4cb128d, .lo = 0x98b2319ed6745118, .ex = -540, .sgn = 0x0},
+    {.hi = 0xa0029645d025a32b, .lo = 0xdd57a1dcc396ef5a, .ex = -547, .sgn = 0x0},
+    {.hi = 0x9dd2da93cd5121fc, .lo = 0xeb03936ce63e95b7, .ex = -554, .sgn = 0x0},
+    {.hi = 0x96e243c082b644ac, .lo = 0x6e7062c613804adf, .ex = -561, .sgn = 0x0},
+    {.hi = 0x8bd1166952847afc, .lo = 0x849f3588f6cde911, .ex = -568, .sgn = 0x0},
+    {.hi = 0xfb29117d6fdffc8a, .lo = 0x27383c18b8c16550, .ex = -576, .sgn = 0x0},
+    {.hi = 0xdaa79226fc9ef526, .lo = 0x90a47b941f26b50a, .ex = -583, .sgn = 0x0},
+    {.hi = 0xb88199135f857b15, .lo = 0x8cc4bb8fc39c36a4, .ex = -590, .sgn = 0x0},
+    {.hi = 0x96e81cc011055c90, .lo = 0xd875448045a2ebed, .ex = -597, .sgn = 0x0},
+    {.hi = 0xef440be3799dc453, .lo = 0x981c358615c55590, .ex = -605, .sgn = 0x0},
+    {.hi = 0xb7d9ffc667a0e1f9, .lo = 0xf3fe1e0d10a11a3b, .ex = -612, .sgn = 0x0},
+    {.hi = 0x88ee0eabfbefc1b3, .lo = 0x1150e2dbf1da7155, .ex = -619, .sgn = 0x0},
+    {.hi = 0xc5b2d3c97f09fdbb, .lo = 0xdcef16f5122aa3f3, .ex = -627, .sgn = 0x0},
+    {.hi = 0x8a54fc221e82be84, .lo = 0x408c7fbf75d79a97, .ex = -634, .sgn = 0x0},
+    {.hi = 0xbba2bbf0fd7a766d, .lo = 0xb2867542cbd1c826, .ex = -642, .sgn = 0x0},
+    {.hi = 0xf6b0afbdfebe92cc, .lo = 0x56c96cd7d95db4e9, .ex = -650, .sgn = 0x0},
+    {.hi = 0x9d2e7d72ccc75c44, .lo = 0xa259a416b91b7c3e, .ex = -657, .sgn = 0x0},
+    {.hi = 0xc224f4bbff780b74, .lo = 0x26916772b4a76721, .ex = -665, .sgn = 0x0},
+    {.hi = 0xe86de76c31b25d5c, .lo = 0xa101a08155bf073a, .ex = -673, .sgn = 0x0},
+    {.hi = 0x86db1b531933431f, .lo = 0x17305e5c48ed4a72, .ex = -680, .sgn = 0x0},
+    {.hi = 0x97ad7b418a56137c, .lo = 0xbb71451ea56fe090, .ex = -688, .sgn = 0x0},
+    {.hi = 0xa55abd7fe82d494a, .lo = 0xc72e7b1e7961b669, .ex = -696, .sgn = 0x0},
+    {.hi = 0xaeb957fa3b46cc7a, .lo = 0x4183bad8e8348dc2, .ex = -704, .sgn = 0x0},
+    {.hi = 0xb2f32c809ad002a4, .lo = 0x9eb23528a661b497, .ex = -712, .sgn = 0x0},
+    {.hi = 0xb1a50f9de86bee1c, .lo = 0x2647cbcbee96eb80, .ex = -720, .sgn = 0x0},
+    {.hi = 0xaaedc7bda22e2e69, .lo = 0x0afa54942737b341, .ex = -728, .sgn = 0x0},
+    {.hi = 0x9f6960141457a717, .lo = 0x78aae77db90c7453, .ex = -736, .sgn = 0x0},
+    {.hi = 0x9019cb58a53b8206, .lo = 0xc2ed7f766c68ec0b, .ex = -744, .sgn = 0x0},
+    {.hi = 0xfc835ee3bce7e2a9, .lo = 0x045874be31daf62d, .ex = -753, .sgn = 0x0},
+    {.hi = 0xd67190f184e3d8f5, .lo = 0xca9c512510191689, .ex = -761, .sgn = 0x0},
+    {.hi = 0xb08406f035fd8308, .lo = 0x04edbcf13a60cff3, .ex = -769, .sgn = 0x0},
+    {.hi = 0x8cd471ed3bfdef4e, .lo = 0x7e58ee798b0930fa, .ex = -777, .sgn = 0x0},
+    {.hi = 0xd9cf41ca8ded53cc, .lo = 0x046497cf4c007736, .ex = -786, .sgn = 0x0},
+    {.hi = 0xa3419f71315880ef, .lo = 0x4ed2f63724c86c6d, .ex = -794, .sgn = 0x0},
+    {.hi = 0xed35dd441e914da4, .lo = 0xd4f0c85d00ea97a7, .ex = -803, .sgn = 0x0},
+    {.hi = 0xa709018ad6e02c30, .lo = 0xa8676653865fd370, .ex = -811, .sgn = 0x0},
+    {.hi = 0xe40260e829175bbb, .lo = 0x375cdcd061eb101c, .ex = -820, .sgn = 0x0},
+    {.hi = 0x96d63ac4c2308025, .lo = 0xcca6c7f3aab20663, .ex = -828, .sgn = 0x0},
+    {.hi = 0xc16f0ed75ce238e0, .lo = 0x2e2f43c995d85f0f, .ex = -837, .sgn = 0x0},
+    {.hi = 0xf06f52aedc0e2054, .lo = 0xac88de2e9806f4bf, .ex = -846, .sgn = 0x0},
+    {.hi = 0x90d5a8d24d320354, .lo = 0xebe6e9c11e1409d0, .ex = -854, .sgn = 0x0},
+    {.hi = 0xa920eb8f5b70cbfe, .lo = 0xcd3b28c6696e64e7, .ex = -863, .sgn = 0x0},
+    {.hi = 0xbf6d1be935733224, .lo = 0x62e7c3a3a293535b, .ex = -872, .sgn = 0x0},
+    {.hi = 0xd200be2d6706f004, .lo = 0x6c1bb4068e2a414f, .ex = -881, .sgn = 0x0},
+    {.hi = 0xdf4cc9af9c620d8f, .lo = 0xcc26a3f8a78da572, .ex = -890, .sgn = 0x0},
+    {.hi = 0xe623ba7f02d09999, .lo = 0xbb4407185153383b, .ex = -899, .sgn = 0x0},
+    {.hi = 0xe5e59c9af43837af, .lo = 0x2690e32de6be29a1, .ex = -908, .sgn = 0x0},
+    {.hi = 0xde9826f1aaec2987, .lo = 0x32de8eaff8e70e95, .ex = -917, .sgn = 0x0},
+    {.hi = 0xd0e5dd5c0ada6219, .lo = 0xf7d9eb0bb4b4e309, .ex = -926, .sgn = 0x0},
+    {.hi = 0xbe0468479665d8a4, .lo = 0x1a815ef5a0395378, .ex = -935, .sgn = 0x0},
+    {.hi = 0xa7877bbe40d3794f, .lo = 0x33d43869e815876b, .ex = -944, .sgn = 0x0},
+    {.hi = 0x8f2966f204933aea, .lo = 0x42021ae24bcc161c, .ex = -953, .sgn = 0x0},
+    {.hi = 0xed279e2dc62b79b8, .lo = 0xf54da1fce5537bc0, .ex = -963, .sgn = 0x0},
+    {.hi = 0xbe63f6e95f6e8b6c, .lo = 0x2785944eb1aae0ba, .ex = -972, .sgn = 0x0},
+    {.hi = 0x9425ff0e6f511d74, .lo = 0xdb40cfbbceff3934, .ex = -981, .sgn = 0x0},
+    {.hi = 0xdf780a79b7fd449f, .lo = 0x3902670e3fd26998, .ex = -991, .sgn = 0x0},
+    {.hi = 0xa35c20ab2d59f310, .lo = 0x6b03ea280be111cd, .ex = -1000, .sgn = 0x0},
+    {.hi = 0xe77ebd8cfe348a6b, .lo = 0x865ece8aad74d60d, .ex = -1010, .sgn = 0x0},
+    {.hi = 0x9efb392d3067a881, .lo = 0xb436d6510dc09b6c, .ex = -1019, .sgn = 0x0},
+    {.hi = 0xd3a66c7a4942db14, .lo = 0x9635a4052185dbcc, .ex = -1029, .sgn = 0x0},
+    {.hi = 0x888d5af7bece73dd, .lo = 0x8220e66b08d3be06, .ex = -1038, .sgn = 0x0},
+    {.hi = 0xaac8a231c6be8e57, .lo = 0x9984a7fd05867a55, .ex = -1048, .sgn = 0x0},
+    {.hi = 0xcf07866fc1d3afd0, .lo = 0x9858b04866119251, .ex = -1058, .sgn = 0x0},
+    {.hi = 0xf3405318ae47ca67, .lo = 0x906b8a5770d87529, .ex = -1068, .sgn = 0x0},
+    {.hi = 0x8a82eee2ec17bf88, .lo = 0xd391f07fb495eed5, .ex = -1077, .sgn = 0x0},
+};
+
+/* EXP0[k] is 2/sqrt(pi)*exp(-(k/8)^2) rounded to 128 bits, for 0 <= k <= 218 */
+static const dint64_t EXP0[219] = {
+    {.hi = 0x906eba8214db688d, .lo = 0x71d48a7f6bfec344, .ex = 0, .sgn = 0x0},
+    {.hi = 0x8e317d0f434db1ce, .lo = 0x6909ad6a1e72ff4f, .ex = 0, .sgn = 0x0},
+    {.hi = 0x87ae8b017bf206c1, .lo = 0xbe8872b4e11bdf59, .ex = 0, .sgn = 0x0},
+    {.hi = 0xfaf866d78a98981d, .lo = 0xff29f5ad81173d64, .ex = -1, .sgn = 0x0},
+    {.hi = 0xe0f7e524d2808a98, .lo = 0x103afe929ffc3390, .ex = -1, .sgn = 0x0},
+    {.hi = 0xc374b4a09a5ced88, .lo = 0x4bd9d69c530b5722, .ex = -1, .sgn = 0x0},
+    {.hi = 0xa497216bc69624e8, .lo = 0x58f2b08b81404151, .ex = -1, .sgn = 0x0},
+    {.hi = 0x8655b0f8425c9909, .lo = 0x8a511a778e6a3fe7, .ex = -1, .sgn = 0x0},
+    {.hi = 0xd488f84b7de12def, .lo = 0x2bec119499ab1f4c, .ex = -2, .sgn = 0x0},
+    {.hi = 0xa2f4cde5dbc8aaf7, .lo = 0x9a024b502aabe0dc, .ex = -2, .sgn = 0x0},
+    {.hi = 0xf23297d6e5b58fc2, .lo = 0xd5ef92dfdfb8532f, .ex = -3, .sgn = 0x0},
+    {.hi = 0xae72cae22ad850e1, .lo = 0x8ba0ae163706478b, .ex = -3, .sgn = 0x0},
+    {.hi = 0xf391b935c12546dd, .lo = 0xfce6811589c32eb2, .ex = -4, .sgn = 0x0},
+    {.hi = 0xa4cea3c5e539a898, .lo = 0xe20e8b9bc7126cc8, .ex = -4, .sgn = 0x0},
+    {.hi = 0xd82a98191080ab97, .lo = 0x53d4c1da0323f926, .ex = -5, .sgn = 0x0},
+    {.hi = 0x896759bffcde1b47, .lo = 0x61613a68ec25f85f, .ex = -5, .sgn = 0x0},
+    {.hi = 0xa94dcf467cd0f1b4, .lo = 0x7becf12c4e3de30a, .ex = -6, .sgn = 0x0},
+    {.hi = 0xca31273c707d757c, .lo = 0xf3719070e01dddd3, .ex = -7, .sgn = 0x0},
+    {.hi = 0xea0a1d4eff4b2691, .lo = 0x13c3ca3812916bea, .ex = -8, .sgn = 0x0},
+    {.hi = 0x8348c5b1aab12243, .lo = 0x68c771c73ff82fdb, .ex = -8, .sgn = 0x0},
+    {.hi = 0x8ec18b87dfb7dbd4, .lo = 0x6ce3df76e942b809, .ex = -9, .sgn = 0x0},
+    {.hi = 0x96744c4049227212, .lo = 0x568a92753cf946a2, .ex = -10, .sgn = 0x0},
+    {.hi = 0x99b066691ed9d027, .lo = 0x3c2a889d3bbac3ea, .ex = -11, .sgn = 0x0},
+    {.hi = 0x9829c7ddbbf66863, .lo = 0x17a306cd4cbb6da0, .ex = -12, .sgn = 0x0},
+    {.hi = 0x920474dd1993f503, .lo = 0xc4fd4f1f7e750f6f, .ex = -13, .sgn = 0x0},
+    {.hi = 0x87cf0da6e9b6f7b0, .lo = 0x048dfc98e1499f8f, .ex = -14, .sgn = 0x0},
+    {.hi = 0xf4daf4680673b468, .lo = 0x83a265c60a8d477c, .ex = -16, .sgn = 0x0},
+    {.hi = 0xd5f04f48a25af261, .lo = 0x0601247fc9693f83, .ex = -17, .sgn = 0x0},
+    {.hi = 0xb52cb90cd49ecc68, .lo = 0x0e087a65465c8750, .ex = -18, .sgn = 0x0},
+    {.hi = 0x94b5387a0a029903, .lo = 0x6e65808a17d10ade, .ex = -19, .sgn = 0x0},
+    {.hi = 0xec9b8f17fbe1aa15, .lo = 0xda12a3c0f1a27bfd, .ex = -21, .sgn = 0x0},
+    {.hi = 0xb670d51febdee837, .lo = 0xe2b6178ad555941e, .ex = -22, .sgn = 0x0},
+    {.hi = 0x8858a4457591a7c6, .lo = 0x51496fae7e807ec0, .ex = -23, .sgn = 0x0},
+    {.hi = 0xc5867e702bcefc2e, .lo = 0x8a4cd3027a86d06d, .ex = -25, .sgn = 0x0},
+    {.hi = 0x8aad04832ea7b683, .lo = 0xa2938ebf08029fbe, .ex = -26, .sgn = 0x0},
+    {.hi = 0xbcba73a1ef51e493, .lo = 0xdfc444de84a0b6e5, .ex = -28, .sgn = 0x0},
+    {.hi = 0xf8f1a91da0ebe519, .lo = 0xf959275e992bb901, .ex = -30, .sgn = 0x0},
+    {.hi = 0x9f22722980dc9234, .lo = 0xb801a274be3943f7, .ex = -31, .sgn = 0x0},
+    {.hi = 0xc530ba2f63e8e99d, .lo = 0x509f787b50e1136e, .ex = -33, .sgn = 0x0},
+    {.hi = 0xecd44079835ebfe0, .lo = 0x413b97600e264eae, .ex = -35, .sgn = 0x0},
+    {.hi = 0x89d7a7827cccbdf5, .lo = 0x9a3370657d0aac4b, .ex = -36, .sgn = 0x0},
+    {.hi = 0x9b855c193d7aedc6, .lo = 0x41ef822f68892f96, .ex = -38, .sgn = 0x0},
+    {.hi = 0xaa1177aec4a4e8ff, .lo = 0xb112c42b9a7c6fdc, .ex = -40, .sgn = 0x0},
+    {.hi = 0xb4411f294b85f092, .lo = 0x01c5724f7de5c0dc, .ex = -42, .sgn = 0x0},
+    {.hi = 0xb92c30859d9197a7, .lo = 0xd0e2278d71ae4ec3, .ex = -44, .sgn = 0x0},
+    {.hi = 0xb85f57ce3ffdaf93, .lo = 0xcbe39c28c0b32f97, .ex = -46, .sgn = 0x0},
+    {.hi = 0xb1ed7c5a58f0607c, .lo = 0xe20029a7fa6127e0, .ex = -48, .sgn = 0x0},
+    {.hi = 0xa66ce020ac66baa6, .lo = 0x728eaf3ca9a468a9, .ex = -50, .sgn = 0x0},
+    {.hi = 0x96e08c84ab94f5d5, .lo = 0x325d803753740f49, .ex = -52, .sgn = 0x0},
+    {.hi = 0x8492bfe5000dfe45, .lo = 0x147df89162591df4, .ex = -54, .sgn = 0x0},
+    {.hi = 0xe1cfd06a52d157f6, .lo = 0x0df6978c19f9d04a, .ex = -57, .sgn = 0x0},
+    {.hi = 0xba65444ddd66ab3b, .lo = 0x90b5fab8ae10304c, .ex = -59, .sgn = 0x0},
+    {.hi = 0x95203712fe5a2096, .lo = 0x487e1d4a9b071018, .ex = -61, .sgn = 0x0},
+    {.hi = 0xe7466003d3218f1e, .lo = 0x3c847f6cf277af33, .ex = -64, .sgn = 0x0},
+    {.hi = 0xadd2316f7450124b, .lo = 0x4f9898dc56e498ec, .ex = -66, .sgn = 0x0},
+    {.hi = 0xfd3dc8acfe2385e9, .lo = 0x2ae3497e871eed73, .ex = -69, .sgn = 0x0},
+    {.hi = 0xb2cc8bdddb318ed6, .lo = 0xa21746caa4ce9732, .ex = -71, .sgn = 0x0},
+    {.hi = 0xf4b6132e10fdf568, .lo = 0xaf9c7ff87a99e437, .ex = -74, .sgn = 0x0},
+    {.hi = 0xa24ef33f96358c82, .lo = 0xf589f43ae07df2a5, .ex = -76, .sgn = 0x0},
+    {.hi = 0xd0aec35d91ab8ca6, .lo = 0x817933b5869f47a2, .ex = -79, .sgn = 0x0},
+    {.hi = 0x8206a5596f313080, .lo = 0xaf99a9f7dc4c40b6, .ex = -81, .sgn = 0x0},
+    {.hi = 0x9d0c41432e936d12, .lo = 0x7cd9d032746e70b2, .ex = -84, .sgn = 0x0},
+    {.hi = 0xb7d9757bec081333, .lo = 0xbe453716c9b0f240, .ex = -87, .sgn = 0x0},
+    {.hi = 0xd09a6986b2af2094, .lo = 0xc4467979998b6bd1, .ex = -90, .sgn = 0x0},
+    {.hi = 0xe56857ddab4d87a7, .lo = 0x4ac926d81f905661, .ex = -93, .sgn = 0x0},
+    {.hi = 0xf4865ae56382b769, .lo = 0x4362c19914e2dd81, .ex = -96, .sgn = 0x0},
+    {.hi = 0xfc9e868c37de668a, .lo = 0x121169666c2b65de, .ex = -99, .sgn = 0x0},
+    {.hi = 0xfcf3b91c70018ba8, .lo = 0xced2729353d333e8, .ex = -102, .sgn = 0x0},
+    {.hi = 0xf57e158054cd8949, .lo = 0xdf56bf117bc1511b, .ex = -105, .sgn = 0x0},
+    {.hi = 0xe6ec35c1f33ce6d1, .lo = 0x0e22bef2b1a68854, .ex = -108, .sgn = 0x0},
+    {.hi = 0xd288d51c13ccc5fa, .lo = 0xe5ede2ae785307e1, .ex = -111, .sgn = 0x0},
+    {.hi = 0xba0a72dae521e3d8, .lo = 0x678c02e853fd98c4, .ex = -114, .sgn = 0x0},
+    {.hi = 0x9f56ba48830d7bc6, .lo = 0xac982f5f39b11ceb, .ex = -117, .sgn = 0x0},
+    {.hi = 0x8445405c1b99418b, .lo = 0x6f0a6cbd9c616218, .ex = -120, .sgn = 0x0},
+    {.hi = 0xd4d83fa48d139895, .lo = 0x66ace14da851a3d9, .ex = -124, .sgn = 0x0},
+    {.hi = 0xa5fb6543d2383943, .lo = 0x1983eb49a3e27360, .ex = -127, .sgn = 0x0},
+    {.hi = 0xfae8e2c7ee355cc0, .lo = 0x552fa5a08cd6ecbe, .ex = -131, .sgn = 0x0},
+    {.hi = 0xb7cfb17620c9d16c, .lo = 0xc2d3cff4139e44af, .ex = -134, .sgn = 0x0},
+    {.hi = 0x8283710bc1130ed5, .lo = 0xe0bc7d0c18cf0ffa, .ex = -137, .sgn = 0x0},
+    {.hi = 0xb3a327c51b57f7b1, .lo = 0xedf4f596e0c0ef05, .ex = -141, .sgn = 0x0},
+    {.hi = 0xefa4d086662b3eeb, .lo = 0xcaa301e84e6e2206, .ex = -145, .sgn = 0x0},
+    {.hi = 0x9aedf4376cae358a, .lo = 0x964b53a282e464a8, .ex = -148, .sgn = 0x0},
+    {.hi = 0xc2290762f5aaccfb, .lo = 0xea0b66d4bff5fc2a, .ex = -152, .sgn = 0x0},
+    {.hi = 0xebd6ae6e1ba0f11d, .lo = 0x5e46c0e62a86712f, .ex = -156, .sgn = 0x0},
+    {.hi = 0x8ad333c700415c98, .lo = 0x1c08523a0b9b6c68, .ex = -159, .sgn = 0x0},
+    {.hi = 0x9e689bb0f8b98b3f, .lo = 0xb3f406cb200bd1de, .ex = -163, .sgn = 0x0},
+    {.hi = 0xaf318fd954b6db2e, .lo = 0x0295fa9acde133db, .ex = -167, .sgn = 0x0},
+    {.hi = 0xbbcbbbb3dc0cde5f, .lo = 0xdc8d922b2a57ddf6, .ex = -171, .sgn = 0x0},
+    {.hi = 0xc31c70889018ea98, .lo = 0xee80c558dd92bba0, .ex = -175, .sgn = 0x0},
+    {.hi = 0xc4797b04ff269bb1, .lo = 0x8363b0d1506232c4, .ex = -179, .sgn = 0x0},
+    {.hi = 0xbfc2a7ea3f3e9600, .lo = 0x65d2e02765f7303c, .ex = -183, .sgn = 0x0},
+    {.hi = 0xb566aa80bf27110d, .lo = 0x07c5f0b81473a444, .ex = -187, .sgn = 0x0},
+    {.hi = 0xa6525c47b11a5fd0, .lo = 0x315ad05c4f59c8b3, .ex = -191, .sgn = 0x0},
+    {.hi = 0x93cdd92235d7a0eb, .lo = 0x4d417565b6c4d24c, .ex = -195, .sgn = 0x0},
+    {.hi = 0xfe9d2e1d60c5d6b8, .lo = 0x6f167c698bec926d, .ex = -200, .sgn = 0x0},
+    {.hi = 0xd48eb579ab43d7ed, .lo = 0xf370ffac836d6c1f, .ex = -204, .sgn = 0x0},
+    {.hi = 0xabfcfccbf0fa8c7b, .lo = 0x6388f6a184b3a4b5, .ex = -208, .sgn = 0x0},
+    {.hi = 0x86e16d90f5790bcc, .lo = 0x19dffaf31aa5ac0a, .ex = -212, .sgn = 0x0},
+    {.hi = 0xcd0ca237b2be6336, .lo = 0x97e211809d1c9145, .ex = -217, .sgn = 0x0},
+    {.hi = 0x9710cd65811d6ec9, .lo = 0x666cf562c7292adc, .ex = -221, .sgn = 0x0},
+    {.hi = 0xd7bd836ebe17cde9, .lo = 0xe9a7512af677cbcd, .ex = -226, .sgn = 0x0},
+    {.hi = 0x954fe8910f1ab7a5, .lo = 0x67217d24e96e759a, .ex = -230, .sgn = 0x0},
+    {.hi = 0xc85117706a836fd3, .lo = 0x2363aca34079a950, .ex = -235, .sgn = 0x0},
+    {.hi = 0x823cee80b14c3778, .lo = 0x1a343ce3416f2750, .ex = -239, .sgn = 0x0},
+    {.hi = 0xa4240b0fa72849ef, .lo = 0xd0a0418481471c3b, .ex = -244, .sgn = 0x0},
+    {.hi = 0xc88116c1dfc7a53b, .lo = 0x9fa7824458216220, .ex = -249, .sgn = 0x0},
+    {.hi = 0xed635aaa4b07f5ac, .lo = 0x24b65570bfcffe5f, .ex = -254, .sgn = 0x0},
+    {.hi = 0x883471cb99eaf444, .lo = 0x1bf64b685465e1f8, .ex = -258, .sgn = 0x0},
+    {.hi = 0x977d7e448b1e1be2, .lo = 0x629b6344f43aa326, .ex = -263, .sgn = 0x0},
+    {.hi = 0xa34e97d66337b6c0, .lo = 0xa2a91b62dc2c41c1, .ex = -268, .sgn = 0x0},
+    {.hi = 0xaaa11366aa17752c, .lo = 0xdd6a36b220c095e6, .ex = -273, .sgn = 0x0},
+    {.hi = 0xaccb6bf09fa339f2, .lo = 0x6ad5b3b5e6506624, .ex = -278, .sgn = 0x0},
+    {.hi = 0xa99a8cc27aeb0878, .lo = 0x1ec077a358a39dc1, .ex = -283, .sgn = 0x0},
+    {.hi = 0xa15995345b21992d, .lo = 0x3493dde9583e2853, .ex = -288, .sgn = 0x0},
+    {.hi = 0x94c673276de28d60, .lo = 0x7eacc6640d790c3b, .ex = -293, .sgn = 0x0},
+    {.hi = 0x84f5b9a60d18a3a1, .lo = 0xc07524b0fc9f2f33, .ex = -298, .sgn = 0x0},
+    {.hi = 0xe656f9d6d8d78130, .lo = 0x722a8a62869ba6c7, .ex = -304, .sgn = 0x0},
+    {.hi = 0xc161bb61d66ef5cb, .lo = 0x9883b27db2c4018a, .ex = -309, .sgn = 0x0},
+    {.hi = 0x9d5bcc62cea60e3e, .lo = 0xcdc30eb36b5fae49, .ex = -314, .sgn = 0x0},
+    {.hi = 0xf83667288ed1f26a, .lo = 0x359819a30c0e8b9c, .ex = -320, .sgn = 0x0},
+    {.hi = 0xbdbd0690f8130d4a, .lo = 0x43290e46e4bbdc65, .ex = -325, .sgn = 0x0},
+    {.hi = 0x8c93c5facff99c13, .lo = 0xd6c1f8a04bb20835, .ex = -330, .sgn = 0x0},
+    {.hi = 0xc9e60512a54faafc, .lo = 0x69ae5d14bc8cafd9, .ex = -336, .sgn = 0x0},
+    {.hi = 0x8c86106adac03d7c, .lo = 0x9ce884eb9d3942bb, .ex = -341, .sgn = 0x0},
+    {.hi = 0xbd9806981f696194, .lo = 0xfa89a2b275ecfd40, .ex = -347, .sgn = 0x0},
+    {.hi = 0xf7edd0171677f8e9, .lo = 0x3a1a32bdd547b51c, .ex = -353, .sgn = 0x0},
+    {.hi = 0x9d1e734db50a1beb, .lo = 0x5c2e7103dc907bf0, .ex = -358, .sgn = 0x0},
+    {.hi = 0xc1038288737485c3, .lo = 0x375fb0c52bffcee1, .ex = -364, .sgn = 0x0},
+    {.hi = 0xe5d0539574e04379, .lo = 0xd17e1f81fff32b4a, .ex = -370, .sgn = 0x0},
+    {.hi = 0x849b10719ecfc4f0, .lo = 0x2550e56d623fd4f4, .ex = -375, .sgn = 0x0},
+    {.hi = 0x945288ec3e73e58d, .lo = 0xa7c98c2b8515e2d8, .ex = -381, .sgn = 0x0},
+    {.hi = 0xa0cc2ef47bd0a092, .lo = 0xbd324f78fce0ff3c, .ex = -387, .sgn = 0x0},
+    {.hi = 0xa8f56f151213c863, .lo = 0x2d26139e100596a6, .ex = -393, .sgn = 0x0},
+    {.hi = 0xac1269879fe70966, .lo = 0xf9133009814c09db, .ex = -399, .sgn = 0x0},
+    {.hi = 0xa9d9d084d4a56d8b, .lo = 0xa9d801ce5102224f, .ex = -405, .sgn = 0x0},
+    {.hi = 0xa280078f76009c3e, .lo = 0xd4275801a8980a18, .ex = -411, .sgn = 0x0},
+    {.hi = 0x96af2d0dc1446e96, .lo = 0x50ebbf3c73fc29b1, .ex = -417, .sgn = 0x0},
+    {.hi = 0x876dbb84c54afebf, .lo = 0x1f9519cdd2005b35, .ex = -423, .sgn = 0x0},
+    {.hi = 0xebf20167a4d10871, .lo = 0xf4e8a1e02374d98d, .ex = -430, .sgn = 0x0},
+    {.hi = 0xc735b15701a4398e, .lo = 0x5818be560d5a2190, .ex = -436, .sgn = 0x0},
+    {.hi = 0xa304d8620c1e5082, .lo = 0xcebdb83a62138b86, .ex = -442, .sgn = 0x0},
+    {.hi = 0x814c707e0301bad5, .lo = 0x5f04c9c42f1bfbc2, .ex = -448, .sgn = 0x0},
+    {.hi = 0xc6cbccf2f92909d3, .lo = 0x3efb4ea90144549e, .ex = -455, .sgn = 0x0},
+    {.hi = 0x941f49c52c37b8a9, .lo = 0x07c42a73565d394e, .ex = -461, .sgn = 0x0},
+    {.hi = 0xd5f07f690a5e4d7b, .lo = 0xe572e3cf7fcc5cbc, .ex = -468, .sgn = 0x0},
+    {.hi = 0x95bf61813169574d, .lo = 0x0098b304ff5a302f, .ex = -474, .sgn = 0x0},
+    {.hi = 0xcb2ecfc4aeccdcba, .lo = 0x9abbfaa61d7e8a22, .ex = -481, .sgn = 0x0},
+    {.hi = 0x859a15b206609b44, .lo = 0x7c67fb3ef45ac956, .ex = -487, .sgn = 0x0},
+    {.hi = 0xaa4af94a4e32f3d6, .lo = 0xbc5ad90bed5d5490, .ex = -494, .sgn = 0x0},
+    {.hi = 0xd261cb4055d85b7f, .lo = 0x336ca099fcdef439, .ex = -501, .sgn = 0x0},
+    {.hi = 0xfbe97f883114dc3d, .lo = 0x4cd6f0648861dc44, .ex = -508, .sgn = 0x0},
+    {.hi = 0x922e105d1451c5f6, .lo = 0x3269f41d02ee6085, .ex = -514, .sgn = 0x0},
+    {.hi = 0xa46e716e1f66a4d2, .lo = 0x194720ad6313e41a, .ex = -521, .sgn = 0x0},
+    {.hi = 0xb34562b8797e4165, .lo = 0x3718e40999b09152, .ex = -528, .sgn = 0x0},
+    {.hi = 0xbd6fc1423967e9b0, .lo = 0x6155463483a3aed1, .ex = -535, .sgn = 0x0},
+    {.hi = 0xc20506cbdd894536, .lo = 0x4cca317049722c1a, .ex = -542, .sgn = 0x0},
+    {.hi = 0xc0998e9d16640990, .lo = 0xcd1ee7820f476951, .ex = -549, .sgn = 0x0},
+    {.hi = 0xb94ee0386493525f, .lo = 0xc0d621a83aaca746, .ex = -556, .sgn = 0x0},
+    {.hi = 0xacce953242bd5a19, .lo = 0xe687b08faaf90acf, .ex = -563, .sgn = 0x0},
+    {.hi = 0x9c30ed9991857c04, .lo = 0x3b40acec91eb3c32, .ex = -570, .sgn = 0x0},
+    {.hi = 0x88d45aa51861a1d2, .lo = 0xf8931edb327219a5, .ex = -577, .sgn = 0x0},
+    {.hi = 0xe85c2c8dc413c3c9, .lo = 0x34a60766d6b065fa, .ex = -585, .sgn = 0x0},
+    {.hi = 0xbf393d764caa9d11, .lo = 0x2820c777c85d9062, .ex = -592, .sgn = 0x0},
+    {.hi = 0x98872fb7dfea1f8c, .lo = 0xe5ab978f54c4fec8, .ex = -599, .sgn = 0x0},
+    {.hi = 0xebd6e37bb21876e1, .lo = 0xc7217a37960f4f2d, .ex = -607, .sgn = 0x0},
+    {.hi = 0xb0b7dbdc886086fd, .lo = 0x6931f8ef706e169d, .ex = -614, .sgn = 0x0},
+    {.hi = 0x8057fb1b1356766a, .lo = 0xe6c23ff36d985aa0, .ex = -621, .sgn = 0x0},
+    {.hi = 0xb4afc56e850311ed, .lo = 0x230a67bfe61238de, .ex = -629, .sgn = 0x0},
+    {.hi = 0xf68ce85bc38c61fd, .lo = 0x23674aba429453db, .ex = -637, .sgn = 0x0},
+    {.hi = 0xa3093f469bdd37d2, .lo = 0x5c589d4d197ffb35, .ex = -644, .sgn = 0x0},
+    {.hi = 0xd0fcc9db39b8e626, .lo = 0x62ee8f91aaa2b246, .ex = -652, .sgn = 0x0},
+    {.hi = 0x81d2effe10e8691c, .lo = 0x2b395ea44eb9a169, .ex = -659, .sgn = 0x0},
+    {.hi = 0x9c54fdc9f5c2ffc0, .lo = 0x13e7be1477236ee4, .ex = -667, .sgn = 0x0},
+    {.hi = 0xb675eb51afc318c0, .lo = 0xd8248c9f6e585ede, .ex = -675, .sgn = 0x0},
+    {.hi = 0xce677fa078fd88e3, .lo = 0xca32a5fa359cf441, .ex = -683, .sgn = 0x0},
+    {.hi = 0xe24e67da88e95eb4, .lo = 0xaa02f4e73e198ce8, .ex = -691, .sgn = 0x0},
+    {.hi = 0xf07e40c05835bd99, .lo = 0x842c97408e9ee9b0, .ex = -699, .sgn = 0x0},
+    {.hi = 0xf7b4d65d17ca87b9, .lo = 0x62000c911ade424d, .ex = -707, .sgn = 0x0},
+    {.hi = 0xf7494828226a9648, .lo = 0x47cd9c781fdd7066, .ex = -715, .sgn = 0x0},
+    {.hi = 0xef45837823aec161, .lo = 0x3e728b60884ff2d1, .ex = -723, .sgn = 0x0},
+    {.hi = 0xe064c096d57686f8, .lo = 0x3ff51e85b9c9c0fb, .ex = -731, .sgn = 0x0},
+    {.hi = 0xcbf754175c1146f3, .lo = 0x4c9202564f59281e, .ex = -739, .sgn = 0x0},
+    {.hi = 0xb3b1b5790f865603, .lo = 0x47330927a8d52d12, .ex = -747, .sgn = 0x0},
+    {.hi = 0x99709bed877919af, .lo = 0x35488c72e5c3e738, .ex = -755, .sgn = 0x0},
+    {.hi = 0xfdfb11f9df6dcc3d, .lo = 0x3103b13f1142ad01, .ex = -764, .sgn = 0x0},
+    {.hi = 0xcbbbada4760d4ede, .lo = 0xdbbdbc3661fa1af6, .ex = -772, .sgn = 0x0},
+    {.hi = 0x9e65fd208952c343, .lo = 0xa107fae377a42c4b, .ex = -780, .sgn = 0x0},
+    {.hi = 0xeeb9a49344e8fe16, .lo = 0x91f2429c3834b7aa, .ex = -789, .sgn = 0x0},
+    {.hi = 0xae5bdc2d53033a33, .lo = 0x29624d10e098d090, .ex = -797, .sgn = 0x0},
+    {.hi = 0xf6dbc25df7228e3c, .lo = 0x2d43ed7034af2960, .ex = -806, .sgn = 0x0},
+    {.hi = 0xa960195f3155553c, .lo = 0xd992c9ccc75b1d03, .ex = -814, .sgn = 0x0},
+    {.hi = 0xe1461fe4a098dbb5, .lo = 0xe2bbec84b290de9a, .ex = -823, .sgn = 0x0},
+    {.hi = 0x91337a0a672bd416, .lo = 0xef8a97430305f5fd, .ex = -831, .sgn = 0x0},
+    {.hi = 0xb56bb946b6d80486, .lo = 0xe1d720889a58937b, .ex = -840, .sgn = 0x0},
+    {.hi = 0xdbb386f683df3b36, .lo = 0x7eef2b191ed33548, .ex = -849, .sgn = 0x0},
+    {.hi = 0x80efc8a84bdb1fc1, .lo = 0x42d918b362420182, .ex = -857, .sgn = 0x0},
+    {.hi = 0x92aebcedf1c82b84, .lo = 0x4d7798eade07d27c, .ex = -866, .sgn = 0x0},
+    {.hi = 0xa1bca0b6fd631982, .lo = 0x4d4da4ed5c2622e6, .ex = -875, .sgn = 0x0},
+    {.hi = 0xacd96bb960d81fed, .lo = 0x0327b17cf3dd17a9, .ex = -884, .sgn = 0x0},
+    {.hi = 0xb30ab89baf71863b, .lo = 0x28f2490ae3667774, .ex = -893, .sgn = 0x0},
+    {.hi = 0xb3c01beb4d445319, .lo = 0x2b7556df10f44e0b, .ex = -902, .sgn = 0x0},
+    {.hi = 0xaee8d85dc2592d82, .lo = 0x6f2c3d576d0daccc, .ex = -911, .sgn = 0x0},
+    {.hi = 0xa4f66b2beaeeb2a8, .lo = 0xc665bedee54d17b2, .ex = -920, .sgn = 0x0},
+    {.hi = 0x96cb66e95185bcc6, .lo = 0x097c2ad75d8fffd7, .ex = -929, .sgn = 0x0},
+    {.hi = 0x859a33bff4a43397, .lo = 0x8e35f3e093677729, .ex = -938, .sgn = 0x0},
+    {.hi = 0xe574ef4780605b25, .lo = 0x519427f8af398c3f, .ex = -948, .sgn = 0x0},
+    {.hi = 0xbefaaa0ba49463eb, .lo = 0xe8227672efed9422, .ex = -957, .sgn = 0x0},
+    {.hi = 0x9a10381e9b07535d, .lo = 0x5439a92a12e26969, .ex = -966, .sgn = 0x0},
+    {.hi = 0xf0eb42ce08a93503, .lo = 0x04c321715763c152, .ex = -976, .sgn = 0x0},
+    {.hi = 0xb6932ae42b075bd1, .lo = 0x31b243f749dc33f2, .ex = -985, .sgn = 0x0},
+    {.hi = 0x861a6e2cafa5f5bb, .lo = 0xc049e66e49ece5f4, .ex = -994, .sgn = 0x0},
+    {.hi = 0xbef0851254df1484, .lo = 0xe9b51d4aa6a97ecf, .ex = -1004, .sgn = 0x0},
+    {.hi = 0x83c001e94a1346ba, .lo = 0x2928c7d8b9c1f431, .ex = -1013, .sgn = 0x0},
+    {.hi = 0xb03938e58e117e58, .lo = 0x6b04b5f309210d17, .ex = -1023, .sgn = 0x0},
+    {.hi = 0xe4751c103da4635e, .lo = 0x95112f371343b146, .ex = -1033, .sgn = 0x0},
+    {.hi = 0x8f87e27f20d77802, .lo = 0x08b3c524d39863a9, .ex = -1042, .sgn = 0x0},
+    {.hi = 0xaeccfa7a7d3d135f, .lo = 0x038fd9bbd9383532, .ex = -1052, .sgn = 0x0},
+    {.hi = 0xce5559039be25452, .lo = 0x5c486e115599059b, .ex = -1062, .sgn = 0x0},
+    {.hi = 0xec0f9ad7ebfd90f5, .lo = 0xc393cf3c67bf58d6, .ex = -1072, .sgn = 0x0},
+};
+
+static const dint64_t TWO = {
+    .hi = 0x8000000000000000, .lo = 0x0, .ex = 1, .sgn = 0x0};
+
+/* INV[n] is 1/(n+1) rounded to 128 bits */
+#define NMAX 80
+static const dint64_t INV[NMAX+1] = {
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = 0, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -1, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -2, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -2, .sgn = 0x0},
+    {.hi = 0xcccccccccccccccc, .lo = 0xcccccccccccccccd, .ex = -3, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -3, .sgn = 0x0},
+    {.hi = 0x9249249249249249, .lo = 0x2492492492492492, .ex = -3, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -3, .sgn = 0x0},
+    {.hi = 0xe38e38e38e38e38e, .lo = 0x38e38e38e38e38e4, .ex = -4, .sgn = 0x0},
+    {.hi = 0xcccccccccccccccc, .lo = 0xcccccccccccccccd, .ex = -4, .sgn = 0x0},
+    {.hi = 0xba2e8ba2e8ba2e8b, .lo = 0xa2e8ba2e8ba2e8ba, .ex = -4, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -4, .sgn = 0x0},
+    {.hi = 0x9d89d89d89d89d89, .lo = 0xd89d89d89d89d89e, .ex = -4, .sgn = 0x0},
+    {.hi = 0x9249249249249249, .lo = 0x2492492492492492, .ex = -4, .sgn = 0x0},
+    {.hi = 0x8888888888888888, .lo = 0x8888888888888889, .ex = -4, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -4, .sgn = 0x0},
+    {.hi = 0xf0f0f0f0f0f0f0f0, .lo = 0xf0f0f0f0f0f0f0f1, .ex = -5, .sgn = 0x0},
+    {.hi = 0xe38e38e38e38e38e, .lo = 0x38e38e38e38e38e4, .ex = -5, .sgn = 0x0},
+    {.hi = 0xd79435e50d79435e, .lo = 0x50d79435e50d7943, .ex = -5, .sgn = 0x0},
+    {.hi = 0xcccccccccccccccc, .lo = 0xcccccccccccccccd, .ex = -5, .sgn = 0x0},
+    {.hi = 0xc30c30c30c30c30c, .lo = 0x30c30c30c30c30c3, .ex = -5, .sgn = 0x0},
+    {.hi = 0xba2e8ba2e8ba2e8b, .lo = 0xa2e8ba2e8ba2e8ba, .ex = -5, .sgn = 0x0},
+    {.hi = 0xb21642c8590b2164, .lo = 0x2c8590b21642c859, .ex = -5, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -5, .sgn = 0x0},
+    {.hi = 0xa3d70a3d70a3d70a, .lo = 0x3d70a3d70a3d70a4, .ex = -5, .sgn = 0x0},
+    {.hi = 0x9d89d89d89d89d89, .lo = 0xd89d89d89d89d89e, .ex = -5, .sgn = 0x0},
+    {.hi = 0x97b425ed097b425e, .lo = 0xd097b425ed097b42, .ex = -5, .sgn = 0x0},
+    {.hi = 0x9249249249249249, .lo = 0x2492492492492492, .ex = -5, .sgn = 0x0},
+    {.hi = 0x8d3dcb08d3dcb08d, .lo = 0x3dcb08d3dcb08d3e, .ex = -5, .sgn = 0x0},
+    {.hi = 0x8888888888888888, .lo = 0x8888888888888889, .ex = -5, .sgn = 0x0},
+    {.hi = 0x8421084210842108, .lo = 0x4210842108421084, .ex = -5, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -5, .sgn = 0x0},
+    {.hi = 0xf83e0f83e0f83e0f, .lo = 0x83e0f83e0f83e0f8, .ex = -6, .sgn = 0x0},
+    {.hi = 0xf0f0f0f0f0f0f0f0, .lo = 0xf0f0f0f0f0f0f0f1, .ex = -6, .sgn = 0x0},
+    {.hi = 0xea0ea0ea0ea0ea0e, .lo = 0xa0ea0ea0ea0ea0ea, .ex = -6, .sgn = 0x0},
+    {.hi = 0xe38e38e38e38e38e, .lo = 0x38e38e38e38e38e4, .ex = -6, .sgn = 0x0},
+    {.hi = 0xdd67c8a60dd67c8a, .lo = 0x60dd67c8a60dd67d, .ex = -6, .sgn = 0x0},
+    {.hi = 0xd79435e50d79435e, .lo = 0x50d79435e50d7943, .ex = -6, .sgn = 0x0},
+    {.hi = 0xd20d20d20d20d20d, .lo = 0x20d20d20d20d20d2, .ex = -6, .sgn = 0x0},
+    {.hi = 0xcccccccccccccccc, .lo = 0xcccccccccccccccd, .ex = -6, .sgn = 0x0},
+    {.hi = 0xc7ce0c7ce0c7ce0c, .lo = 0x7ce0c7ce0c7ce0c8, .ex = -6, .sgn = 0x0},
+    {.hi = 0xc30c30c30c30c30c, .lo = 0x30c30c30c30c30c3, .ex = -6, .sgn = 0x0},
+    {.hi = 0xbe82fa0be82fa0be, .lo = 0x82fa0be82fa0be83, .ex = -6, .sgn = 0x0},
+    {.hi = 0xba2e8ba2e8ba2e8b, .lo = 0xa2e8ba2e8ba2e8ba, .ex = -6, .sgn = 0x0},
+    {.hi = 0xb60b60b60b60b60b, .lo = 0x60b60b60b60b60b6, .ex = -6, .sgn = 0x0},
+    {.hi = 0xb21642c8590b2164, .lo = 0x2c8590b21642c859, .ex = -6, .sgn = 0x0},
+    {.hi = 0xae4c415c9882b931, .lo = 0x0572620ae4c415ca, .ex = -6, .sgn = 0x0},
+    {.hi = 0xaaaaaaaaaaaaaaaa, .lo = 0xaaaaaaaaaaaaaaab, .ex = -6, .sgn = 0x0},
+    {.hi = 0xa72f05397829cbc1, .lo = 0x4e5e0a72f0539783, .ex = -6, .sgn = 0x0},
+    {.hi = 0xa3d70a3d70a3d70a, .lo = 0x3d70a3d70a3d70a4, .ex = -6, .sgn = 0x0},
+    {.hi = 0xa0a0a0a0a0a0a0a0, .lo = 0xa0a0a0a0a0a0a0a1, .ex = -6, .sgn = 0x0},
+    {.hi = 0x9d89d89d89d89d89, .lo = 0xd89d89d89d89d89e, .ex = -6, .sgn = 0x0},
+    {.hi = 0x9a90e7d95bc609a9, .lo = 0x0e7d95bc609a90e8, .ex = -6, .sgn = 0x0},
+    {.hi = 0x97b425ed097b425e, .lo = 0xd097b425ed097b42, .ex = -6, .sgn = 0x0},
+    {.hi = 0x94f2094f2094f209, .lo = 0x4f2094f2094f2095, .ex = -6, .sgn = 0x0},
+    {.hi = 0x9249249249249249, .lo = 0x2492492492492492, .ex = -6, .sgn = 0x0},
+    {.hi = 0x8fb823ee08fb823e, .lo = 0xe08fb823ee08fb82, .ex = -6, .sgn = 0x0},
+    {.hi = 0x8d3dcb08d3dcb08d, .lo = 0x3dcb08d3dcb08d3e, .ex = -6, .sgn = 0x0},
+    {.hi = 0x8ad8f2fba9386822, .lo = 0xb63cbeea4e1a08ae, .ex = -6, .sgn = 0x0},
+    {.hi = 0x8888888888888888, .lo = 0x8888888888888889, .ex = -6, .sgn = 0x0},
+    {.hi = 0x864b8a7de6d1d608, .lo = 0x64b8a7de6d1d6086, .ex = -6, .sgn = 0x0},
+    {.hi = 0x8421084210842108, .lo = 0x4210842108421084, .ex = -6, .sgn = 0x0},
+    {.hi = 0x8208208208208208, .lo = 0x2082082082082082, .ex = -6, .sgn = 0x0},
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = -6, .sgn = 0x0},
+    {.hi = 0xfc0fc0fc0fc0fc0f, .lo = 0xc0fc0fc0fc0fc0fc, .ex = -7, .sgn = 0x0},
+    {.hi = 0xf83e0f83e0f83e0f, .lo = 0x83e0f83e0f83e0f8, .ex = -7, .sgn = 0x0},
+    {.hi = 0xf4898d5f85bb3950, .lo = 0x3d226357e16ece54, .ex = -7, .sgn = 0x0},
+    {.hi = 0xf0f0f0f0f0f0f0f0, .lo = 0xf0f0f0f0f0f0f0f1, .ex = -7, .sgn = 0x0},
+    {.hi = 0xed7303b5cc0ed730, .lo = 0x3b5cc0ed7303b5cc, .ex = -7, .sgn = 0x0},
+    {.hi = 0xea0ea0ea0ea0ea0e, .lo = 0xa0ea0ea0ea0ea0ea, .ex = -7, .sgn = 0x0},
+    {.hi = 0xe6c2b4481cd85689, .lo = 0x039b0ad12073615a, .ex = -7, .sgn = 0x0},
+    {.hi = 0xe38e38e38e38e38e, .lo = 0x38e38e38e38e38e4, .ex = -7, .sgn = 0x0},
+    {.hi = 0xe070381c0e070381, .lo = 0xc0e070381c0e0704, .ex = -7, .sgn = 0x0},
+    {.hi = 0xdd67c8a60dd67c8a, .lo = 0x60dd67c8a60dd67d, .ex = -7, .sgn = 0x0},
+    {.hi = 0xda740da740da740d, .lo = 0xa740da740da740da, .ex = -7, .sgn = 0x0},
+    {.hi = 0xd79435e50d79435e, .lo = 0x50d79435e50d7943, .ex = -7, .sgn = 0x0},
+    {.hi = 0xd4c77b03531dec0d, .lo = 0x4c77b03531dec0d5, .ex = -7, .sgn = 0x0},
+    {.hi = 0xd20d20d20d20d20d, .lo = 0x20d20d20d20d20d2, .ex = -7, .sgn = 0x0},
+    {.hi = 0xcf6474a8819ec8e9, .lo = 0x51033d91d2a2067b, .ex = -7, .sgn = 0x0},
+    {.hi = 0xcccccccccccccccc, .lo = 0xcccccccccccccccd, .ex = -7, .sgn = 0x0},
+    {.hi = 0xca4587e6b74f0329, .lo = 0x161f9add3c0ca458, .ex = -7, .sgn = 0x0},
+};
+
+/* Convert a dint64_t value to a double, rounding according to the current
+   rounding mode. Contrary to log.c, the result might be subnormal. */
+static inline double
+dint_tod (dint64_t *a)
+{
+  if (a->ex < -1022)
+  {
+    /* a = N*2^-1074 + ..., where N = hi >> s */
+    int64_t s = -1011 - a->ex;
+    uint64_t N, rb, st;
+    if (s < 64)
+    {
+      N = a->hi >> s;
+      rb = (a->hi >> (s - 1)) & 1;
+      st = (a->hi << (65 - s)) || a->lo;
+    }
+    else
+    {
+      N = 0;
+      rb = s == 64;
+      st = s > 64 || (a->hi << 1) || a->lo;
+    }
+    /* 2^52 + N has ulp 1, thus adding rd rounds to an integer
+       with the current rounding mode */
+    double rd = (rb ? 0.5 : 0.0) + (st ? 0.25 : 0.0);
+    double T = 0x1p52 + (double) N;
+    if (a->sgn)
+      T = (-T - rd) + 0x1p52;
+    else
+      T = (T + rd) - 0x1p52;
+    /* avoid a wrong sign when the result is zero */
+    T = __builtin_copysign (T, a->sgn ? -1.0 : 1.0);
+    return T * 0x1p-1074;
+  }
+
+  b64u64_u r = {.u = (a->hi >> 11) | (0x3ffl << 52)};
+  /* r contains the upper 53 bits of a->hi, 1 <= r < 2 */
+
+  double rd = 0.0;
+  /* if round bit is 1, add 2^-53 */
+  if ((a->hi >> 10) & 0x1)
+    rd += 0x1p-53;
+
+  /* if trailing bits after the rounding bit are non zero, add 2^-54 */
+  if (a->hi & 0x3ff || a->lo)
+    rd += 0x1p-54;
+
+  r.u = r.u | a->sgn << 63;
+  r.f += (a->sgn == 0) ? rd : -rd;
+
+  /* 0 < erfc(x) < 2, thus a->ex <= 0 */
+  b64u64_u e = {.u = ((a->ex + 1023) & 0x7ff) << 52};
+
+  return r.f * e.f;
+}
+
+/* Extract the exponent and significand of a double */
+static inline void
+dint_fromd (dint64_t *a, double b)
+{
+  b64u64_u x = {.f = b};
+  a->ex = (x.u >> 52) & 0x7ff;
+  a->hi = (x.u & 0xfffffffffffff) + (a->ex ? (1ul << 52) : 0);
+  a->ex -= 0x3ff;
+  uint32_t t = __builtin_clzl (a->hi);
+  a->sgn = b < 0.0;
+  a->hi = a->hi << t;
+  a->ex = a->ex - (t > 11 ? t - 12 : 0);
+  a->lo = 0;
+}
+
+/* Put in r an approximation of int(g(t), t=0..h) = sum(a[n]*h^(n+1)/(n+1)),
+   where g(t) = exp(-2*x0*t-t^2) and x0 = k/8. We use b[n] = a[n]*h^n,
+   which satisfies b[n+1] = (u*b[n] + w*b[n-1])/(n+1) with u = -2*x0*h
+   and w = -2*h^2. */
+static void
+erf_int (dint64_t *r, int k, double h)
+{
+  dint64_t H, U, W, b0, b1, b2, t;
+
+  dint_fromd (&H, h);
+  /* u = -k*h/4 and w = -2*h^2 are computed exactly */
+  if (k)
+  {
+    mul_dint_2 (&U, -k, &H);
+    U.ex -= 2;
+  }
+  else
+    cp_dint (&U, &ZERO);
+  mul_dint (&W, &H, &H);
+  W.ex ++;
+  W.sgn = 1;
+  cp_dint (&b0, &ONE);
+  cp_dint (&b1, &U);
+  cp_dint (r, &ONE);
+  mul_dint (&t, &b1, &INV[1]);
+  add_dint (r, r, &t);
+  for (int n = 1; n < NMAX; n++)
+  {
+    mul_dint (&t, &U, &b1);
+    mul_dint (&b2, &W, &b0);
+    add_dint (&b2, &b2, &t);
+    mul_dint (&b2, &b2, &INV[n]);
+    mul_dint (&t, &b2, &INV[n + 1]);
+    /* the terms below 2^-127*r are neglected; since |u| < 6.9 and
+       |w| < 1/32 here, for n >= 8 the terms decrease geometrically */
+    int tiny = t.hi == 0 || t.ex < r->ex - 126;
+    if (!tiny)
+      add_dint (r, r, &t);
+    else if (n >= 8 && (b1.hi == 0 || b1.ex < r->ex - 126))
+      break;
+    cp_dint (&b0, &b1);
+    cp_dint (&b1, &b2);
+  }
+  mul_dint (r, r, &H);
+}
+
+static double __attribute__((noinline))
+cr_erfc_accurate (double x)
+{
+  double ax = __builtin_fabs (x);
+  /* for 1/8 <= |x|, 8|x| is exact and x0 = k/8 <= 2|x|, thus h = |x| - x0
+     is exact by Sterbenz lemma */
+  int k = (ax < 0.125) ? 0 : (int) __builtin_ceil (8.0 * ax);
+  double h = ax - (double) k * 0.125;
+  dint64_t r;
+  if (h == 0) /* |x| = k/8 */
+    cp_dint (&r, &ERFC0[k]);
+  else
+  {
+    erf_int (&r, k, h);
+    mul_dint (&r, &r, &EXP0[k]);
+    r.sgn ^= 1;
+    add_dint (&r, &ERFC0[k], &r);
+  }
+  if (x < 0)
+  {
+    r.sgn ^= 1;
+    add_dint (&r, &TWO, &r);
+  }
+  return dint_tod (&r);
+}
+
+double
+cr_erfc (double x)
+{
+  b64u64_u t = {.f = x};
+  uint64_t ux = t.u & 0x7fffffffffffffff;
+  double h, l, err;
+
+  if (__builtin_expect (ux >= 0x7ff0000000000000, 0))
+  {
+    if (ux > 0x7ff0000000000000)
+      return x + x; /* NaN */
+    return (x > 0) ? 0.0 : 2.0; /* +/-Inf */
+  }
+
+  if (__builtin_expect (x >= 0x1.b39dc41e48bfdp+4, 0))
+    /* here erfc(x) < 2^-1075: underflow */
+    return 0x1p-1074 * 0.25;
+
+  if (__builtin_expect (x <= -0x1.7744f8f74e94bp+2, 0))
+    /* here 2 - erfc(x) < 2^-53, thus erfc(x) rounds to 2 for rounding to
+       nearest, and to 2 or 2 - 2^-52 for directed rounding */
+    return 2.0 - 0x1p-54;
+
+  if (__builtin_expect (ux < 0x3c70000000000000, 0)) /* |x| < 2^-56 */
+    /* erfc(x) = 1 - 2/sqrt(pi)*x + ..., where |2/sqrt(pi)*x| < 2^-55.8,
+       thus 1 - x rounds as erfc(x) in all rounding modes */
+    return 1.0 - x;
+
+  /* erfc(|x|) = exp(-x^2)*erfcx(|x|) = 2^e*(h+l) */
+  double ax = __builtin_fabs (x), sh, sl, eh, el;
+  a_mul (&sh, &sl, ax, ax); /* exact since |x| >= 2^-56 */
+  int e = exp_dd (&eh, &el, sh, sl);
+  erfcx_fast (&h, &l, ax);
+  double th, tl;
+  a_mul (&th, &tl, eh, h);
+  l = tl + (eh * l + el * h);
+  h = th;
+  /* the relative error on h+l is bounded by 2^-67.314 + 2^-76 + 2^-100,
+     which is less than 2^-67.29 < 0x1.bp-68 */
+
+  if (x < 0)
+  {
+    /* scale h+l by 2^e (exact since erfc(-x) > 2^-54 here),
+       and compute 2 - (h+l) */
+    b64u64_u sc = {.u = (uint64_t) (0x3ff + e) << 52};
+    h *= sc.f;
+    l *= sc.f;
+    err = h * 0x1.bp-68;
+    fast_two_sum (&h, &th, 2.0, -h);
+    l = th - l;
+  }
+  else if (__builtin_expect (x >= 0x1.a8b12fc6e4892p+4, 0))
+  {
+    /* erfc(x) < 2^-1022: the result is subnormal, we use the same method
+       as in exp.c */
+    th = h + l;
+    l += h - th;
+    h = th * 0x1p-512;
+    l *= 0x1p-512;
+    e += 512;
+    double eps = h * 0x1.bp-68;
+    b64u64_u sd = {.u = (uint64_t) (0x3ff + e) << 52},
+      su = {.u = (uint64_t) (0x3ff - e) << 52};
+    double vd = h * sd.f, vdl = (h - vd * su.f) + l;
+    double fp = __builtin_fma (sd.f, vdl + eps, vd);
+    double fm = __builtin_fma (sd.f, vdl - eps, vd);
+    if (fp == fm)
+      return fp;
+    return cr_erfc_accurate (x);
+  }
+  else
+    err = h * 0x1.bp-68;
+
+  double left = h + (l - err), right = h + (l + err);
+  if (left == right)
+  {
+    if (x < 0)
+      return left;
+    /* 2^e*left is the rounding of erfc(x), which is normal */
+    b64u64_u r = {.f = left};
+    r.u += (uint64_t) (int64_t) e << 52;
+    return r.f;
+  }
+  return cr_erfc_accurate (x);
+}
@@ -32,15 +32,14 @@ SOFTWARE.
 double
 ref_exp2 (double x)
 {
-  mpfr_t y;
+  mpfr_ptr y;
   mpfr_exp_t emin = mpfr_get_emin ();
   mpfr_set_emin (-1073);
-  mpfr_init2 (y, 53);
+  y = ref_var (0, 53);
   mpfr_set_d (y, x, MPFR_RNDN);
   int inex = mpfr_exp2 (y, y, rnd2[rnd]);
   mpfr_subnormalize (y, inex, rnd2[rnd]);
   double ret = mpfr_get_d (y, MPFR_RNDN);
-  mpfr_clear (y);
   mpfr_set_emin (emin);
   return ret;
 }
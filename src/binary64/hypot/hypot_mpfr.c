@@ -27,18 +27,15 @@ SOFTWARE. */
 #include "fenv_mpfr.h"
 
 double ref_hypot (double x, double y){
-  mpfr_t xm, ym, zm;
+  mpfr_ptr xm, ym, zm;
   mpfr_set_emin (-1073);
-  mpfr_init2 (xm, 53);
-  mpfr_init2 (ym, 53);
-  mpfr_init2 (zm, 53);
+  xm = ref_var (0, 53);
+  ym = ref_var (1, 53);
+  zm = ref_var (2, 53);
   mpfr_set_d (xm, x, MPFR_RNDN);
   mpfr_set_d (ym, y, MPFR_RNDN);
   int inex = mpfr_hypot (zm, xm, ym, rnd2[rnd]);
   mpfr_subnormalize (zm, inex, rnd2[rnd]);
   double ret = mpfr_get_d (zm, MPFR_RNDN);
-  mpfr_clear (xm);
-  mpfr_clear (ym);
-  mpfr_clear (zm);
   return ret;
 }
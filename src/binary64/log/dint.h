@@ -255,9 +255,21 @@ static inline void print_dint(const dint64_t *a) {
 
 /*
   Approximation tables
+
+  They are only read by the accurate path, thus they are put in a separate
+  section, away from the tables of the fast path they would otherwise share
+  cache lines with.
 */
 
-static const dint64_t _INVERSE_2[] = {
+#ifndef COLD_TABLE
+#ifdef __ELF__
+#define COLD_TABLE __attribute__((section(".rodata.cold"), aligned(64)))
+#else
+#define COLD_TABLE __attribute__((aligned(64)))
+#endif
+#endif
+
+static const dint64_t _INVERSE_2[] COLD_TABLE = {
     {.hi = 0x8000000000000000, .lo = 0x0,  .ex = 1, .sgn = 0x0},
     {.hi = 0xfe03f80fe03f80ff, .lo = 0x0,  .ex = 0, .sgn = 0x0},
     {.hi = 0xfc0fc0fc0fc0fc10, .lo = 0x0,  .ex = 0, .sgn = 0x0},
@@ -500,7 +512,7 @@ static const dint64_t _INVERSE_2[] = {
     {.hi = 0xb2927c29da5519d0, .lo = 0x0, .ex = -1, .sgn = 0x0},
 };
 
-static const dint64_t _LOG_INV_2[] = {
+static const dint64_t _LOG_INV_2[] COLD_TABLE = {
     {.hi = 0xb17217f7d1cf79ab, .lo = 0xc9e3b39803f2f6af,  .ex = -1, .sgn = 0x1},
     {.hi = 0xaf74155120c9011d,  .lo = 0x46d235ee63073dc,  .ex = -1, .sgn = 0x1},
     {.hi = 0xad7a02e1b24efd32, .lo = 0x160864fd949b4bd3,  .ex = -1, .sgn = 0x1},
@@ -743,7 +755,7 @@ static const dint64_t _LOG_INV_2[] = {
     {.hi = 0xb86a1713c491aeaa, .lo = 0xd37ee2872a6f1cd6,  .ex = -2, .sgn = 0x0},
 };
 
-static const dint64_t P_2[] = {
+static const dint64_t P_2[] COLD_TABLE = {
     {.hi = 0x99df88a0430813ca, .lo = 0xa1cffb6e966a70f6, .ex = -4, .sgn = 0x0},
     {.hi = 0xaaa02d43f696c3e4, .lo = 0x4dbe754667b6bc48, .ex = -4, .sgn = 0x1},
     {.hi = 0xba2e7a1eaf856174, .lo = 0x70e5c5a5ebbe0226, .ex = -4, .sgn = 0x0},
@@ -1,8 +1,8 @@
 #!/bin/bash
 # script to check the error bound of the binary64 cr_log fast path (log.c)
-# r is the entry in the _INVERSE[] table
+# r is the first entry of the row of _INVERSE_LOG_INV[] (log.c)
 r=$1
-# l1 and l2 and the entries in _LOG_INV[]
+# l1 and l2 are the second and third entries of that row
 l1=$2
 l2=$3
 # y0 is the i index (362 <= i <= 724)
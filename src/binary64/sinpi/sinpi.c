@@ -0,0 +1,694 @@
+/* Correctly-rounded sine of binary64 value for angles in half-revolutions
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+#include <errno.h>
+#include <fenv.h>
+#include "dint.h"
+
+/* __builtin_roundeven was introduced in gcc 10:
+   https://gcc.gnu.org/gcc-10/changes.html */
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 10)
+#define ROUNDEVEN __builtin_roundeven
+#else
+#include <math.h>
+/* round x to nearest integer, breaking ties to even */
+static double
+roundeven_fallback (double x)
+{
+  double y = round (x); /* nearest, away from 0 */
+  if (fabs (y - x) == 0.5)
+  {
+    /* if y is odd, we should return y-1 if x>0, and y+1 if x<0 */
+    union { double f; uint64_t n; } u, v;
+    u.f = y;
+    v.f = (x > 0) ? y - 1.0 : y + 1.0;
+    if (__builtin_ctzl (v.n) > __builtin_ctzl (u.n))
+      y = v.f;
+  }
+  return y;
+}
+#define ROUNDEVEN roundeven_fallback
+#endif
+
+typedef union {double f; uint64_t u;} b64u64_u;
+
+/* Add a + b, such that *hi + *lo approximates a + b.
+   Assumes |a| >= |b|.
+   For rounding to nearest, hi + lo = a + b exactly. For directed rounding,
+   |(a+b)-(hi+lo)| <= 2^-105 min(|a+b|,|hi|), see "Note on FastTwoSum with
+   Directed Roundings" by Paul Zimmermann, https://hal.inria.fr/hal-03798376. */
+static inline void
+fast_two_sum (double *hi, double *lo, double a, double b)
+{
+  double e;
+
+  *hi = a + b;
+  e = *hi - a; /* exact */
+  *lo = b - e; /* exact */
+}
+
+// Multiply exactly a and b, such that *hi + *lo = a * b.
+static inline void
+a_mul (double *hi, double *lo, double a, double b)
+{
+  *hi = a * b;
+  *lo = __builtin_fma (a, b, -*hi);
+}
+
+// Put in (hi,lo) an approximation of (ah,al) * (bh,bl).
+static inline void
+d_mul (double *hi, double *lo, double ah, double al, double bh, double bl)
+{
+  a_mul (hi, lo, ah, bh);
+  *lo = __builtin_fma (ah, bl, __builtin_fma (al, bh, *lo));
+}
+
+/* For 0 <= m < 128, T[m][0]+T[m][1] is a double-double approximation of
+   sin(pi*m/128), with relative error bounded by 2^-107. Since
+   sin(pi*(m+128)/128) = -sin(pi*m/128), this gives sin(pi*m/128) and
+   cos(pi*m/128) = sin(pi*(m+64)/128) for any integer m. */
+static const double T[128][2] = {
+  {0x0p+0, 0x0p+0}, /* 0 */
+  {0x1.92155f7a3667ep-6, -0x1.b1d63091a013p-64}, /* 1 */
+  {0x1.91f65f10dd814p-5, -0x1.912bd0d569a9p-61}, /* 2 */
+  {0x1.2d52092ce19f6p-4, -0x1.9a088a8bf6b2cp-59}, /* 3 */
+  {0x1.917a6bc29b42cp-4, -0x1.e2718d26ed688p-60}, /* 4 */
+  {0x1.f564e56a9730ep-4, 0x1.a2704729ae56dp-59}, /* 5 */
+  {0x1.2c8106e8e613ap-3, 0x1.13000a89a11ep-58}, /* 6 */
+  {0x1.5e214448b3fc6p-3, 0x1.531ff779ddac6p-57}, /* 7 */
+  {0x1.8f8b83c69a60bp-3, -0x1.26d19b9ff8d82p-57}, /* 8 */
+  {0x1.c0b826a7e4f63p-3, -0x1.af1439e521935p-62}, /* 9 */
+  {0x1.f19f97b215f1bp-3, -0x1.42deef11da2c4p-57}, /* 10 */
+  {0x1.111d262b1f677p-2, 0x1.824c20ab7aa9ap-56}, /* 11 */
+  {0x1.294062ed59f06p-2, -0x1.5d28da2c4612dp-56}, /* 12 */
+  {0x1.4135c94176601p-2, 0x1.0c97c4afa2518p-56}, /* 13 */
+  {0x1.58f9a75ab1fddp-2, -0x1.efdc0d58cf62p-62}, /* 14 */
+  {0x1.7088530fa459fp-2, -0x1.44b19e0864c5dp-56}, /* 15 */
+  {0x1.87de2a6aea963p-2, -0x1.72cedd3d5a61p-57}, /* 16 */
+  {0x1.9ef7943a8ed8ap-2, 0x1.6da81290bdbabp-57}, /* 17 */
+  {0x1.b5d1009e15ccp-2, 0x1.5b362cb974183p-57}, /* 18 */
+  {0x1.cc66e9931c45ep-2, 0x1.6850e59c37f8fp-58}, /* 19 */
+  {0x1.e2b5d3806f63bp-2, 0x1.e0d891d3c6841p-58}, /* 20 */
+  {0x1.f8ba4dbf89abap-2, -0x1.2ec1fc1b776b8p-60}, /* 21 */
+  {0x1.073879922ffeep-1, -0x1.a5a014347406cp-55}, /* 22 */
+  {0x1.11eb3541b4b23p-1, -0x1.ef23b69abe4f1p-55}, /* 23 */
+  {0x1.1c73b39ae68c8p-1, 0x1.b25dd267f66p-55}, /* 24 */
+  {0x1.26d054cdd12dfp-1, -0x1.5da743ef3770cp-55}, /* 25 */
+  {0x1.30ff7fce17035p-1, -0x1.efcc626f74a6fp-57}, /* 26 */
+  {0x1.3affa292050b9p-1, 0x1.e3e25e3954964p-56}, /* 27 */
+  {0x1.44cf325091dd6p-1, 0x1.8076a2cfdc6b3p-57}, /* 28 */
+  {0x1.4e6cabbe3e5e9p-1, 0x1.3c293edceb327p-57}, /* 29 */
+  {0x1.57d69348cecap-1, -0x1.75720992bfbb2p-55}, /* 30 */
+  {0x1.610b7551d2cdfp-1, -0x1.251b352ff2a37p-56}, /* 31 */
+  {0x1.6a09e667f3bcdp-1, -0x1.bdd3413b26456p-55}, /* 32 */
+  {0x1.72d0837efff96p-1, 0x1.0d4ef0f1d915cp-55}, /* 33 */
+  {0x1.7b5df226aafafp-1, -0x1.0f537acdf0ad7p-56}, /* 34 */
+  {0x1.83b0e0bff976ep-1, -0x1.6f420f8ea3475p-56}, /* 35 */
+  {0x1.8bc806b151741p-1, -0x1.2c5e12ed1336dp-55}, /* 36 */
+  {0x1.93a22499263fbp-1, 0x1.3d419a920df0bp-55}, /* 37 */
+  {0x1.9b3e047f38741p-1, -0x1.30ee286712474p-55}, /* 38 */
+  {0x1.a29a7a0462782p-1, -0x1.128bb015df175p-56}, /* 39 */
+  {0x1.a9b66290ea1a3p-1, 0x1.9f630e8b6dac8p-60}, /* 40 */
+  {0x1.b090a581502p-1, -0x1.926da300ffccep-55}, /* 41 */
+  {0x1.b728345196e3ep-1, -0x1.bc69f324e6d61p-55}, /* 42 */
+  {0x1.bd7c0ac6f952ap-1, -0x1.825a732ac700ap-55}, /* 43 */
+  {0x1.c38b2f180bdb1p-1, -0x1.6e0b1757c8d07p-56}, /* 44 */
+  {0x1.c954b213411f5p-1, -0x1.2fb761e946603p-58}, /* 45 */
+  {0x1.ced7af43cc773p-1, -0x1.e7b6bb5ab58aep-58}, /* 46 */
+  {0x1.d4134d14dc93ap-1, -0x1.4ef5295d25af2p-55}, /* 47 */
+  {0x1.d906bcf328d46p-1, 0x1.457e610231ac2p-56}, /* 48 */
+  {0x1.ddb13b6ccc23cp-1, 0x1.83c37c6107db3p-55}, /* 49 */
+  {0x1.e212104f686e5p-1, -0x1.014c76c126527p-55}, /* 50 */
+  {0x1.e6288ec48e112p-1, -0x1.16b56f2847754p-57}, /* 51 */
+  {0x1.e9f4156c62ddap-1, 0x1.760b1e2e3f81ep-55}, /* 52 */
+  {0x1.ed740e7684963p-1, 0x1.e82c791f59cc2p-56}, /* 53 */
+  {0x1.f0a7efb9230d7p-1, 0x1.52c7adc6b4989p-56}, /* 54 */
+  {0x1.f38f3ac64e589p-1, -0x1.d7bafb51f72e6p-56}, /* 55 */
+  {0x1.f6297cff75cbp-1, 0x1.562172a361fd3p-56}, /* 56 */
+  {0x1.f8764fa714ba9p-1, 0x1.ab256778ffcb6p-56}, /* 57 */
+  {0x1.fa7557f08a517p-1, -0x1.7a0a8ca13571fp-55}, /* 58 */
+  {0x1.fc26470e19fd3p-1, 0x1.1ec8668ecaceep-55}, /* 59 */
+  {0x1.fd88da3d12526p-1, -0x1.87df6378811c7p-55}, /* 60 */
+  {0x1.fe9cdad01883ap-1, 0x1.521ecd0c67e35p-57}, /* 61 */
+  {0x1.ff621e3796d7ep-1, -0x1.c57bc2e24aa15p-57}, /* 62 */
+  {0x1.ffd886084cd0dp-1, -0x1.1354d4556e4cbp-55}, /* 63 */
+  {0x1p+0, 0x0p+0}, /* 64 */
+  {0x1.ffd886084cd0dp-1, -0x1.1354d4556e4cbp-55}, /* 65 */
+  {0x1.ff621e3796d7ep-1, -0x1.c57bc2e24aa15p-57}, /* 66 */
+  {0x1.fe9cdad01883ap-1, 0x1.521ecd0c67e35p-57}, /* 67 */
+  {0x1.fd88da3d12526p-1, -0x1.87df6378811c7p-55}, /* 68 */
+  {0x1.fc26470e19fd3p-1, 0x1.1ec8668ecaceep-55}, /* 69 */
+  {0x1.fa7557f08a517p-1, -0x1.7a0a8ca13571fp-55}, /* 70 */
+  {0x1.f8764fa714ba9p-1, 0x1.ab256778ffcb6p-56}, /* 71 */
+  {0x1.f6297cff75cbp-1, 0x1.562172a361fd3p-56}, /* 72 */
+  {0x1.f38f3ac64e589p-1, -0x1.d7bafb51f72e6p-56}, /* 73 */
+  {0x1.f0a7efb9230d7p-1, 0x1.52c7adc6b4989p-56}, /* 74 */
+  {0x1.ed740e7684963p-1, 0x1.e82c791f59cc2p-56}, /* 75 */
+  {0x1.e9f4156c62ddap-1, 0x1.760b1e2e3f81ep-55}, /* 76 */
+  {0x1.e6288ec48e112p-1, -0x1.16b56f2847754p-57}, /* 77 */
+  {0x1.e212104f686e5p-1, -0x1.014c76c126527p-55}, /* 78 */
+  {0x1.ddb13b6ccc23cp-1, 0x1.83c37c6107db3p-55}, /* 79 */
+  {0x1.d906bcf328d46p-1, 0x1.457e610231ac2p-56}, /* 80 */
+  {0x1.d4134d14dc93ap-1, -0x1.4ef5295d25af2p-55}, /* 81 */
+  {0x1.ced7af43cc773p-1, -0x1.e7b6bb5ab58aep-58}, /* 82 */
+  {0x1.c954b213411f5p-1, -0x1.2fb761e946603p-58}, /* 83 */
+  {0x1.c38b2f180bdb1p-1, -0x1.6e0b1757c8d07p-56}, /* 84 */
+  {0x1.bd7c0ac6f952ap-1, -0x1.825a732ac700ap-55}, /* 85 */
+  {0x1.b728345196e3ep-1, -0x1.bc69f324e6d61p-55}, /* 86 */
+  {0x1.b090a581502p-1, -0x1.926da300ffccep-55}, /* 87 */
+  {0x1.a9b66290ea1a3p-1, 0x1.9f630e8b6dac8p-60}, /* 88 */
+  {0x1.a29a7a0462782p-1, -0x1.128bb015df175p-56}, /* 89 */
+  {0x1.9b3e047f38741p-1, -0x1.30ee286712474p-55}, /* 90 */
+  {0x1.93a22499263fbp-1, 0x1.3d419a920df0bp-55}, /* 91 */
+  {0x1.8bc806b151741p-1, -0x1.2c5e12ed1336dp-55}, /* 92 */
+  {0x1.83b0e0bff976ep-1, -0x1.6f420f8ea3475p-56}, /* 93 */
+  {0x1.7b5df226aafafp-1, -0x1.0f537acdf0ad7p-56}, /* 94 */
+  {0x1.72d0837efff96p-1, 0x1.0d4ef0f1d915cp-55}, /* 95 */
+  {0x1.6a09e667f3bcdp-1, -0x1.bdd3413b26456p-55}, /* 96 */
+  {0x1.610b7551d2cdfp-1, -0x1.251b352ff2a37p-56}, /* 97 */
+  {0x1.57d69348cecap-1, -0x1.75720992bfbb2p-55}, /* 98 */
+  {0x1.4e6cabbe3e5e9p-1, 0x1.3c293edceb327p-57}, /* 99 */
+  {0x1.44cf325091dd6p-1, 0x1.8076a2cfdc6b3p-57}, /* 100 */
+  {0x1.3affa292050b9p-1, 0x1.e3e25e3954964p-56}, /* 101 */
+  {0x1.30ff7fce17035p-1, -0x1.efcc626f74a6fp-57}, /* 102 */
+  {0x1.26d054cdd12dfp-1, -0x1.5da743ef3770cp-55}, /* 103 */
+  {0x1.1c73b39ae68c8p-1, 0x1.b25dd267f66p-55}, /* 104 */
+  {0x1.11eb3541b4b23p-1, -0x1.ef23b69abe4f1p-55}, /* 105 */
+  {0x1.073879922ffeep-1, -0x1.a5a014347406cp-55}, /* 106 */
+  {0x1.f8ba4dbf89abap-2, -0x1.2ec1fc1b776b8p-60}, /* 107 */
+  {0x1.e2b5d3806f63bp-2, 0x1.e0d891d3c6841p-58}, /* 108 */
+  {0x1.cc66e9931c45ep-2, 0x1.6850e59c37f8fp-58}, /* 109 */
+  {0x1.b5d1009e15ccp-2, 0x1.5b362cb974183p-57}, /* 110 */
+  {0x1.9ef7943a8ed8ap-2, 0x1.6da81290bdbabp-57}, /* 111 */
+  {0x1.87de2a6aea963p-2, -0x1.72cedd3d5a61p-57}, /* 112 */
+  {0x1.7088530fa459fp-2, -0x1.44b19e0864c5dp-56}, /* 113 */
+  {0x1.58f9a75ab1fddp-2, -0x1.efdc0d58cf62p-62}, /* 114 */
+  {0x1.4135c94176601p-2, 0x1.0c97c4afa2518p-56}, /* 115 */
+  {0x1.294062ed59f06p-2, -0x1.5d28da2c4612dp-56}, /* 116 */
+  {0x1.111d262b1f677p-2, 0x1.824c20ab7aa9ap-56}, /* 117 */
+  {0x1.f19f97b215f1bp-3, -0x1.42deef11da2c4p-57}, /* 118 */
+  {0x1.c0b826a7e4f63p-3, -0x1.af1439e521935p-62}, /* 119 */
+  {0x1.8f8b83c69a60bp-3, -0x1.26d19b9ff8d82p-57}, /* 120 */
+  {0x1.5e214448b3fc6p-3, 0x1.531ff779ddac6p-57}, /* 121 */
+  {0x1.2c8106e8e613ap-3, 0x1.13000a89a11ep-58}, /* 122 */
+  {0x1.f564e56a9730ep-4, 0x1.a2704729ae56dp-59}, /* 123 */
+  {0x1.917a6bc29b42cp-4, -0x1.e2718d26ed688p-60}, /* 124 */
+  {0x1.2d52092ce19f6p-4, -0x1.9a088a8bf6b2cp-59}, /* 125 */
+  {0x1.91f65f10dd814p-5, -0x1.912bd0d569a9p-61}, /* 126 */
+  {0x1.92155f7a3667ep-6, -0x1.b1d63091a013p-64}, /* 127 */
+};
+
+static const double SGN[2] = {1.0, -1.0};
+
+/* The polynomial r*(S[0]+S[1] + r^2*(S[2]+S[3] + r^2*(S[4] + r^2*(S[5]
+   + r^2*S[6])))) is the degree-9 Taylor expansion of sin(pi*r), where the
+   coefficients of degree 1 and 3 are double-double numbers. For |r| <= 2^-8
+   its relative error is bounded by 2^-88. */
+static const double S[7] = {
+  0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53, -0x1.4abbce625be53p+2, 0x1.05511c68476a8p-52, 0x1.466bc6775aae2p+1, -0x1.32d2cce62bd86p-1, 0x1.50783487ee782p-4};
+
+/* The polynomial 1 + r^2*(C[0]+C[1] + r^2*(C[2] + r^2*(C[3] + r^2*C[4]))) is
+   the degree-8 Taylor expansion of cos(pi*r), where the coefficient of degree
+   2 is a double-double number. For |r| <= 2^-8 its relative error is bounded
+   by 2^-85. */
+static const double C[5] = {
+  -0x1.3bd3cc9be45dep+2, -0x1.692b71366cc04p-52, 0x1.03c1f081b5ac4p+2, -0x1.55d3c7e3cbffap+0, 0x1.e1f506891babbp-3};
+
+/* Given |x| < 2^52, return k = roundeven(128*x) and put in r the value
+   x - k/128, with |r| <= 2^-8. Both operations are exact, since 128*x and
+   128*x - k are exact, and x is an integer multiple of 2^-1074. No Payne-Hanek
+   reduction is needed since pi is applied after the reduction. */
+static inline int64_t
+reduce_fast (double *r, double x)
+{
+  double t = x * 128.0;
+  double k = ROUNDEVEN (t);
+  *r = (t - k) * 0x1p-7;
+  return k;
+}
+
+/* Put in (sh,sl) and (ch,cl) approximations of sin(pi*r) and cos(pi*r)
+   for |r| <= 2^-8.
+   For sin(pi*r) = r*(pi + t), the product zh*S[2] is computed exactly, and
+   the other terms of t are below 2^-30.6: counting one ulp for each of the
+   (at most 6) rounded operations on them, to cover all rounding modes, and
+   adding the Taylor error, the relative error on sh+sl is bounded by
+   2^-81.5.
+   For cos(pi*r) = 1 + c, the term zh*C[0] is computed exactly, and the other
+   terms are below 2^-29.9, thus the relative error on ch+cl is bounded by
+   6*2^-52*2^-29.9 + 2^-85 < 2^-79.3. Note that (ch,cl) is not normalized,
+   since |cl| might be as large as 2^-29.9. */
+static inline void
+sincospi_poly (double *sh, double *sl, double *ch, double *cl, double r)
+{
+  double zh, zl, th, tl, z2;
+  a_mul (&zh, &zl, r, r);
+  z2 = zh * zh;
+
+  double p = __builtin_fma (zh, S[6], S[5]);
+  p = __builtin_fma (zh, p, S[4]);
+  a_mul (&th, &tl, zh, S[2]);
+  tl += __builtin_fma (zh, S[3], __builtin_fma (zl, S[2], z2 * p));
+  fast_two_sum (sh, sl, S[0], th); /* |th| < 2^-13.6 */
+  *sl += tl + S[1];
+  a_mul (&th, &tl, *sh, r);
+  *sl = __builtin_fma (*sl, r, tl);
+  *sh = th;
+
+  p = __builtin_fma (zh, C[4], C[3]);
+  p = __builtin_fma (zh, p, C[2]);
+  a_mul (&th, &tl, zh, C[0]);
+  tl += __builtin_fma (zh, C[1], __builtin_fma (zl, C[0], z2 * p));
+  fast_two_sum (ch, cl, 1.0, th); /* |th| < 2^-13.7 */
+  *cl += tl;
+}
+
+/* Put in (h,l) an approximation of sa*A*cos(pi*r) + sb*B*sin(pi*r), where
+   A = a[0]+a[1] and B = b[0]+b[1] are entries of T[], sa and sb are +1
+   or -1, and (sh,sl) and (ch,cl) are the values computed by
+   sincospi_poly(). With A = sin(pi*k/128) and B = cos(pi*k/128) up to sign,
+   this approximates sin(pi*(k/128 + r)).
+   Either A = 0, or |A*cos(pi*r)| > 0.0245 > |B*sin(pi*r)|, thus the
+   fast_two_sum() call is valid.
+   The relative error on ah+al is bounded by 2^-79.3 (error on ch+cl)
+   + 2^-82.9 (neglected term a[1]*cl) + 2^-81.8 (rounding of al, which is
+   less than 2^-29.8*|ah|) < 2^-78.9, and the one on bh+bl by 2^-81.4.
+   The first term is less than 2 times the result (the worst case being
+   k = 1 and r = -2^-8), and the second one less than the result. The final
+   additions add at most 2*2^-52*2^-29.8*|ah| < 2^-79.8*|h|, thus the
+   relative error on h+l is bounded by 2^-77.9 + 2^-81.4 + 2^-79.8
+   < 2^-77.46. */
+static inline void
+sinpi_combine (double *h, double *l, const double *a, double sa,
+               const double *b, double sb,
+               double sh, double sl, double ch, double cl)
+{
+  double ah, al, bh, bl;
+  d_mul (&ah, &al, sa * a[0], sa * a[1], ch, cl);
+  d_mul (&bh, &bl, sb * b[0], sb * b[1], sh, sl);
+  fast_two_sum (h, l, ah, bh);
+  *l += al + bl;
+}
+
+/* Argument reduction for the accurate path.
+   Given the encoding ux of |x|, with 0 < |x| < 2^52, put in j and r values
+   such that |x| = q/2 + s*(j/128 + r) with 0 <= j <= 32, |r| <= 2^-8,
+   0 <= q <= 3 (modulo 2) and s = 1 or -1, and return q + 4*(s < 0).
+   The values j and r are exact. */
+static inline int
+reduce (int *j, double *r, uint64_t ux)
+{
+  b64u64_u t = {.u = ux};
+  int64_t k;
+  if (ux < 0x3f70000000000000) /* |x| < 2^-8 */
+  {
+    *j = 0;
+    *r = t.f;
+    return 0;
+  }
+  /* now -8 <= e <= 51 */
+  int e = (ux >> 52) - 0x3ff;
+  int64_t m = (ux & 0xfffffffffffff) | 1l << 52;
+  int s = 45 - e; /* |x| = m/2^s/128, with -6 <= s <= 53 */
+  if (s <= 0)
+  {
+    *r = 0;
+    k = m << -s;
+  }
+  else
+  {
+    k = (m + (1l << (s - 1))) >> s;
+    /* m - k*2^s has at most 53 bits */
+    t.u = (uint64_t) (e - 52 + 0x3ff) << 52;
+    *r = (double) (m - (k << s)) * t.f;
+  }
+  /* now |x| = k/128 + r */
+  int q = (k >> 6) & 3;
+  *j = k & 63;
+  if (*j <= 32)
+    return q;
+  /* |x| = (q+1)/2 - ((64-j)/128 - r) */
+  *j = 64 - *j;
+  *r = -*r;
+  return ((q + 1) & 3) + 4;
+}
+
+/* SIN[k] is (-1)^k*pi^(2k+1)/(2k+1)! rounded to 128 bits, and COS[k] is
+   (-1)^k*pi^(2k)/(2k)!. For |y| <= 1/4 + 2^-8, the truncation errors of the
+   series below, relative to sin(pi*y) and cos(pi*y), are bounded by
+   2^-131 and 2^-134. */
+static const dint64_t SIN[16] = {
+    {.hi = 0xc90fdaa22168c234, .lo = 0xc4c6628b80dc1cd1, .ex = 1, .sgn = 0x0},
+    {.hi = 0xa55de7312df295f5, .lo = 0x5dc72f712af24826, .ex = 2, .sgn = 0x1},
+    {.hi = 0xa335e33bad570e92, .lo = 0x3f34224f03d18616, .ex = 1, .sgn = 0x0},
+    {.hi = 0x9969667315ec2df3, .lo = 0x2f70bfb232e0b12b, .ex = -1, .sgn = 0x1},
+    {.hi = 0xa83c1a43f73c0dc8, .lo = 0x3d6322ef56c7a534, .ex = -4, .sgn = 0x0},
+    {.hi = 0xf183a7ef4438fb11, .lo = 0xde40761466b06704, .ex = -8, .sgn = 0x1},
+    {.hi = 0xf47a1a680c6b1994, .lo = 0x682b25712632ab96, .ex = -12, .sgn = 0x0},
+    {.hi = 0xb7d6dcf8aaba1c8a, .lo = 0x8d075e9665f35590, .ex = -16, .sgn = 0x1},
+    {.hi = 0xd5761957c99ac94f, .lo = 0xe55050e5769db93d, .ex = -21, .sgn = 0x0},
+    {.hi = 0xc5202108fcaa382d, .lo = 0xa84980c404903ad0, .ex = -26, .sgn = 0x1},
+    {.hi = 0x943b8106a9677c6c, .lo = 0x499c4cc8cb93fc42, .ex = -31, .sgn = 0x0},
+    {.hi = 0xb90afc3cf0d644ba, .lo = 0x674c07a38309c485, .ex = -37, .sgn = 0x1},
+    {.hi = 0xc2ce2ca5d22b9946, .lo = 0x446588874ebfc223, .ex = -43, .sgn = 0x0},
+    {.hi = 0xaf48d5624946d592, .lo = 0x2f9dca062d383208, .ex = -49, .sgn = 0x1},
+    {.hi = 0x885a921712b65fba, .lo = 0x70a446fb80537f4b, .ex = -55, .sgn = 0x0},
+    {.hi = 0xb938fc938d698855, .lo = 0x22fe5e135dead130, .ex = -62, .sgn = 0x1},
+};
+
+static const dint64_t COS[17] = {
+    {.hi = 0x8000000000000000, .lo = 0x0000000000000000, .ex = 0, .sgn = 0x0},
+    {.hi = 0x9de9e64df22ef2d2, .lo = 0x56e26cd9808c1ac7, .ex = 2, .sgn = 0x1},
+    {.hi = 0x81e0f840dad61d9a, .lo = 0x9980f007d76d129c, .ex = 2, .sgn = 0x0},
+    {.hi = 0xaae9e3f1e5ffcfe2, .lo = 0xa7d6df6c89dad8bf, .ex = 0, .sgn = 0x1},
+    {.hi = 0xf0fa83448dd5d7a3, .lo = 0x2742da8fda4be80e, .ex = -3, .sgn = 0x0},
+    {.hi = 0xd368f95102545d4d, .lo = 0x3db9bb12413d1e67, .ex = -6, .sgn = 0x1},
+    {.hi = 0xfce9c51bb1e6146e, .lo = 0xbd66e85287648b8c, .ex = -10, .sgn = 0x0},
+    {.hi = 0xdb7127a25894796d, .lo = 0xe1e0a0c23b8f9662, .ex = -14, .sgn = 0x1},
+    {.hi = 0x9063161796bfa54b, .lo = 0x865cbdc70bcd34a2, .ex = -18, .sgn = 0x0},
+    {.hi = 0x95062c8d7c18a242, .lo = 0xb0075f7abef5f9a3, .ex = -23, .sgn = 0x1},
+    {.hi = 0xf7b71846b68e1c74, .lo = 0x1110c08456f0b70e, .ex = -29, .sgn = 0x0},
+    {.hi = 0xa95720907ef13512, .lo = 0x45b7064dffcbdc45, .ex = -34, .sgn = 0x1},
+    {.hi = 0xc1c6c7a190bfff5d, .lo = 0x64bf8c054d3b7a9e, .ex = -40, .sgn = 0x0},
+    {.hi = 0xbc4eb315daa41020, .lo = 0x3ae15c333608f8fb, .ex = -46, .sgn = 0x1},
+    {.hi = 0x9d55c2dd611b2649, .lo = 0xe7254d9a56f84799, .ex = -52, .sgn = 0x0},
+    {.hi = 0xe47685405686186d, .lo = 0x3bb7e86b70548387, .ex = -59, .sgn = 0x1},
+    {.hi = 0x917936d67bfec53e, .lo = 0x2edde1c79a0ea8e0, .ex = -65, .sgn = 0x0},
+};
+
+// Convert a double to the corresponding dint64_t value, for b <> 0
+static inline void
+dint_fromd (dint64_t *a, double b)
+{
+  b64u64_u x = {.f = b};
+  a->ex = (x.u >> 52) & 0x7ff;
+  a->hi = (x.u & 0xfffffffffffff) + (a->ex ? (1ul << 52) : 0);
+  a->ex -= 0x3ff;
+  uint32_t t = __builtin_clzl (a->hi);
+  a->sgn = b < 0.0;
+  a->hi = a->hi << t;
+  a->ex = a->ex - (t > 11 ? t - 12 : 0);
+  a->lo = 0;
+}
+
+/* Put in r the value a + b*r, where |a| > |b*r|, neglecting b*r when it is
+   less than 2^-127*|a| (add_dint() requires an exponent difference less
+   than 128). */
+static inline void
+fma_dint (dint64_t *r, const dint64_t *a, const dint64_t *b)
+{
+  mul_dint (r, b, r);
+  if (r->hi && r->ex > a->ex - 127)
+    add_dint (r, a, r);
+  else
+    cp_dint (r, a);
+}
+
+/* Put in S and C approximations of sin(pi*y) and cos(pi*y) for
+   y = j/128 + r, with 0 <= j <= 32, |r| <= 2^-8 and y <> 0, with relative
+   error about 2^-124. */
+static void
+sincospi_accurate (dint64_t *S, dint64_t *C, int j, double r)
+{
+  dint64_t Y, T;
+
+  /* y = j/128 + r is exact in dint64_t since r is an integer multiple of
+     2^-60 when j <> 0 */
+  if (j == 0)
+    dint_fromd (&Y, r);
+  else
+  {
+    dint_fromd (&Y, (double) j * 0x1p-7);
+    if (r != 0)
+    {
+      dint_fromd (&T, r);
+      add_dint (&Y, &Y, &T);
+    }
+  }
+  mul_dint (&T, &Y, &Y);
+  cp_dint (S, &SIN[15]);
+  for (int k = 14; k >= 0; k--)
+    fma_dint (S, &SIN[k], &T);
+  mul_dint (S, S, &Y);
+  cp_dint (C, &COS[16]);
+  for (int k = 15; k >= 0; k--)
+    fma_dint (C, &COS[k], &T);
+}
+
+/* Convert a dint64_t value to a double, rounding according to the current
+   rounding mode. The result might be subnormal. */
+static inline double
+dint_tod (dint64_t *a)
+{
+  if (a->ex < -1022)
+  {
+    /* a = N*2^-1074 + ..., where N = hi >> s */
+    int64_t s = -1011 - a->ex;
+    uint64_t N, rb, st;
+    if (s < 64)
+    {
+      N = a->hi >> s;
+      rb = (a->hi >> (s - 1)) & 1;
+      st = (a->hi << (65 - s)) || a->lo;
+    }
+    else
+    {
+      N = 0;
+      rb = s == 64;
+      st = s > 64 || (a->hi << 1) || a->lo;
+    }
+    /* 2^52 + N has ulp 1, thus adding rd rounds to an integer
+       with the current rounding mode */
+    double rd = (rb ? 0.5 : 0.0) + (st ? 0.25 : 0.0);
+    double T = 0x1p52 + (double) N;
+    if (a->sgn)
+      T = (-T - rd) + 0x1p52;
+    else
+      T = (T + rd) - 0x1p52;
+    /* avoid a wrong sign when the result is zero */
+    T = __builtin_copysign (T, a->sgn ? -1.0 : 1.0);
+    return T * 0x1p-1074;
+  }
+
+  b64u64_u r = {.u = (a->hi >> 11) | (0x3ffl << 52)};
+  /* r contains the upper 53 bits of a->hi, 1 <= r < 2 */
+
+  double rd = 0.0;
+  /* if round bit is 1, add 2^-53 */
+  if ((a->hi >> 10) & 0x1)
+    rd += 0x1p-53;
+
+  /* if trailing bits after the rounding bit are non zero, add 2^-54 */
+  if (a->hi & 0x3ff || a->lo)
+    rd += 0x1p-54;
+
+  r.u = r.u | a->sgn << 63;
+  r.f += (a->sgn == 0) ? rd : -rd;
+
+  /* here |a| < 2^54, thus we cannot have a->ex > 1023 */
+  b64u64_u e = {.u = ((a->ex + 1023) & 0x7ff) << 52};
+
+  return r.f * e.f;
+}
+
+/* Given o = q + 4*(s < 0) returned by reduce(), where |x| = q/2 + s*y,
+   return 1 when sin(pi*|x|) = -sin(pi*y) or -cos(pi*y), since
+   sin(pi*(q/2 + s*y)) is s*sin(pi*y), cos(pi*y), -s*sin(pi*y), -cos(pi*y)
+   for q = 0, 1, 2, 3. */
+static inline int
+sinpi_neg (int o)
+{
+  int neg = (o >> 1) & 1;
+  if (!(o & 1))
+    neg ^= o >> 2;
+  return neg;
+}
+
+static double __attribute__((noinline))
+cr_sinpi_accurate (double x)
+{
+  b64u64_u t = {.f = x};
+  int j;
+  double r;
+  dint64_t S, C;
+  int o = reduce (&j, &r, t.u & 0x7fffffffffffffff);
+  sincospi_accurate (&S, &C, j, r);
+  dint64_t *R = (o & 1) ? &C : &S;
+  R->sgn ^= sinpi_neg (o) ^ (x < 0);
+  return dint_tod (R);
+}
+
+/* the rounding test for tiny x, where sin(pi*x) = pi*x*(1 - (pi*x)^2/6
+   + ...) and (pi*x)^2/6 < 2^-1932: we scale x by 2^106, and use the same
+   trick as in exp.c to get a correct rounding, since the result might be
+   subnormal. Returns 0 when the rounding test fails. */
+static inline double
+tiny_pi_x (double x)
+{
+  double X = x * 0x1p106, h, l;
+  a_mul (&h, &l, X, S[0]);
+  l = __builtin_fma (X, S[1], l);
+  double err = __builtin_fabs (h) * 0x1p-104;
+  double vd = h * 0x1p-106, vdl = (h - vd * 0x1p106) + l;
+  double fp = __builtin_fma (0x1p-106, vdl + err, vd);
+  double fm = __builtin_fma (0x1p-106, vdl - err, vd);
+  return (fp == fm) ? fp : 0;
+}
+
+double
+cr_sinpi (double x)
+{
+  b64u64_u t = {.f = x};
+  uint64_t ux = t.u & 0x7fffffffffffffff;
+
+  if (__builtin_expect (ux >= 0x4330000000000000, 0)) /* |x| >= 2^52 */
+  {
+    if (ux >= 0x7ff0000000000000)
+    {
+      if (ux == 0x7ff0000000000000) /* +/-Inf */
+      {
+        errno = EDOM;
+        feraiseexcept (FE_INVALID);
+        return __builtin_nan ("inf");
+      }
+      return x + x; /* NaN */
+    }
+    /* x is an integer */
+    return __builtin_copysign (0.0, x);
+  }
+
+  if (__builtin_expect (ux < 0x0370000000000000, 0)) /* |x| < 2^-968 */
+  {
+    if (x == 0)
+      return x;
+    double y = tiny_pi_x (x);
+    return (y != 0) ? y : cr_sinpi_accurate (x);
+  }
+
+  double r, sh, sl, ch, cl, h, l;
+  int64_t k = reduce_fast (&r, x);
+  int m = k & 255;
+  if (__builtin_expect (r == 0 && !(m & 63), 0))
+  {
+    /* x is an integer multiple of 1/2 */
+    if (!(m & 64))
+      return __builtin_copysign (0.0, x);
+    return (m & 128) ? -1.0 : 1.0;
+  }
+  sincospi_poly (&sh, &sl, &ch, &cl, r);
+  /* sin(pi*x) = sin(pi*k/128)*cos(pi*r) + cos(pi*k/128)*sin(pi*r) */
+  sinpi_combine (&h, &l, T[m & 127], SGN[m >> 7],
+                 T[(m + 64) & 127], SGN[((m + 64) >> 7) & 1], sh, sl, ch, cl);
+
+  double err = __builtin_fabs (h) * 0x1.8p-78; /* 2^-77.46 < 0x1.8p-78 */
+  double left = h + (l - err), right = h + (l + err);
+  if (left == right)
+    return left;
+  return cr_sinpi_accurate (x);
+}
+
+/* Same as cospi_neg() in cospi.c. */
+static inline int
+cospi_neg (int o)
+{
+  if (!(o & 1))
+    return (o >> 1) & 1;
+  return ((o >> 1) & 1) ^ 1 ^ (o >> 2);
+}
+
+/* Put in *s and *c the values sinpi(x) and cospi(x), both correctly rounded.
+   The argument reduction and the polynomial evaluation are shared, and the
+   accurate path is called at most once. */
+void
+cr_sincospi (double x, double *s, double *c)
+{
+  b64u64_u t = {.f = x};
+  uint64_t ux = t.u & 0x7fffffffffffffff;
+
+  if (__builtin_expect (ux >= 0x4330000000000000 || ux < 0x3e20000000000000,
+                        0)) /* |x| >= 2^52 or |x| < 2^-29 */
+  {
+    *s = cr_sinpi (x);
+    if (ux >= 0x7ff0000000000000) /* NaN or Inf */
+      *c = *s;
+    else if (ux >= 0x4330000000000000) /* even integer for |x| >= 2^53 */
+      *c = (ux < 0x4340000000000000 && (ux & 1)) ? -1.0 : 1.0;
+    else /* see cr_cospi() */
+      *c = (x == 0) ? 1.0 : 1.0 - 0x1p-55;
+    return;
+  }
+
+  double r, sh, sl, ch, cl, h, l;
+  int64_t k = reduce_fast (&r, x);
+  int m = k & 255;
+  if (__builtin_expect (r == 0 && !(m & 63), 0))
+  {
+    /* x is an integer multiple of 1/2 */
+    if (!(m & 64))
+    {
+      *s = __builtin_copysign (0.0, x);
+      *c = (m & 128) ? -1.0 : 1.0;
+    }
+    else
+    {
+      *s = (m & 128) ? -1.0 : 1.0;
+      *c = 0.0;
+    }
+    return;
+  }
+  sincospi_poly (&sh, &sl, &ch, &cl, r);
+  /* A = sin(pi*k/128) and B = cos(pi*k/128), up to the signs sa and sb */
+  const double *a = T[m & 127], *b = T[(m + 64) & 127];
+  double sa = SGN[m >> 7], sb = SGN[((m + 64) >> 7) & 1];
+
+  /* sin(pi*x) = A*cos(pi*r) + B*sin(pi*r) */
+  sinpi_combine (&h, &l, a, sa, b, sb, sh, sl, ch, cl);
+  double err = __builtin_fabs (h) * 0x1.8p-78;
+  double left = h + (l - err), right = h + (l + err);
+  int ok = left == right;
+  *s = left;
+
+  /* cos(pi*x) = B*cos(pi*r) - A*sin(pi*r) */
+  sinpi_combine (&h, &l, b, sb, a, -sa, sh, sl, ch, cl);
+  err = __builtin_fabs (h) * 0x1.8p-78;
+  left = h + (l - err);
+  right = h + (l + err);
+  *c = left;
+  if (__builtin_expect (ok && left == right, 1))
+    return;
+
+  /* accurate path, with the reduction to [0,1/4] */
+  int j, o = reduce (&j, &r, ux);
+  dint64_t S, C;
+  sincospi_accurate (&S, &C, j, r);
+  dint64_t *R = (o & 1) ? &C : &S;
+  R->sgn ^= sinpi_neg (o) ^ (x < 0);
+  *s = dint_tod (R);
+  R = (o & 1) ? &S : &C;
+  R->sgn ^= cospi_neg (o);
+  *c = dint_tod (R);
+}
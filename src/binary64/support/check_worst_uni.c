@@ -32,6 +32,7 @@ SOFTWARE.
 #include <stdint.h>
 #include <string.h>
 #include <fenv.h>
+#include <unistd.h>
 #include <omp.h>
 
 #include "function_under_test.h"
@@ -89,36 +90,134 @@ asuint64 (double f)
   return u.i;
 }
 
+/* With DO_NOT_ABORT, each thread records its failures in its own buffer,
+   without lock nor output in the parallel loop: the inputs are checked by
+   blocks of BLOCK, and after each block the buffers are merged and printed
+   in the order of the input, and the progress line is updated (if stderr is
+   a terminal). */
+#define BLOCK 65536
+
+typedef struct { int i; double z1, z2; } failure_t;
+
+typedef struct {
+  failure_t *fail;
+  size_t count, size;
+} __attribute__((aligned(64))) thread_log_t; /* one per cache line */
+
+static thread_log_t *logs;
+static int nthreads;
+
+/* failures by sign and biased exponent of x (0 for subnormals) */
+static int binade_failures[2][2048];
+
+static int
+cmp_failure (const void *a, const void *b)
+{
+  int i = ((const failure_t *) a)->i, j = ((const failure_t *) b)->i;
+  return (i > j) - (i < j);
+}
+
+/* print the failures of the threads, empty their buffers, and return their
+   number */
+static int
+flush_failures (const double *items)
+{
+  size_t count = 0;
+  for (int t = 0; t < nthreads; t++)
+    count += logs[t].count;
+  failure_t *all = malloc(count * sizeof(failure_t) + 1);
+  if (all == NULL) {
+    fprintf(stderr, "malloc failed\n");
+    exit(1);
+  }
+  count = 0;
+  for (int t = 0; t < nthreads; t++) {
+    memcpy(all + count, logs[t].fail, logs[t].count * sizeof(failure_t));
+    count += logs[t].count;
+    logs[t].count = 0;
+  }
+  qsort(all, count, sizeof(failure_t), cmp_failure);
+  for (size_t k = 0; k < count; k++) {
+    uint64_t n = asuint64 (items[all[k].i]);
+    printf("FAIL x=%la ref=%la z=%la\n", items[all[k].i], all[k].z1, all[k].z2);
+    binade_failures[n >> 63][(n >> 52) & 0x7ff] ++;
+  }
+  fflush(stdout);
+  free(all);
+  return count;
+}
+
 void
 doloop(void)
 {
   double *items;
   int count, failures = 0;
+  int progress = isatty(2);
+  double t0 = omp_get_wtime();
 
   readstdin(&items, &count);
+  nthreads = omp_get_max_threads();
+  logs = aligned_alloc(64, nthreads * sizeof(thread_log_t));
+  if (logs == NULL) {
+    fprintf(stderr, "malloc failed\n");
+    exit(1);
+  }
+  memset(logs, 0, nthreads * sizeof(thread_log_t));
 
-#pragma omp parallel for reduction(+: failures)
-  for (int i = 0; i < count; i++) {
-    double x = items[i];
-    ref_init();
-    ref_fesetround(rnd);
-    double z1 = ref_function_under_test(x);
-    fesetround(rnd1[rnd]);
-    double z2 = cr_function_under_test(x);
-    /* Note: the test z1 != z2 would not distinguish +0 and -0. */
-    if (asuint64 (z1) != asuint64 (z2)) {
-      printf("FAIL x=%la ref=%la z=%la\n", x, z1, z2);
-      fflush(stdout);
+  for (int i0 = 0; i0 < count; i0 += BLOCK) {
+    int i1 = count - i0 < BLOCK ? count : i0 + BLOCK;
+#pragma omp parallel for
+    for (int i = i0; i < i1; i++) {
+      double x = items[i];
+      ref_init();
+      ref_fesetround(rnd);
+      double z1 = ref_function_under_test(x);
+      fesetround(rnd1[rnd]);
+      double z2 = cr_function_under_test(x);
+      /* Note: the test z1 != z2 would not distinguish +0 and -0. */
+      if (asuint64 (z1) != asuint64 (z2)) {
 #ifdef DO_NOT_ABORT
-      failures ++;
+        thread_log_t *l = logs + omp_get_thread_num();
+        if (l->count == l->size) {
+          l->size = l->size ? 2 * l->size : 1024;
+          l->fail = realloc(l->fail, l->size * sizeof(failure_t));
+          if (l->fail == NULL) {
+            fprintf(stderr, "realloc failed\n");
+            exit(1);
+          }
+        }
+        l->fail[l->count++] = (failure_t) {i, z1, z2};
 #else
-      exit(1);
+        printf("FAIL x=%la ref=%la z=%la\n", x, z1, z2);
+        fflush(stdout);
+        exit(1);
 #endif
+      }
+    }
+    failures += flush_failures(items);
+    if (progress) {
+      double t = omp_get_wtime() - t0, eta = t * (count - i1) / i1;
+      fprintf(stderr, "\r%5.1f%% %d input(s), %.3g/s, %d failure(s), ETA %lu:%02lu:%02lu ",
+              100.0 * i1 / count, i1, t > 0 ? i1 / t : 0.0, failures,
+              (unsigned long) eta / 3600, (unsigned long) eta / 60 % 60,
+              (unsigned long) eta % 60);
     }
   }
+  if (progress && count > 0)
+    fprintf(stderr, "\n");
 
   free(items);
   printf("%d tests passed, %d failure(s)\n", count, failures);
+  /* the failures by binade */
+  for (int s = 0; s < 2; s++)
+    for (int e = 0; e < 2048; e++)
+      if (binade_failures[s][e]) {
+        if (e == 0)
+          printf("  %ssubnormal: %d\n", s ? "-" : "", binade_failures[s][e]);
+        else
+          printf("  %s[2^%d,2^%d): %d\n", s ? "-" : "", e - 1023, e - 1022,
+                 binade_failures[s][e]);
+      }
 }
 
 int
@@ -8,8 +8,36 @@ int ref_fesetround(int rounding_mode)
   return 0;
 }
 
+/* The checkers call ref_init() before each input, but the exponent range
+   of MPFR is per thread, and the references restore it when they change
+   it: thus it is only set at the first call in each thread. */
 void ref_init(void)
 {
-  mpfr_set_emin (-1073);
-  mpfr_set_emax (1024);
+  static _Thread_local int done = 0;
+  if (!done)
+  {
+    mpfr_set_emin (-1073);
+    mpfr_set_emax (1024);
+    done = 1;
+  }
+}
+
+/* Rather than mpfr_init2() and mpfr_clear() at each call, the references
+   take their variables with ref_var(i, prec): the i-th variable of the
+   calling thread (0 <= i < REF_NVARS), with precision prec, and an
+   undefined value.  It is allocated at the first call, and kept for the
+   next ones. */
+#define REF_NVARS 4
+
+static inline mpfr_ptr
+ref_var (int i, mpfr_prec_t prec)
+{
+  static _Thread_local mpfr_t v[REF_NVARS];
+  static _Thread_local mpfr_prec_t p[REF_NVARS]; /* 0 if not allocated */
+  if (p[i] == 0)
+    mpfr_init2 (v[i], prec);
+  else if (p[i] != prec)
+    mpfr_set_prec (v[i], prec);
+  p[i] = prec;
+  return v[i];
 }
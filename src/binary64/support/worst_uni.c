@@ -0,0 +1,920 @@
+/* Search of worst cases of univariate binary64 functions.
+
+Copyright (c) 2022 Paul Zimmermann, Inria.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+Example (in the directory of a function, for example src/binary64/exp):
+
+make worst CFLAGS="-O3 -march=native"
+./worst -m 45 -xmin 0x1p0 -xmax 0x1.fffffffffffffp+0 -o exp.new.wc -checkpoint exp.ckpt
+
+looks for the binary64 inputs 1 <= x <= 0x1.fffffffffffffp+0 such that exp(x)
+has at least 45 identical bits after the round bit, i.e., is at distance less
+than 2^-45 half-ulp from a binary64 number or the middle of two consecutive
+binary64 numbers, for all rounding modes.  The function is FUNCTION_UNDER_TEST
+(given by the Makefile), or that of -f name.  Each input found is appended to
+the file given by -o (default: standard output) as "x # k", where k is its
+number of identical bits: this is the format of the .wc files read by
+check_worst (the comment is ignored).  The exact cases are only counted.
+
+The range [xmin,xmax] (xmin and xmax should have the same sign) is split into
+its binades, and each binade into units of 2^t consecutive inputs (-t t,
+default 28), that are distributed dynamically to the OpenMP threads.  With
+-checkpoint file, the units done are saved in file every minute and at the
+end, and a run with the same command line goes on where it stopped (the
+inputs found in the units being processed when it was interrupted might be
+printed twice, use sort -u).
+
+Instead of the lattice reduction of BaCSeL (SLZ), which would need an
+external library, this is Lefèvre's algorithm.  On each unit, let
+V(x) = f(x)*2^(54-E), where 2^(E-1) <= |f(x)| < 2^E, so that the breakpoints
+for the rounding of f(x) (the binary64 numbers and the midpoints) are the
+integers; V is approximated, as a function of the integer i = x/ulp(x), by a
+polynomial P of degree d (-d d, default 5) interpolating V at Chebyshev
+points, the interpolation error being estimated by the term of degree d of P
+(this is a heuristic, not a proof).  The unit is split in halves until it is
+small enough.  Then P is evaluated at every N-th input (N = 2^n at most, -n
+n, default 15) with difference tables on 128-bit integers, together with
+P'/1! and P''/2!, and on each subinterval of N inputs, the candidates are
+the k such that the linear approximation v0 + v1*k of V is at distance at
+most delta from an integer, where delta bounds the distance required (2^-m),
+the quadratic and higher terms, and the errors: whether there is such a k is
+decided in O(log N) operations by the algorithm of the minimum of a linear
+function modulo 1 (see exists_below).  A subinterval with candidates is
+split in halves (where the quadratic term is four times smaller), and the
+remaining candidates are checked with MPFR.  With -v, the progress is
+printed on stderr.
+
+To compile: make worst CFLAGS="-O3 -march=native"
+*/
+
+#define _POSIX_C_SOURCE 200809L  /* for getline */
+
+#include <sys/types.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <assert.h>
+#include <gmp.h>
+#include <mpfr.h>
+#include <omp.h>
+
+typedef unsigned __int128 u128;
+typedef __int128 i128;
+
+/* the values of V and of its differences are stored on 128-bit integers,
+   with FRAC fractional bits (thus modulo 2^(128-FRAC)) */
+#define FRAC 124
+
+/* number of bits of the fractional parts used by exists_below() */
+#define WBITS 100
+
+/* maximal degree */
+#define DMAX 8
+
+/* precision of the interpolation */
+#define PREC 320
+
+/* units smaller than this are checked input by input with MPFR */
+#define DIRECT 64
+
+typedef int (*mpfr_fun_t) (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+
+static const struct
+{
+  const char *name;
+  mpfr_fun_t f;
+} functions[] = {
+  { "acos", mpfr_acos }, { "acosh", mpfr_acosh }, { "asin", mpfr_asin },
+  { "asinh", mpfr_asinh }, { "atan", mpfr_atan }, { "atanh", mpfr_atanh },
+  { "cbrt", mpfr_cbrt }, { "cos", mpfr_cos }, { "cosh", mpfr_cosh },
+  { "erf", mpfr_erf }, { "erfc", mpfr_erfc }, { "exp", mpfr_exp },
+  { "exp2", mpfr_exp2 }, { "exp10", mpfr_exp10 }, { "expm1", mpfr_expm1 },
+  { "lgamma", mpfr_lngamma }, { "log", mpfr_log }, { "log2", mpfr_log2 },
+  { "log10", mpfr_log10 }, { "log1p", mpfr_log1p },
+  { "rsqrt", mpfr_rec_sqrt }, { "sin", mpfr_sin }, { "sinh", mpfr_sinh },
+  { "tan", mpfr_tan }, { "tanh", mpfr_tanh }, { "tgamma", mpfr_gamma },
+#if MPFR_VERSION >= MPFR_VERSION_NUM(4,2,0)
+  { "acospi", mpfr_acospi }, { "asinpi", mpfr_asinpi },
+  { "atanpi", mpfr_atanpi }, { "cospi", mpfr_cospi },
+  { "exp2m1", mpfr_exp2m1 }, { "exp10m1", mpfr_exp10m1 },
+  { "log2p1", mpfr_log2p1 }, { "log10p1", mpfr_log10p1 },
+  { "sinpi", mpfr_sinpi }, { "tanpi", mpfr_tanpi },
+#endif
+};
+
+static const char *fname;
+static mpfr_fun_t mpfr_f;
+
+/* the options */
+static int target_m = 45;       /* number of identical bits after round bit */
+static int degree = 5;          /* degree of the interpolation polynomial */
+static int t_log = 28;          /* log2 of the size of the units */
+static int n_log = 15;          /* log2 of the size of the subintervals */
+static double Xmin, Xmax;
+static int xmin_set, xmax_set;
+static const char *out_file, *ckpt_file;
+static int verbose;
+
+static FILE *out;
+
+/* the statistics */
+static unsigned long nsols, nexact;
+static unsigned long npieces;   /* number of interpolation polynomials */
+static unsigned long ntests;    /* number of calls to exists_below() */
+static unsigned long nchecks;   /* number of inputs checked with MPFR */
+
+/* The inputs are s*i*2^q for lo <= i <= hi, in each binade. */
+typedef struct
+{
+  int q;
+  uint64_t lo, hi;
+  uint64_t first;               /* index of its first unit */
+} binade_t;
+
+static int sign;                /* sign of the inputs (1 or -1) */
+static binade_t *binades;
+static int nbinades;
+static uint64_t nunits;
+
+/* the units done, for the checkpoints */
+static unsigned char *done;
+static char *args;              /* the command line */
+
+/* the MPFR variables of each thread */
+typedef struct
+{
+  mpfr_t x, y, u, v;
+  mpfr_t t[DMAX + 1], a[DMAX + 1], c[DMAX + 1], w[DMAX + 1];
+  mpz_t z;
+} ctx_t;
+
+/* a polynomial approximation of V on the inputs i0 <= i < i0 + len,
+   with the difference tables for i0 + j*N */
+typedef struct
+{
+  const binade_t *b;
+  uint64_t i0, len, N, J;
+  int E;
+  u128 d0[DMAX + 1], d1[DMAX], d2[DMAX - 1];
+  double p3;    /* bound on |P'''|/3! */
+  double base;  /* 2^-m plus the errors, except the terms of degree >= 2 */
+} piece_t;
+
+static void
+ctx_init (ctx_t *c)
+{
+  mpfr_inits2 (PREC, c->x, c->y, c->u, c->v, (mpfr_ptr) 0);
+  for (int k = 0; k <= DMAX; k++)
+    mpfr_inits2 (PREC, c->t[k], c->a[k], c->c[k], c->w[k], (mpfr_ptr) 0);
+  mpz_init (c->z);
+}
+
+static void
+ctx_clear (ctx_t *c)
+{
+  mpfr_clears (c->x, c->y, c->u, c->v, (mpfr_ptr) 0);
+  for (int k = 0; k <= DMAX; k++)
+    mpfr_clears (c->t[k], c->a[k], c->c[k], c->w[k], (mpfr_ptr) 0);
+  mpz_clear (c->z);
+  mpfr_free_cache ();
+}
+
+/* set x to s*i*2^q */
+static void
+set_input (mpfr_t x, uint64_t i, int q)
+{
+  mpfr_set_uj_2exp (x, i, q, MPFR_RNDN);
+  if (sign < 0)
+    mpfr_neg (x, x, MPFR_RNDN);
+}
+
+/* the exponent E of V for y = f(x): the binary64 numbers with exponent
+   E <= -1021 (subnormal or not) have the same ulp */
+static int
+get_scale (mpfr_t y)
+{
+  if (!mpfr_regular_p (y) || mpfr_get_exp (y) > 1024)
+    return INT_MIN;
+  mpfr_exp_t e = mpfr_get_exp (y);
+  return (e < -1021) ? -1021 : e;
+}
+
+/* If (a*k + b) mod m < T for some 0 <= k < n, return non-zero, otherwise
+   return 0, where 0 <= a, b < m.  The values a*k + b mod m are considered
+   by runs where they increase (if 2a <= m) or decrease (otherwise): then
+   only the first value (if increasing) or the last value (if decreasing) of
+   each run can be the minimum, and these values form again a linear
+   sequence, modulo a or m - a. */
+static int
+exists_below (u128 n, u128 m, u128 a, u128 b, u128 T)
+{
+  while (1)
+  {
+    if (b < T)
+      return 1;
+    if (n <= 1 || a == 0)
+      return 0;
+    if (2 * a <= m)
+    {
+      /* the runs start at the k where a*k + b wraps around m, with values
+         (b - j*m) mod a for the j-th run */
+      u128 K = (a * (n - 1) + b) / m;
+      if (K == 0)
+        return 0;
+      u128 a2 = (a - m % a) % a;
+      b = (b % a + a2) % a;
+      n = K;
+      m = a;
+      a = a2;
+    }
+    else
+    {
+      /* with c = m - a, the values are b - c*k mod m: each run ends just
+         before a wrap around, with values (b + j*m) mod c */
+      u128 c = m - a;
+      if ((a * (n - 1) + b) % m < T)
+        return 1;
+      u128 cn = c * (n - 1);
+      if (cn <= b)
+        return 0;
+      n = (cn - b + m - 1) / m;
+      a = m % c;
+      b = b % c;
+      m = c;
+    }
+  }
+}
+
+/* return the fixed-point value of x >= 0 (with 128 fractional bits),
+   rounded up */
+static u128
+fix128 (double x)
+{
+  return ((u128) ldexp (x, 64) << 64) + ((u128) 1 << 64);
+}
+
+static double
+to_double (u128 v)
+{
+  return ldexp ((double) (i128) v, -FRAC);
+}
+
+/* v <- round(u*2^FRAC) mod 2^128 */
+static u128
+to_fixed (ctx_t *c, mpfr_t u)
+{
+  mpfr_mul_2si (c->v, u, FRAC, MPFR_RNDN);
+  mpfr_get_z (c->z, c->v, MPFR_RNDN);
+  mpz_fdiv_r_2exp (c->z, c->z, 128);
+  assert (GMP_NUMB_BITS == 64);
+  return ((u128) mpz_getlimbn (c->z, 1) << 64) | mpz_getlimbn (c->z, 0);
+}
+
+static void
+print_sol (double x, int k)
+{
+#pragma omp critical(print)
+  {
+    fprintf (out, "%a # %d\n", x, k);
+    fflush (out);
+  }
+#pragma omp atomic
+  nsols++;
+}
+
+/* check s*i*2^q with MPFR, and print it if f has at least target_m
+   identical bits after the round bit */
+static void
+check_input (ctx_t *c, const binade_t *b, uint64_t i)
+{
+  mpfr_prec_t p = 2 * target_m + 128;
+  mpfr_t y, v;
+  mpfr_inits2 (p, y, v, (mpfr_ptr) 0);
+  set_input (c->x, i, b->q);
+  while (1)
+  {
+    int inex = mpfr_f (y, c->x, MPFR_RNDN);
+    int E = get_scale (y);
+    if (E == INT_MIN)
+      break;
+    mpfr_mul_2si (v, y, 54 - E, MPFR_RNDN); /* exact */
+    mpfr_frac (v, v, MPFR_RNDN);            /* exact */
+    mpfr_abs (v, v, MPFR_RNDN);
+    if (mpfr_cmp_ui_2exp (v, 1, -1) > 0)
+      mpfr_ui_sub (v, 1, v, MPFR_RNDN);     /* exact */
+    /* the error on V is at most 2^(53-p) */
+    if (mpfr_zero_p (v) && inex == 0)
+    {
+#pragma omp atomic
+      nexact++;
+      break;
+    }
+    if (!mpfr_zero_p (v) && mpfr_get_exp (v) > 56 - p)
+    {
+      int k = -mpfr_get_exp (v);
+      if (k >= target_m)
+        print_sol (mpfr_get_d (c->x, MPFR_RNDN), k);
+      break;
+    }
+    p *= 2;
+    mpfr_set_prec (y, p);
+    mpfr_set_prec (v, p);
+  }
+  mpfr_clears (y, v, (mpfr_ptr) 0);
+#pragma omp atomic
+  nchecks++;
+}
+
+static void
+check_direct (ctx_t *c, const binade_t *b, uint64_t i0, uint64_t len)
+{
+  for (uint64_t i = i0; i < i0 + len; i++)
+    check_input (c, b, i);
+}
+
+/* set res to P(t), where P has coefficients c[0..d] */
+static void
+horner (mpfr_t res, mpfr_t *c, int d, mpfr_t t)
+{
+  mpfr_set (res, c[d], MPFR_RNDN);
+  for (int r = d - 1; r >= 0; r--)
+  {
+    mpfr_mul (res, res, t, MPFR_RNDN);
+    mpfr_add (res, res, c[r], MPFR_RNDN);
+  }
+}
+
+/* set tab[0..d] to the forward differences, with step N, of the polynomial
+   of coefficients c[0..d] at 0 */
+static void
+init_table (ctx_t *c, u128 *tab, mpfr_t *coef, int d, uint64_t N)
+{
+  for (int j = 0; j <= d; j++)
+  {
+    mpfr_set_ui (c->u, j, MPFR_RNDN);
+    mpfr_mul_ui (c->u, c->u, N, MPFR_RNDN);
+    horner (c->w[j], coef, d, c->u);
+  }
+  for (int j = 1; j <= d; j++)
+    for (int k = d; k >= j; k--)
+      mpfr_sub (c->w[k], c->w[k], c->w[k - 1], MPFR_RNDN);
+  for (int j = 0; j <= d; j++)
+    tab[j] = to_fixed (c, c->w[j]);
+}
+
+/* return sum(binomial(J,k), k=0..d), an upper bound on the factor by which
+   the error on the initial differences of a table of degree d can be
+   multiplied after J steps */
+static double
+table_error (double J, int d)
+{
+  double s = 1, t = 1;
+  for (int k = 1; k <= d; k++)
+  {
+    t = t * (J - k + 1) / k;
+    s += t;
+  }
+  return s;
+}
+
+/* Compute the polynomial approximation of V on [i0,i0+len), and its
+   difference tables.  Return 0 if it is not good enough (then p should be
+   split). */
+static int
+init_piece (ctx_t *c, piece_t *p)
+{
+  const binade_t *b = p->b;
+  int d = degree;
+  double L = p->len - 1;
+
+  set_input (c->x, p->i0 + p->len / 2, b->q);
+  mpfr_f (c->y, c->x, MPFR_RNDZ);
+  p->E = get_scale (c->y);
+  if (p->E == INT_MIN)
+    return 0;
+
+  /* interpolate V at the Chebyshev points t[k] (in terms of i - i0),
+     with divided differences a[k] */
+  for (int k = 0; k <= d; k++)
+  {
+    double t = L / 2 * (1 - cos ((2 * k + 1) * acos (-1.0) / (2 * d + 2)));
+    mpfr_set_d (c->t[k], t, MPFR_RNDN);
+    mpfr_add_ui (c->x, c->t[k], p->i0, MPFR_RNDN); /* exact */
+    mpfr_mul_2si (c->x, c->x, b->q, MPFR_RNDN);
+    if (sign < 0)
+      mpfr_neg (c->x, c->x, MPFR_RNDN);
+    mpfr_f (c->a[k], c->x, MPFR_RNDN);
+    if (!mpfr_regular_p (c->a[k]))
+      return 0;
+    mpfr_mul_2si (c->a[k], c->a[k], 54 - p->E, MPFR_RNDN);
+  }
+  for (int j = 1; j <= d; j++)
+    for (int k = d; k >= j; k--)
+    {
+      mpfr_sub (c->a[k], c->a[k], c->a[k - 1], MPFR_RNDN);
+      mpfr_sub (c->u, c->t[k], c->t[k - j], MPFR_RNDN);
+      mpfr_div (c->a[k], c->a[k], c->u, MPFR_RNDN);
+    }
+
+  /* convert to the monomial basis */
+  mpfr_set (c->c[0], c->a[d], MPFR_RNDN);
+  for (int k = d - 1; k >= 0; k--)
+  {
+    int r = d - k; /* current degree */
+    mpfr_set (c->c[r], c->c[r - 1], MPFR_RNDN);
+    for (int j = r - 1; j >= 1; j--)
+    {
+      mpfr_mul (c->u, c->c[j], c->t[k], MPFR_RNDN);
+      mpfr_sub (c->c[j], c->c[j - 1], c->u, MPFR_RNDN);
+    }
+    mpfr_mul (c->u, c->c[0], c->t[k], MPFR_RNDN);
+    mpfr_sub (c->c[0], c->a[k], c->u, MPFR_RNDN);
+  }
+
+  /* bounds, for 0 <= t <= L, on the interpolation error (estimated by the
+     term of degree d), |P(t) - P(0)|, |P''(t)/2|, and |P'''(t)/6| */
+  double cr[DMAX + 1];
+  for (int r = 0; r <= d; r++)
+    cr[r] = fabs (mpfr_get_d (c->c[r], MPFR_RNDA));
+  double eint = cr[d] * pow (L, d), R = 0, v2max = 0, p3 = 0;
+  for (int r = d; r >= 1; r--)
+    R = (R + cr[r]) * L;
+  for (int r = d; r >= 2; r--)
+    v2max = v2max * L + cr[r] * r * (r - 1) / 2;
+  for (int r = d; r >= 3; r--)
+    p3 = p3 * L + cr[r] * r * (r - 1) * (r - 2) / 6;
+  R = R * (1 + 0x1p-40);
+  v2max = v2max * (1 + 0x1p-40);
+  p->p3 = p3 * (1 + 0x1p-40);
+
+  /* V should stay in the binade [2^53,2^54), or [0,2^54) for E = -1021 */
+  double V0 = fabs (mpfr_get_d (c->c[0], MPFR_RNDN));
+  if (V0 + R >= 0x1p54 || (p->E > -1021 && V0 - R < 0x1p53))
+    return 0;
+
+  /* choose N such that the quadratic term on a subinterval is small
+     enough for exists_below() to find few candidates */
+  uint64_t N = (uint64_t) 1 << n_log;
+  while (N > 16 && (v2max * N * N * N > 0x1p-4 || N * 2 > p->len))
+    N /= 2;
+  if (v2max * N * N * N > 0x1p-4)
+    return 0;
+  p->N = N;
+  p->J = (p->len + N - 1) / N;
+  double J = p->J, NN = N;
+  double efix = 0x1p-125 * (table_error (J, d) + table_error (J, d - 1) * NN
+                            + table_error (J, d - 2) * NN * NN);
+  p->base = ldexp (1.0, -target_m) + eint + efix + 0x1p-80;
+  if (p->base >= 0x1p-3)
+    return 0;
+
+  /* the difference tables of P, P' and P''/2 */
+  init_table (c, p->d0, c->c, d, N);
+  for (int r = 0; r < d; r++)
+    mpfr_mul_ui (c->a[r], c->c[r + 1], r + 1, MPFR_RNDN);
+  init_table (c, p->d1, c->a, d - 1, N);
+  for (int r = 0; r < d - 1; r++)
+    mpfr_mul_ui (c->a[r], c->c[r + 2], (r + 2) * (r + 1) / 2, MPFR_RNDN);
+  init_table (c, p->d2, c->a, d - 2, N);
+
+#pragma omp atomic
+  npieces++;
+  return 1;
+}
+
+/* search the n inputs i0 + t0 + k for 0 <= k < n, where
+   V = v0 + v1*k + v2*k^2 + O(k^3) */
+static void
+search_sub (ctx_t *c, const piece_t *p, uint64_t t0, uint64_t n,
+            u128 v0, u128 v1, u128 v2, unsigned long *tests)
+{
+  double nn = n;
+  double delta = p->base + p->p3 * nn * nn * nn;
+
+  if (n <= 16)
+  {
+    /* here the quadratic term is evaluated exactly */
+    if (delta >= 0.5)
+    {
+      check_direct (c, p->b, p->i0 + t0, n);
+      return;
+    }
+    u128 T = fix128 (delta);
+    for (uint64_t k = 0; k < n; k++)
+    {
+      u128 v = v0 + v1 * k + v2 * (k * k);
+      i128 y = (i128) (v << (128 - FRAC));
+      u128 ay = (y < 0) ? -(u128) y : (u128) y;
+      if (ay < T)
+        check_input (c, p->b, p->i0 + t0 + k);
+    }
+    return;
+  }
+
+  delta += fabs (to_double (v2)) * nn * nn;
+  if (delta < 0.25)
+  {
+    /* is there some k with |v0 + v1*k - round(v0 + v1*k)| < delta, i.e.,
+       frac(v0 + delta + v1*k) < 2*delta? */
+    u128 D = (u128) ldexp (delta, 64) << (FRAC - 64);
+    u128 a = (v1 << (128 - FRAC)) >> (128 - WBITS);
+    u128 b = ((v0 + D) << (128 - FRAC)) >> (128 - WBITS);
+    u128 T = ((u128) ldexp (2 * delta, 64) << (WBITS - 64)) + 2;
+    (*tests)++;
+    if (!exists_below (n, (u128) 1 << WBITS, a, b, T))
+      return;
+  }
+
+  uint64_t h = n / 2;
+  search_sub (c, p, t0, h, v0, v1, v2, tests);
+  v0 += v1 * h + v2 * ((u128) h * h);
+  v1 += 2 * v2 * h;
+  search_sub (c, p, t0 + h, n - h, v0, v1, v2, tests);
+}
+
+/* search the inputs s*i*2^q for i0 <= i < i0 + len */
+static void
+search_piece (ctx_t *c, const binade_t *b, uint64_t i0, uint64_t len)
+{
+  piece_t p[1];
+  p->b = b;
+  p->i0 = i0;
+  p->len = len;
+  if (len <= DIRECT)
+  {
+    check_direct (c, b, i0, len);
+    return;
+  }
+  if (!init_piece (c, p))
+  {
+    search_piece (c, b, i0, len / 2);
+    search_piece (c, b, i0 + len / 2, len - len / 2);
+    return;
+  }
+
+  int d = degree;
+  unsigned long tests = 0;
+  for (uint64_t j = 0; j < p->J; j++)
+  {
+    uint64_t t0 = j * p->N;
+    uint64_t n = (len - t0 < p->N) ? len - t0 : p->N;
+    search_sub (c, p, t0, n, p->d0[0], p->d1[0], p->d2[0], &tests);
+    for (int k = 0; k < d; k++)
+      p->d0[k] += p->d0[k + 1];
+    for (int k = 0; k < d - 1; k++)
+      p->d1[k] += p->d1[k + 1];
+    for (int k = 0; k < d - 2; k++)
+      p->d2[k] += p->d2[k + 1];
+  }
+#pragma omp atomic
+  ntests += tests;
+}
+
+/* the unit u covers the inputs i of binade b with
+   lo + (u - first)*2^t <= i < lo + (u - first + 1)*2^t, and i <= hi */
+static void
+search_unit (ctx_t *c, uint64_t u)
+{
+  int k = 0;
+  while (k + 1 < nbinades && binades[k + 1].first <= u)
+    k++;
+  const binade_t *b = binades + k;
+  uint64_t i0 = b->lo + ((u - b->first) << t_log);
+  uint64_t i1 = i0 + ((uint64_t) 1 << t_log) - 1;
+  if (i1 > b->hi)
+    i1 = b->hi;
+  search_piece (c, b, i0, i1 - i0 + 1);
+}
+
+/* split [|xmin|,|xmax|] into binades */
+static void
+init_binades (void)
+{
+  double a = fabs (Xmin), c = fabs (Xmax);
+  if (a > c)
+  {
+    double t = a;
+    a = c;
+    c = t;
+  }
+  int emin = (a < 0x1p-1022) ? -1023 : ilogb (a);
+  int emax = (c < 0x1p-1022) ? -1023 : ilogb (c);
+  binades = malloc ((emax - emin + 1) * sizeof (binade_t));
+  nbinades = 0;
+  nunits = 0;
+  for (int e = emin; e <= emax; e++)
+  {
+    binade_t *b = binades + nbinades;
+    /* the inputs are i*2^q, with 2^52 <= i < 2^53, or 1 <= i < 2^52 for
+       the subnormals */
+    b->q = (e == -1023) ? -1074 : e - 52;
+    b->lo = (e == -1023) ? 1 : (uint64_t) 1 << 52;
+    b->hi = ((uint64_t) 1 << 53) - 1;
+    if (e == -1023)
+      b->hi = ((uint64_t) 1 << 52) - 1;
+    if (e == emin)
+      b->lo = (uint64_t) ldexp (a, -b->q);
+    if (e == emax)
+      b->hi = (uint64_t) ldexp (c, -b->q);
+    if (b->lo == 0)
+      b->lo = 1;
+    if (b->lo > b->hi)
+      continue;
+    b->first = nunits;
+    nunits += ((b->hi - b->lo) >> t_log) + 1;
+    nbinades++;
+  }
+}
+
+static void
+mark_done (uint64_t u)
+{
+#pragma omp atomic
+  done[u / 8] |= 1 << (u % 8);
+}
+
+static int
+is_done (uint64_t u)
+{
+  return (done[u / 8] >> (u % 8)) & 1;
+}
+
+/* write the checkpoint file: the command line, then the ranges of units
+   done, one per line */
+static void
+write_checkpoint (void)
+{
+  size_t len = strlen (ckpt_file) + 5;
+  char *tmp = malloc (len);
+  snprintf (tmp, len, "%s.tmp", ckpt_file);
+  FILE *fp = fopen (tmp, "w");
+  if (fp == NULL)
+  {
+    fprintf (stderr, "Error, cannot write %s\n", tmp);
+    exit (1);
+  }
+  fprintf (fp, "# %s\n", args);
+  for (uint64_t u = 0; u < nunits; u++)
+    if (is_done (u))
+    {
+      uint64_t v = u;
+      while (v + 1 < nunits && is_done (v + 1))
+        v++;
+      fprintf (fp, "%lu %lu\n", (unsigned long) u, (unsigned long) v);
+      u = v;
+    }
+  if (fclose (fp) != 0 || rename (tmp, ckpt_file) != 0)
+  {
+    fprintf (stderr, "Error, cannot write %s\n", ckpt_file);
+    exit (1);
+  }
+  free (tmp);
+}
+
+/* read the checkpoint file if it exists, and return the number of units
+   done */
+static uint64_t
+read_checkpoint (void)
+{
+  FILE *fp = fopen (ckpt_file, "r");
+  if (fp == NULL)
+    return 0;
+  char *buf = NULL;
+  size_t buflength = 0;
+  ssize_t n = getline (&buf, &buflength, fp);
+  if (n < 2 || buf[n - 1] != '\n' || strncmp (buf, "# ", 2) != 0
+      || (buf[n - 1] = '\0', strcmp (buf + 2, args) != 0))
+  {
+    fprintf (stderr, "Error, %s was written by another command\n",
+             ckpt_file);
+    exit (1);
+  }
+  uint64_t count = 0;
+  unsigned long a, b;
+  while (fscanf (fp, "%lu %lu", &a, &b) == 2)
+  {
+    if (a > b || b >= nunits)
+    {
+      fprintf (stderr, "Error, invalid range in %s\n", ckpt_file);
+      exit (1);
+    }
+    for (uint64_t u = a; u <= b; u++)
+      if (!is_done (u))
+      {
+        mark_done (u);
+        count++;
+      }
+  }
+  free (buf);
+  fclose (fp);
+  return count;
+}
+
+static double
+parse_double (const char *s)
+{
+  char *end;
+  double x = strtod (s, &end);
+  if (*end != '\0')
+  {
+    fprintf (stderr, "Error, invalid number %s\n", s);
+    exit (1);
+  }
+  return x;
+}
+
+static void
+usage (void)
+{
+  fprintf (stderr, "Usage: worst [-f name] [-m m] [-d degree] [-t t] [-n n] "
+           "-xmin xmin -xmax xmax [-o file] [-checkpoint file] [-v]\n");
+  exit (1);
+}
+
+int
+main (int argc, char *argv[])
+{
+#ifdef WORST_FUNCTION
+  fname = WORST_FUNCTION;
+#endif
+
+  /* the command line, to check the checkpoint file */
+  size_t len = 1;
+  for (int i = 0; i < argc; i++)
+    len += strlen (argv[i]) + 1;
+  args = malloc (len);
+  args[0] = '\0';
+  for (int i = 0; i < argc; i++)
+  {
+    strcat (args, argv[i]);
+    if (i + 1 < argc)
+      strcat (args, " ");
+  }
+
+  while (argc >= 2 && argv[1][0] == '-')
+  {
+    if (argc >= 3 && strcmp (argv[1], "-f") == 0)
+      fname = argv[2];
+    else if (argc >= 3 && strcmp (argv[1], "-m") == 0)
+      target_m = atoi (argv[2]);
+    else if (argc >= 3 && strcmp (argv[1], "-d") == 0)
+      degree = atoi (argv[2]);
+    else if (argc >= 3 && strcmp (argv[1], "-t") == 0)
+      t_log = atoi (argv[2]);
+    else if (argc >= 3 && strcmp (argv[1], "-n") == 0)
+      n_log = atoi (argv[2]);
+    else if (argc >= 3 && strcmp (argv[1], "-xmin") == 0)
+    {
+      Xmin = parse_double (argv[2]);
+      xmin_set = 1;
+    }
+    else if (argc >= 3 && strcmp (argv[1], "-xmax") == 0)
+    {
+      Xmax = parse_double (argv[2]);
+      xmax_set = 1;
+    }
+    else if (argc >= 3 && strcmp (argv[1], "-o") == 0)
+      out_file = argv[2];
+    else if (argc >= 3 && strcmp (argv[1], "-checkpoint") == 0)
+      ckpt_file = argv[2];
+    else if (strcmp (argv[1], "-v") == 0)
+    {
+      verbose = 1;
+      argc++;
+      argv--;
+    }
+    else
+    {
+      fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+      usage ();
+    }
+    argc -= 2;
+    argv += 2;
+  }
+  if (argc != 1 || !xmin_set || !xmax_set)
+    usage ();
+
+  for (size_t k = 0; fname != NULL && k < sizeof (functions) / sizeof (functions[0]); k++)
+    if (strcmp (fname, functions[k].name) == 0)
+      mpfr_f = functions[k].f;
+  if (mpfr_f == NULL)
+  {
+    fprintf (stderr, "Error, unknown function %s (see -f)\n",
+             fname ? fname : "");
+    exit (1);
+  }
+  if (target_m < 1 || target_m > 64)
+  {
+    fprintf (stderr, "Error, m should be in [1,64]\n");
+    exit (1);
+  }
+  if (degree < 2 || degree > DMAX)
+  {
+    fprintf (stderr, "Error, the degree should be in [2,%d]\n", DMAX);
+    exit (1);
+  }
+  if (t_log < 8 || t_log > 52 || n_log < 5 || n_log > 20)
+  {
+    fprintf (stderr, "Error, t should be in [8,52] and n in [5,20]\n");
+    exit (1);
+  }
+  if (Xmin == 0 || Xmax == 0 || (Xmin < 0) != (Xmax < 0) || Xmin > Xmax
+      || isinf (Xmin) || isinf (Xmax))
+  {
+    fprintf (stderr, "Error, xmin and xmax should be finite and non-zero, "
+             "with the same sign, and xmin <= xmax\n");
+    exit (1);
+  }
+  sign = (Xmin < 0) ? -1 : 1;
+
+  init_binades ();
+  if (nunits > ((uint64_t) 1 << 32))
+  {
+    fprintf (stderr, "Error, too many units, increase t\n");
+    exit (1);
+  }
+  done = calloc (nunits / 8 + 1, 1);
+  uint64_t ndone = 0;
+  if (ckpt_file != NULL)
+    ndone = read_checkpoint ();
+
+  out = stdout;
+  if (out_file != NULL && (out = fopen (out_file, "a")) == NULL)
+  {
+    fprintf (stderr, "Error, cannot open %s\n", out_file);
+    exit (1);
+  }
+  fprintf (out, "# %s\n", args);
+  fflush (out);
+
+  double start = omp_get_wtime (), last = start;
+  uint64_t ndone0 = ndone;
+#pragma omp parallel
+  {
+    ctx_t c[1];
+    ctx_init (c);
+#pragma omp for schedule(dynamic,1)
+    for (uint64_t u = 0; u < nunits; u++)
+    {
+      if (is_done (u))
+        continue;
+      search_unit (c, u);
+      mark_done (u);
+#pragma omp atomic
+      ndone++;
+      if (omp_get_wtime () - last >= 60)
+      {
+#pragma omp critical(checkpoint)
+        if (omp_get_wtime () - last >= 60)
+        {
+          if (ckpt_file != NULL)
+            write_checkpoint ();
+          last = omp_get_wtime ();
+          if (verbose)
+            fprintf (stderr, "%lu/%lu units, %.0f inputs/s\n",
+                     (unsigned long) ndone, (unsigned long) nunits,
+                     (double) ((ndone - ndone0) << t_log) / (last - start));
+        }
+      }
+    }
+    ctx_clear (c);
+  }
+  if (ckpt_file != NULL)
+    write_checkpoint ();
+
+  fflush (out);
+  if (out != stdout)
+    fclose (out);
+  printf ("# units=%lu pieces=%lu tests=%lu checks=%lu\n",
+          (unsigned long) nunits, npieces, ntests, nchecks);
+  printf ("# nsols=%lu nexact=%lu time=%.2fs\n", nsols, nexact,
+          omp_get_wtime () - start);
+  free (binades);
+  free (done);
+  free (args);
+  return 0;
+}
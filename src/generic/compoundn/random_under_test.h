@@ -0,0 +1,6 @@
+static inline TYPE_UNDER_TEST random_under_test (void)
+{
+  /* sample in [-1,16] since compound(x,n) gives NaN for x < -1: the samples
+     are also used for the integer n, after truncation */
+  return -1 + 17 * ((TYPE_UNDER_TEST) rand() / (TYPE_UNDER_TEST) RAND_MAX);
+}
@@ -0,0 +1,5 @@
+static inline TYPE_UNDER_TEST random_under_test (void)
+{
+  /* sample in [-10,40] */
+  return 50 * ((TYPE_UNDER_TEST) rand() / (TYPE_UNDER_TEST) RAND_MAX) - 10;
+}
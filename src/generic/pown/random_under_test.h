@@ -0,0 +1,6 @@
+static inline TYPE_UNDER_TEST random_under_test (void)
+{
+  /* sample in [-16,16]: the samples are also used for the integer exponent,
+     after truncation */
+  return -16 + 32 * ((TYPE_UNDER_TEST) rand() / (TYPE_UNDER_TEST) RAND_MAX);
+}
@@ -0,0 +1,5 @@
+static inline TYPE_UNDER_TEST random_under_test (void)
+{
+  /* sample in [0,10] since powr(x,y) gives NaN for x negative */
+  return 10 * ((TYPE_UNDER_TEST) rand() / (TYPE_UNDER_TEST) RAND_MAX);
+}
@@ -0,0 +1,6 @@
+static inline TYPE_UNDER_TEST random_under_test (void)
+{
+  /* sample in [2,16]: the samples are also used for the integer n, after
+     truncation, and rootn(x,n) gives NaN for x negative and n even */
+  return 2 + 14 * ((TYPE_UNDER_TEST) rand() / (TYPE_UNDER_TEST) RAND_MAX);
+}
@@ -36,13 +36,18 @@ SOFTWARE.
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/mman.h>
-#ifdef __x86__64__
+#ifdef __x86_64__
 #include <x86intrin.h>
 #endif
 
 #include "random_under_test.h"
 
-typedef TYPE_UNDER_TEST function_type_under_test (TYPE_UNDER_TEST, TYPE_UNDER_TEST);
+/* the second argument can be an integer, as for pownf() */
+#ifndef TYPE_ARG2
+#define TYPE_ARG2 TYPE_UNDER_TEST
+#endif
+
+typedef TYPE_UNDER_TEST function_type_under_test (TYPE_UNDER_TEST, TYPE_ARG2);
 
 function_type_under_test cr_function_under_test;
 function_type_under_test function_under_test;
@@ -51,4 +56,5 @@ function_type_under_test function_under_test;
 #define CALL_LATENCY(i) (p_function_under_test(randoms[2 * i] + 0 * accu, randoms[2 * i + 1]))
 #define CALL_THROUGHPUT(i) (p_function_under_test(randoms[2 * i], randoms[2 * i + 1]))
 
+#include "prefetch.h"
 #include "perf_common.h"
@@ -46,11 +46,21 @@ inline uint64_t __rdtsc(void) {
 }
 #endif
 
+/* Wait for the previous instructions to complete, so that rdtsc does not
+   count the eviction loop of --cold, or misses the end of the call. */
+#ifdef __x86_64__
+#define FENCE() _mm_lfence()
+#elif defined(__aarch64__)
+#define FENCE() asm volatile ("isb" ::: "memory")
+#else
+#define FENCE() ((void) 0)
+#endif
+
 int
 main (int argc, char *argv[])
 {
   int count = 1000000, repeat = 1;
-  int reference = 0, latency = 0, show_rdtsc = 0;
+  int reference = 0, latency = 0, show_rdtsc = 0, cold = 0, prefetch = 0;
   function_type_under_test *p_function_under_test = &cr_function_under_test;
   char *file = NULL;
 
@@ -98,6 +108,20 @@ main (int argc, char *argv[])
           argc --;
           argv ++;
         }
+      else if (strcmp (argv[1], "--cold") == 0)
+        {
+          argc --;
+          argv ++;
+          cold = atoi(argv[1]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--prefetch") == 0)
+        {
+          prefetch = 1;
+          argc --;
+          argv ++;
+        }
       else if (strcmp (argv[1], "--libc") == 0)
         {
           p_function_under_test = &function_under_test;
@@ -180,8 +204,33 @@ main (int argc, char *argv[])
       exit(3);
     }
     memcpy(randoms, mmaped_randoms, count * SAMPLE_SIZE);
-    uint64_t start = __rdtsc();
-    if (latency) {
+    uint64_t start = __rdtsc(), cycles = 0;
+    if (cold) {
+      /* Cold-cache mode: before each call, read a buffer of cold kilobytes
+         to evict the tables of the function from the caches (and optionally
+         warm them again with cr_math_prefetch), then time the call alone. */
+      size_t n = (size_t) cold * 1024;
+      volatile char *buf = calloc(n, 1);
+      if (buf == NULL) {
+        perror("calloc");
+        exit(3);
+      }
+      for (int r = 0; r < repeat; r++) {
+        for (int i = 0; i < count; i++) {
+          for (size_t j = 0; j < n; j += 64)
+            (void) buf[j];
+          if (prefetch)
+            cr_math_prefetch(CR_MATH_ALL);
+          FENCE();
+          uint64_t t0 = __rdtsc();
+          FENCE();
+          CALL_THROUGHPUT(i);
+          FENCE();
+          cycles += __rdtsc() - t0;
+        }
+      }
+      free((void *) buf);
+    } else if (latency) {
       for (int r = 0; r < repeat; r++) {
         TYPE_UNDER_TEST accu = 0;
         for (int i = 0; i < count; i++) {
@@ -196,8 +245,10 @@ main (int argc, char *argv[])
       }
     }
     uint64_t stop = __rdtsc();
+    if (!cold)
+      cycles = stop - start;
     if (show_rdtsc) {
-      printf("%.3f\n", (double) (stop - start) / (repeat * count));
+      printf("%.3f\n", (double) cycles / (repeat * count));
     }
     munmap(mmaped_randoms, count * sizeof(TYPE_UNDER_TEST));
     close(fd);
@@ -51,4 +51,5 @@ function_type_under_test function_under_test;
 #define CALL_LATENCY(i) (p_function_under_test(randoms[i] + 0 * accu))
 #define CALL_THROUGHPUT(i) (p_function_under_test(randoms[i]))
 
+#include "prefetch.h"
 #include "perf_common.h"
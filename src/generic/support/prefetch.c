@@ -0,0 +1,58 @@
+/* Warm-up of the tables of core-math functions (see prefetch.h).
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "prefetch.h"
+
+/* Each function with tables defines a hook reading them.  The references
+   are weak, so that a hook is only called when its function is linked. */
+extern void cr_acos_prefetch (void) __attribute__((weak));
+extern void cr_acosh_prefetch (void) __attribute__((weak));
+extern void cr_asinh_prefetch (void) __attribute__((weak));
+extern void cr_atanh_prefetch (void) __attribute__((weak));
+extern void cr_log_prefetch (void) __attribute__((weak));
+extern void cr_erfcf_prefetch (void) __attribute__((weak));
+extern void cr_exp2f_kernel_prefetch (void) __attribute__((weak));
+extern void cr_logf_kernel_prefetch (void) __attribute__((weak));
+
+static void
+call (unsigned long fnmask, unsigned long mask, void (*hook) (void))
+{
+  if ((fnmask & mask) && hook != 0)
+    hook ();
+}
+
+void
+cr_math_prefetch (unsigned long fnmask)
+{
+  call (fnmask, CR_MATH_ACOS, cr_acos_prefetch);
+  call (fnmask, CR_MATH_ACOSH, cr_acosh_prefetch);
+  call (fnmask, CR_MATH_ASINH, cr_asinh_prefetch);
+  call (fnmask, CR_MATH_ATANH, cr_atanh_prefetch);
+  call (fnmask, CR_MATH_LOG, cr_log_prefetch);
+  call (fnmask, CR_MATH_ERFCF, cr_erfcf_prefetch);
+  call (fnmask, CR_MATH_EXPF_FAMILY, cr_exp2f_kernel_prefetch);
+  call (fnmask, CR_MATH_LOGF_FAMILY, cr_logf_kernel_prefetch);
+}
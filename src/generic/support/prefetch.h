@@ -0,0 +1,57 @@
+/* Warm-up of the tables of core-math functions.
+
+Copyright (c) 2022 INRIA.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* A call to a core-math function whose tables were evicted from the caches
+   pays for the misses on their lines: up to 256 lines for acos, 182 for
+   log.  Latency-critical code can call cr_math_prefetch() ahead of time,
+   for example while waiting for a request, to read the tables of the fast
+   path of a chosen set of functions.  Only the functions linked in the
+   program are touched: the others are ignored.  The cold-cache mode of the
+   perf program (--cold, see perf.sh) measures the effect of this call. */
+
+#ifndef CR_MATH_PREFETCH_H
+#define CR_MATH_PREFETCH_H
+
+#define CR_MATH_ACOS        (1ul << 0)
+#define CR_MATH_ACOSH       (1ul << 1)
+#define CR_MATH_ASINH       (1ul << 2)
+#define CR_MATH_ATANH       (1ul << 3)
+#define CR_MATH_LOG         (1ul << 4)
+#define CR_MATH_ERFCF       (1ul << 5)
+/* expf, exp2f, exp10f, expm1f, exp2m1f, exp10m1f, sinhf, coshf and powf,
+   which share the table of exp2f_kernel.h */
+#define CR_MATH_EXPF_FAMILY (1ul << 6)
+/* logf, log2f, log10f, log1pf, log2p1f and log10p1f, which share the table
+   of logf_kernel.h */
+#define CR_MATH_LOGF_FAMILY (1ul << 7)
+#define CR_MATH_ALL         (~0ul)
+
+/* Read the fast-path tables of the functions in fnmask, a union of the
+   CR_MATH_* values above, so that the next calls do not miss in the
+   caches. */
+void cr_math_prefetch (unsigned long fnmask);
+
+#endif